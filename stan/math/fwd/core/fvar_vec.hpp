@@ -0,0 +1,175 @@
+#ifndef STAN_MATH_FWD_CORE_FVAR_VEC_HPP
+#define STAN_MATH_FWD_CORE_FVAR_VEC_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <ostream>
+#include <type_traits>
+
+namespace stan {
+namespace math {
+
+/**
+ * This template class represents scalars used in vector mode forward
+ * automatic differentiation. Like `fvar<T>` it holds a value, but instead
+ * of a single tangent it holds the tangents in `N` directions, so that
+ * one evaluation of a function propagates all of them.
+ *
+ * The tangents are stored in a fixed size Eigen array, so for arithmetic
+ * `T` the updates of all directions are vectorized by Eigen. Functionals
+ * that need more directions than `N` process them in chunks of `N`.
+ *
+ * Only the arithmetic operators, comparisons and a set of elementary
+ * functions are defined for this type; see the `fvar_vec` overloads in
+ * `stan/math/fwd/core` and `stan/math/fwd/fun`.
+ *
+ * @tparam T type of value and tangents
+ * @tparam N number of tangent directions
+ */
+template <typename T, int N>
+struct fvar_vec {
+  static_assert(N > 0, "fvar_vec needs a positive number of directions");
+
+  /**
+   * The type of the tangents.
+   */
+  using tangent_type = Eigen::Array<T, N, 1, Eigen::DontAlign>;
+
+  /**
+   * The value of this variable.
+   */
+  T val_;
+
+  /**
+   * The tangents (directional derivatives) of this variable.
+   */
+  tangent_type d_;
+
+  /**
+   * The type of values and tangents.
+   */
+  using Scalar = T;
+
+  /**
+   * The number of tangent directions.
+   */
+  static constexpr int num_directions = N;
+
+  /**
+   * Return the value of this variable.
+   *
+   * @return value of this variable
+   */
+  T val() const { return val_; }
+
+  /**
+   * Return the tangents of this variable.
+   *
+   * @return tangents of this variable
+   */
+  const tangent_type& tangent() const { return d_; }
+
+  /**
+   * Construct a forward variable with zero value and tangents.
+   */
+  fvar_vec() : val_(0), d_(tangent_type::Constant(T(0))) {}
+
+  /**
+   * Construct a forward variable with the specified value and zero
+   * tangents.
+   *
+   * @tparam V type of value (must be assignable to the value and
+   *   tangent type T)
+   * @param[in] v value
+   */
+  template <typename V, typename = std::enable_if_t<ad_promotable<V, T>::value>>
+  fvar_vec(const V& v)  // NOLINT(runtime/explicit)
+      : val_(v), d_(tangent_type::Constant(T(0))) {}
+
+  /**
+   * Construct a forward variable with the specified value and tangents.
+   *
+   * @tparam V type of value (must be assignable to the value and
+   *   tangent type T)
+   * @tparam D type of the tangents, an Eigen expression with `N` elements
+   * @param[in] v value
+   * @param[in] d tangents
+   */
+  template <typename V, typename D>
+  fvar_vec(const V& v, const D& d) : val_(v), d_(d) {}
+
+  inline fvar_vec& operator+=(const fvar_vec& x2) {
+    val_ += x2.val_;
+    d_ += x2.d_;
+    return *this;
+  }
+
+  inline fvar_vec& operator+=(double x2) {
+    val_ += x2;
+    return *this;
+  }
+
+  inline fvar_vec& operator-=(const fvar_vec& x2) {
+    val_ -= x2.val_;
+    d_ -= x2.d_;
+    return *this;
+  }
+
+  inline fvar_vec& operator-=(double x2) {
+    val_ -= x2;
+    return *this;
+  }
+
+  inline fvar_vec& operator*=(const fvar_vec& x2) {
+    d_ = d_ * x2.val_ + val_ * x2.d_;
+    val_ *= x2.val_;
+    return *this;
+  }
+
+  inline fvar_vec& operator*=(double x2) {
+    val_ *= x2;
+    d_ *= x2;
+    return *this;
+  }
+
+  inline fvar_vec& operator/=(const fvar_vec& x2) {
+    d_ = (d_ * x2.val_ - val_ * x2.d_) / (x2.val_ * x2.val_);
+    val_ /= x2.val_;
+    return *this;
+  }
+
+  inline fvar_vec& operator/=(double x2) {
+    val_ /= x2;
+    d_ /= x2;
+    return *this;
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const fvar_vec& v) {
+    return os << v.val_;
+  }
+};
+
+/**
+ * Return a forward variable with the specified value whose tangent in
+ * direction `i` is one and zero in all other directions. Directions
+ * outside of `[0, N)` give a variable with zero tangents.
+ *
+ * @tparam T type of value and tangents
+ * @tparam N number of tangent directions
+ * @param[in] v value
+ * @param[in] i direction in which the tangent is one
+ * @return forward variable seeded in direction `i`
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> seed_fvar_vec(const T& v, int i) {
+  typename fvar_vec<T, N>::tangent_type d
+      = fvar_vec<T, N>::tangent_type::Constant(T(0));
+  if (i >= 0 && i < N) {
+    d.coeffRef(i) = 1;
+  }
+  return fvar_vec<T, N>(v, d);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -2,6 +2,7 @@
 #define STAN_MATH_FWD_CORE_OPERATOR_ADDITION_HPP
 
 #include <stan/math/fwd/core/fvar.hpp>
+#include <stan/math/fwd/core/fvar_vec.hpp>
 
 namespace stan {
 namespace math {
@@ -45,6 +46,50 @@ inline fvar<T> operator+(const fvar<T>& x1, double x2) {
   return fvar<T>(x1.val_ + x2, x1.d_);
 }
 
+/**
+ * Return the sum of the specified forward mode addends with several
+ * tangent directions.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x1 first addend
+ * @param x2 second addend
+ * @return sum of addends
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> operator+(const fvar_vec<T, N>& x1,
+                                const fvar_vec<T, N>& x2) {
+  return fvar_vec<T, N>(x1.val_ + x2.val_, x1.d_ + x2.d_);
+}
+
+/**
+ * Return the sum of the specified double and forward mode addends.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x1 first addend
+ * @param x2 second addend
+ * @return sum of addends
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> operator+(double x1, const fvar_vec<T, N>& x2) {
+  return fvar_vec<T, N>(x1 + x2.val_, x2.d_);
+}
+
+/**
+ * Return the sum of the specified forward mode and double addends.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x1 first addend
+ * @param x2 second addend
+ * @return sum of addends
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> operator+(const fvar_vec<T, N>& x1, double x2) {
+  return fvar_vec<T, N>(x1.val_ + x2, x1.d_);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -2,6 +2,7 @@
 #define STAN_MATH_FWD_CORE_OPERATOR_DIVISION_HPP
 
 #include <stan/math/fwd/core/fvar.hpp>
+#include <stan/math/fwd/core/fvar_vec.hpp>
 #include <stan/math/prim/core/operator_division.hpp>
 #include <complex>
 #include <type_traits>
@@ -97,6 +98,51 @@ inline std::complex<fvar<T>> operator/(U x1, const std::complex<fvar<T>>& x2) {
   return internal::complex_divide(x1, x2);
 }
 
+/**
+ * Return the result of dividing the first argument by the second.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument divided by second argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> operator/(const fvar_vec<T, N>& x1,
+                                const fvar_vec<T, N>& x2) {
+  return fvar_vec<T, N>(x1.val_ / x2.val_,
+                        (x1.d_ * x2.val_ - x2.d_ * x1.val_)
+                            / (x2.val_ * x2.val_));
+}
+
+/**
+ * Return the result of dividing the first argument by the second.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument divided by second argument
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_vec<T, N> operator/(const fvar_vec<T, N>& x1, U x2) {
+  return fvar_vec<T, N>(x1.val_ / x2, x1.d_ / static_cast<double>(x2));
+}
+
+/**
+ * Return the result of dividing the first argument by the second.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument divided by second argument
+ */
+template <typename T, int N, typename U, require_arithmetic_t<U>* = nullptr>
+inline fvar_vec<T, N> operator/(U x1, const fvar_vec<T, N>& x2) {
+  return fvar_vec<T, N>(x1 / x2.val_, x2.d_ * (-x1 / (x2.val_ * x2.val_)));
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
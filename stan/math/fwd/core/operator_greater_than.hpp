@@ -2,6 +2,7 @@
 #define STAN_MATH_FWD_CORE_OPERATOR_GREATER_THAN_HPP
 
 #include <stan/math/fwd/core/fvar.hpp>
+#include <stan/math/fwd/core/fvar_vec.hpp>
 
 namespace stan {
 namespace math {
@@ -51,6 +52,51 @@ inline bool operator>(double x, const fvar<T>& y) {
   return x > y.val_;
 }
 
+/**
+ * Return true if the value of the first argument is greater than the
+ * value of the second argument. Tangents are ignored.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param[in] x first argument
+ * @param[in] y second argument
+ * @return comparison of the values of the arguments
+ */
+template <typename T, int N>
+inline bool operator>(const fvar_vec<T, N>& x, const fvar_vec<T, N>& y) {
+  return x.val_ > y.val_;
+}
+
+/**
+ * Return true if the value of the first argument is greater than the
+ * value of the second argument. Tangents are ignored.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param[in] x first argument
+ * @param[in] y second argument
+ * @return comparison of the values of the arguments
+ */
+template <typename T, int N>
+inline bool operator>(double x, const fvar_vec<T, N>& y) {
+  return x > y.val_;
+}
+
+/**
+ * Return true if the value of the first argument is greater than the
+ * value of the second argument. Tangents are ignored.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param[in] x first argument
+ * @param[in] y second argument
+ * @return comparison of the values of the arguments
+ */
+template <typename T, int N>
+inline bool operator>(const fvar_vec<T, N>& x, double y) {
+  return x.val_ > y;
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -2,6 +2,7 @@
 #define STAN_MATH_FWD_CORE_OPERATOR_MULTIPLICATION_HPP
 
 #include <stan/math/fwd/core/fvar.hpp>
+#include <stan/math/fwd/core/fvar_vec.hpp>
 
 namespace stan {
 namespace math {
@@ -45,6 +46,52 @@ inline fvar<T> operator*(const fvar<T>& x, double y) {
   return fvar<T>(x.val_ * y, x.d_ * y);
 }
 
+/**
+ * Return the product of the specified forward mode arguments with
+ * several tangent directions.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x first argument
+ * @param y second argument
+ * @return product of the arguments
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> operator*(const fvar_vec<T, N>& x,
+                                const fvar_vec<T, N>& y) {
+  return fvar_vec<T, N>(x.val_ * y.val_, x.d_ * y.val_ + y.d_ * x.val_);
+}
+
+/**
+ * Return the product of the specified double and forward mode
+ * arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x first argument
+ * @param y second argument
+ * @return product of the arguments
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> operator*(double x, const fvar_vec<T, N>& y) {
+  return fvar_vec<T, N>(x * y.val_, y.d_ * x);
+}
+
+/**
+ * Return the product of the specified forward mode and double
+ * arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x first argument
+ * @param y second argument
+ * @return product of the arguments
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> operator*(const fvar_vec<T, N>& x, double y) {
+  return fvar_vec<T, N>(x.val_ * y, x.d_ * y);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -2,6 +2,7 @@
 #define STAN_MATH_FWD_CORE_OPERATOR_SUBTRACTION_HPP
 
 #include <stan/math/fwd/core/fvar.hpp>
+#include <stan/math/fwd/core/fvar_vec.hpp>
 
 namespace stan {
 namespace math {
@@ -45,6 +46,52 @@ inline fvar<T> operator-(const fvar<T>& x1, double x2) {
   return fvar<T>(x1.val_ - x2, x1.d_);
 }
 
+/**
+ * Return the difference of the specified forward mode arguments with
+ * several tangent directions.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument minus the second
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> operator-(const fvar_vec<T, N>& x1,
+                                const fvar_vec<T, N>& x2) {
+  return fvar_vec<T, N>(x1.val_ - x2.val_, x1.d_ - x2.d_);
+}
+
+/**
+ * Return the difference of the specified double and forward mode
+ * arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument minus the second
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> operator-(double x1, const fvar_vec<T, N>& x2) {
+  return fvar_vec<T, N>(x1 - x2.val_, -x2.d_);
+}
+
+/**
+ * Return the difference of the specified forward mode and double
+ * arguments.
+ *
+ * @tparam T type of values and tangents
+ * @tparam N number of tangent directions
+ * @param x1 first argument
+ * @param x2 second argument
+ * @return first argument minus the second
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> operator-(const fvar_vec<T, N>& x1, double x2) {
+  return fvar_vec<T, N>(x1.val_ - x2, x1.d_);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -2,6 +2,7 @@
 #define STAN_MATH_FWD_CORE_OPERATOR_UNARY_PLUS_HPP
 
 #include <stan/math/fwd/core/fvar.hpp>
+#include <stan/math/fwd/core/fvar_vec.hpp>
 
 namespace stan {
 namespace math {
@@ -20,6 +21,19 @@ inline fvar<T> operator+(const fvar<T>& x) {
   return x;
 }
 
+/**
+ * Returns the argument. It is included for completeness.
+ *
+ * @tparam T value and tangent type of the argument
+ * @tparam N number of tangent directions
+ * @param[in] x argument
+ * @return the argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> operator+(const fvar_vec<T, N>& x) {
+  return x;
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -27,6 +27,22 @@ inline std::complex<fvar<T>> exp(const std::complex<fvar<T>>& z) {
   return internal::complex_exp(z);
 }
 
+/**
+ * Return the exponential of the specified argument, propagating all of
+ * its tangent directions.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param x argument
+ * @return exponential of the argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> exp(const fvar_vec<T, N>& x) {
+  using std::exp;
+  T u = exp(x.val_);
+  return fvar_vec<T, N>(u, x.d_ * u);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -15,6 +15,21 @@ inline fvar<T> expm1(const fvar<T>& x) {
   return fvar<T>(expm1(x.val_), x.d_ * exp(x.val_));
 }
 
+/**
+ * Return the exponential of the specified argument minus one,
+ * propagating all of its tangent directions.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param x argument
+ * @return exponential of the argument minus one
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> expm1(const fvar_vec<T, N>& x) {
+  using std::exp;
+  return fvar_vec<T, N>(expm1(x.val_), x.d_ * exp(x.val_));
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
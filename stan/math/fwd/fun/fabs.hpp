@@ -26,6 +26,31 @@ inline fvar<T> fabs(const fvar<T>& x) {
   }
 }
 
+/**
+ * Return the absolute value of the specified argument, propagating all of
+ * its tangent directions.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param x argument
+ * @return absolute value of the argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> fabs(const fvar_vec<T, N>& x) {
+  using std::fabs;
+  using tangent_type = typename fvar_vec<T, N>::tangent_type;
+  if (unlikely(is_nan(value_of(x.val_)))) {
+    return fvar_vec<T, N>(fabs(x.val_),
+                          tangent_type::Constant(T(NOT_A_NUMBER)));
+  } else if (x.val_ > 0.0) {
+    return x;
+  } else if (x.val_ < 0.0) {
+    return fvar_vec<T, N>(-x.val_, -x.d_);
+  } else {
+    return fvar_vec<T, N>(0, tangent_type::Constant(T(0)));
+  }
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
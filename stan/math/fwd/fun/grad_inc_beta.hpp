@@ -18,7 +18,8 @@ namespace math {
 
 /**
  * Gradient of the incomplete beta function beta(a, b, z) with
- * respect to the first two arguments.
+ * respect to the first two arguments, given the precomputed value of
+ * beta(a, b) * inc_beta(a, b, z).
  *
  * Uses the equivalence to a hypergeometric function. See
  * http://dlmf.nist.gov/8.17#ii
@@ -29,12 +30,13 @@ namespace math {
  * @param[in] a a
  * @param[in] b b
  * @param[in] z z
+ * @param[in] beta_inc_beta the value of beta(a, b) * inc_beta(a, b, z)
  */
 template <typename T>
-void grad_inc_beta(fvar<T>& g1, fvar<T>& g2, fvar<T> a, fvar<T> b, fvar<T> z) {
+void grad_inc_beta(fvar<T>& g1, fvar<T>& g2, fvar<T> a, fvar<T> b, fvar<T> z,
+                   const fvar<T>& beta_inc_beta) {
   fvar<T> c1 = log(z);
   fvar<T> c2 = log1m(z);
-  fvar<T> c3 = beta(a, b) * inc_beta(a, b, z);
 
   fvar<T> C = exp(a * c1 + b * c2) / a;
 
@@ -45,8 +47,27 @@ void grad_inc_beta(fvar<T>& g1, fvar<T>& g2, fvar<T> a, fvar<T> b, fvar<T> z) {
     grad_2F1(dF1, dF2, a + b, fvar<T>(1.0), a + 1, z);
   }
 
-  g1 = (c1 - 1.0 / a) * c3 + C * (dF1 + dF2);
-  g2 = c2 * c3 + C * dF1;
+  g1 = (c1 - 1.0 / a) * beta_inc_beta + C * (dF1 + dF2);
+  g2 = c2 * beta_inc_beta + C * dF1;
+}
+
+/**
+ * Gradient of the incomplete beta function beta(a, b, z) with
+ * respect to the first two arguments.
+ *
+ * Uses the equivalence to a hypergeometric function. See
+ * http://dlmf.nist.gov/8.17#ii
+ *
+ * @tparam T inner type of the fvar
+ * @param[out] g1 d/da
+ * @param[out] g2 d/db
+ * @param[in] a a
+ * @param[in] b b
+ * @param[in] z z
+ */
+template <typename T>
+void grad_inc_beta(fvar<T>& g1, fvar<T>& g2, fvar<T> a, fvar<T> b, fvar<T> z) {
+  grad_inc_beta(g1, g2, a, b, z, beta(a, b) * inc_beta(a, b, z));
 }
 
 }  // namespace math
@@ -21,11 +21,12 @@ inline fvar<T> inc_beta(const fvar<T>& a, const fvar<T>& b, const fvar<T>& x) {
   T d_a;
   T d_b;
   const T beta_ab = beta(a.val_, b.val_);
+  const T inc_beta_val = inc_beta(a.val_, b.val_, x.val_);
   grad_reg_inc_beta(d_a, d_b, a.val_, b.val_, x.val_, digamma(a.val_),
-                    digamma(b.val_), digamma(a.val_ + b.val_), beta_ab);
+                    digamma(b.val_), digamma(a.val_ + b.val_), beta_ab,
+                    inc_beta_val);
   T d_x = pow((1 - x.val_), b.val_ - 1) * pow(x.val_, a.val_ - 1) / beta_ab;
-  return fvar<T>(inc_beta(a.val_, b.val_, x.val_),
-                 a.d_ * d_a + b.d_ * d_b + x.d_ * d_x);
+  return fvar<T>(inc_beta_val, a.d_ * d_a + b.d_ * d_b + x.d_ * d_x);
 }
 
 template <typename T>
@@ -12,6 +12,21 @@ template <typename T>
 inline fvar<T> inv(const fvar<T>& x) {
   return fvar<T>(1 / x.val_, -x.d_ / square(x.val_));
 }
+
+/**
+ * Return the inverse of the specified argument, propagating all of
+ * its tangent directions.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param x argument
+ * @return inverse of the argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> inv(const fvar_vec<T, N>& x) {
+  return fvar_vec<T, N>(1 / x.val_, x.d_ * (-1 / square(x.val_)));
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
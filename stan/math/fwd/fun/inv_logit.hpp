@@ -24,6 +24,21 @@ inline fvar<T> inv_logit(const fvar<T>& x) {
                  x.d_ * inv_logit(x.val_) * (1 - inv_logit(x.val_)));
 }
 
+/**
+ * Return the inverse logit of the specified argument, propagating all of
+ * its tangent directions.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param x argument
+ * @return inverse logit of the argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> inv_logit(const fvar_vec<T, N>& x) {
+  T u = inv_logit(x.val_);
+  return fvar_vec<T, N>(u, x.d_ * (u * (1 - u)));
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -22,6 +22,20 @@ inline fvar<T> lgamma(const fvar<T>& x) {
   return fvar<T>(lgamma(x.val_), x.d_ * digamma(x.val_));
 }
 
+/**
+ * Return the log gamma function of the specified argument, propagating all of
+ * its tangent directions.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param x argument
+ * @return log gamma function of the argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> lgamma(const fvar_vec<T, N>& x) {
+  return fvar_vec<T, N>(lgamma(x.val_), x.d_ * digamma(x.val_));
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -33,6 +33,26 @@ inline std::complex<fvar<T>> log(const std::complex<fvar<T>>& z) {
   return internal::complex_log(z);
 }
 
+/**
+ * Return the natural logarithm of the specified argument, propagating all of
+ * its tangent directions.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param x argument
+ * @return natural logarithm of the argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> log(const fvar_vec<T, N>& x) {
+  using std::log;
+  if (x.val_ < 0.0) {
+    return fvar_vec<T, N>(
+        NOT_A_NUMBER,
+        fvar_vec<T, N>::tangent_type::Constant(T(NOT_A_NUMBER)));
+  }
+  return fvar_vec<T, N>(log(x.val_), x.d_ / x.val_);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
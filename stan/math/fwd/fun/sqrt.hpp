@@ -31,6 +31,22 @@ inline std::complex<fvar<T>> sqrt(const std::complex<fvar<T>>& z) {
   return internal::complex_sqrt(z);
 }
 
+/**
+ * Return the square root of the specified argument, propagating all of
+ * its tangent directions.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param x argument
+ * @return square root of the argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> sqrt(const fvar_vec<T, N>& x) {
+  using std::sqrt;
+  T u = sqrt(x.val_);
+  return fvar_vec<T, N>(u, x.d_ * (0.5 / u));
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -12,6 +12,21 @@ template <typename T>
 inline fvar<T> square(const fvar<T>& x) {
   return fvar<T>(square(x.val_), x.d_ * 2 * x.val_);
 }
+
+/**
+ * Return the square of the specified argument, propagating all of
+ * its tangent directions.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param x argument
+ * @return square of the argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> square(const fvar_vec<T, N>& x) {
+  return fvar_vec<T, N>(square(x.val_), x.d_ * (2.0 * x.val_));
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
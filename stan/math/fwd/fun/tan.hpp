@@ -28,6 +28,22 @@ inline std::complex<fvar<T>> tan(const std::complex<fvar<T>>& z) {
   return stan::math::internal::complex_tan(z);
 }
 
+/**
+ * Return the tangent of the specified argument, propagating all of
+ * its tangent directions.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param x argument
+ * @return tangent of the argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> tan(const fvar_vec<T, N>& x) {
+  using std::cos;
+  using std::tan;
+  return fvar_vec<T, N>(tan(x.val_), x.d_ / (cos(x.val_) * cos(x.val_)));
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
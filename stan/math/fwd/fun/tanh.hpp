@@ -30,6 +30,22 @@ inline std::complex<fvar<T>> tanh(const std::complex<fvar<T>>& z) {
   return stan::math::internal::complex_tanh(z);
 }
 
+/**
+ * Return the hyperbolic tangent of the specified argument, propagating all of
+ * its tangent directions.
+ *
+ * @tparam T value and tangent type
+ * @tparam N number of tangent directions
+ * @param x argument
+ * @return hyperbolic tangent of the argument
+ */
+template <typename T, int N>
+inline fvar_vec<T, N> tanh(const fvar_vec<T, N>& x) {
+  using std::tanh;
+  T u = tanh(x.val_);
+  return fvar_vec<T, N>(u, x.d_ * (1 - u * u));
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
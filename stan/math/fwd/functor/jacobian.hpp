@@ -3,6 +3,7 @@
 
 #include <stan/math/fwd/core.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
 
 namespace stan {
 namespace math {
@@ -32,6 +33,74 @@ void jacobian(const F& f, const Eigen::Matrix<T, Eigen::Dynamic, 1>& x,
   }
 }
 
+/**
+ * Calculate the value and the Jacobian of the specified function at the
+ * specified argument with vector mode forward automatic differentiation.
+ *
+ * The columns of the Jacobian are computed in chunks of `N` directions:
+ * the function is evaluated once per chunk on `fvar_vec<T, N>` arguments,
+ * so the primal values are computed `ceil(x.size() / N)` times instead
+ * of once per column. The functor must implement
+ *
+ * <code>
+ * Eigen::Matrix\<fvar_vec\<T, N\>, Eigen::Dynamic, 1\>
+ * operator()(const Eigen::Matrix\<fvar_vec\<T, N\>, Eigen::Dynamic, 1\>&)
+ * </code>
+ *
+ * using only operations that are defined for `fvar_vec`.
+ *
+ * @tparam N number of tangent directions propagated per evaluation
+ * @tparam T type of the argument and the results
+ * @tparam F type of function
+ * @param[in] f function
+ * @param[in] x argument to function
+ * @param[out] fx function applied to argument
+ * @param[out] J Jacobian of function at argument
+ */
+template <int N, typename T, typename F>
+void jacobian(const F& f, const Eigen::Matrix<T, Eigen::Dynamic, 1>& x,
+              Eigen::Matrix<T, Eigen::Dynamic, 1>& fx,
+              Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>& J) {
+  using Eigen::Dynamic;
+  using Eigen::Matrix;
+  using fvar_t = fvar_vec<T, N>;
+  Matrix<fvar_t, Dynamic, 1> x_fvar(x.size());
+  for (int k = 0; k < x.size(); ++k) {
+    x_fvar(k) = fvar_t(x(k));
+  }
+  if (x.size() == 0) {
+    Matrix<fvar_t, Dynamic, 1> fx_fvar = f(x_fvar);
+    fx.resize(fx_fvar.size());
+    for (int k = 0; k < fx_fvar.size(); ++k) {
+      fx(k) = fx_fvar(k).val_;
+    }
+    J.resize(fx_fvar.size(), 0);
+    return;
+  }
+  for (int start = 0; start < x.size(); start += N) {
+    const int width = std::min(N, static_cast<int>(x.size()) - start);
+    for (int k = 0; k < width; ++k) {
+      x_fvar(start + k) = seed_fvar_vec<T, N>(x(start + k), k);
+    }
+    Matrix<fvar_t, Dynamic, 1> fx_fvar = f(x_fvar);
+    if (start == 0) {
+      fx.resize(fx_fvar.size());
+      J.resize(fx_fvar.size(), x.size());
+      for (int m = 0; m < fx_fvar.size(); ++m) {
+        fx(m) = fx_fvar(m).val_;
+      }
+    }
+    for (int m = 0; m < fx_fvar.size(); ++m) {
+      for (int k = 0; k < width; ++k) {
+        J(m, start + k) = fx_fvar(m).d_.coeff(k);
+      }
+    }
+    for (int k = 0; k < width; ++k) {
+      x_fvar(start + k) = fvar_t(x(start + k));
+    }
+  }
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -265,6 +265,23 @@ class stack_alloc {
     return sum;
   }
 
+  /**
+   * Return the number of bytes of the blocks before the next location
+   * of the stack. This is the number of bytes allocated through calls to
+   * memalloc_ plus the space wasted at the end of the full blocks, so the
+   * difference of two calls is the memory used by the allocations made
+   * in between.
+   *
+   * @return number of bytes in use
+   */
+  inline size_t bytes_used() const {
+    size_t sum = next_loc_ - blocks_[cur_block_];
+    for (size_t i = 0; i < cur_block_; ++i) {
+      sum += sizes_[i];
+    }
+    return sum;
+  }
+
   /**
    * Indicates whether the memory in the pointer
    * is in the stack.
@@ -0,0 +1,276 @@
+#ifndef STAN_MATH_MIX_FUNCTOR_SPARSE_HESSIAN_HPP
+#define STAN_MATH_MIX_FUNCTOR_SPARSE_HESSIAN_HPP
+
+#include <stan/math/fwd/core.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/mix/functor/hessian.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Return the adjacency lists of the symmetric graph whose edges are the
+ * off-diagonal nonzeros of the specified pattern and of its transpose.
+ *
+ * @param pattern square sparsity pattern
+ * @return sorted neighbours of every vertex, excluding the vertex itself
+ */
+inline std::vector<std::vector<int>> hessian_adjacency(
+    const Eigen::SparseMatrix<double>& pattern) {
+  std::vector<std::vector<int>> adj(pattern.cols());
+  for (int j = 0; j < pattern.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<double>::InnerIterator it(pattern, j); it; ++it) {
+      const int i = it.row();
+      if (i != j) {
+        adj[i].push_back(j);
+        adj[j].push_back(i);
+      }
+    }
+  }
+  for (auto& nbrs : adj) {
+    std::sort(nbrs.begin(), nbrs.end());
+    nbrs.erase(std::unique(nbrs.begin(), nbrs.end()), nbrs.end());
+  }
+  return adj;
+}
+
+/**
+ * Return a star coloring of the specified graph computed greedily.
+ *
+ * A star coloring is a distance-1 coloring in which every path on four
+ * vertices uses at least three colors. Every vertex gets the smallest
+ * color that neither a neighbour has nor closes a two-colored path on
+ * four vertices with the vertices colored so far. For the symmetric
+ * sparsity pattern of a Hessian this allows every nonzero to be read
+ * directly from one of the Hessian-vector products with the color
+ * indicator vectors.
+ *
+ * @param adj sorted adjacency lists of the graph
+ * @return color of each vertex, numbered from zero
+ */
+inline std::vector<int> star_coloring(
+    const std::vector<std::vector<int>>& adj) {
+  const int n = adj.size();
+  std::vector<int> color(n, -1);
+  std::vector<int> forbidden(n, -1);
+  for (int v = 0; v < n; ++v) {
+    for (int w : adj[v]) {
+      if (color[w] >= 0) {
+        forbidden[color[w]] = v;
+      }
+    }
+    for (int w : adj[v]) {
+      if (color[w] < 0) {
+        continue;
+      }
+      for (int x : adj[w]) {
+        if (x == v || color[x] < 0) {
+          continue;
+        }
+        // v - w - x - y would be colored (c, a, c, a)
+        for (int y : adj[x]) {
+          if (y != w && color[y] == color[w]) {
+            forbidden[color[x]] = v;
+            break;
+          }
+        }
+        // x - w - v - u would be colored (c, a, c, a) for a neighbour u
+        // of v colored like w
+        for (int u : adj[v]) {
+          if (u != w && color[u] == color[w]) {
+            forbidden[color[x]] = v;
+            break;
+          }
+        }
+      }
+    }
+    int c = 0;
+    while (forbidden[c] == v) {
+      ++c;
+    }
+    color[v] = c;
+  }
+  return color;
+}
+}  // namespace internal
+
+/**
+ * Return the sparsity pattern of the Hessian of the specified function,
+ * detected from the dense Hessian at the specified argument.
+ *
+ * The tape does not record which operands each node depends on, so the
+ * pattern is found numerically. The argument should be a generic point
+ * at which no entry of the Hessian that is structurally nonzero vanishes
+ * by accident. The pattern only needs to be computed once and can then
+ * be reused by `sparse_hessian()` at any argument.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @return symmetric pattern with value one at every nonzero of the
+ * Hessian and on the diagonal
+ */
+template <typename F>
+Eigen::SparseMatrix<double> hessian_sparsity_pattern(
+    const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x) {
+  double fx;
+  Eigen::Matrix<double, Eigen::Dynamic, 1> grad;
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> H;
+  hessian(f, x, fx, grad, H);
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int j = 0; j < x.size(); ++j) {
+    for (int i = 0; i < x.size(); ++i) {
+      if (i == j || H(i, j) != 0.0 || H(j, i) != 0.0) {
+        triplets.emplace_back(i, j, 1.0);
+      }
+    }
+  }
+  Eigen::SparseMatrix<double> pattern(x.size(), x.size());
+  pattern.setFromTriplets(triplets.begin(), triplets.end());
+  return pattern;
+}
+
+/**
+ * Calculate the value, the gradient, and the sparse Hessian of the
+ * specified function at the specified argument, given the sparsity
+ * pattern of the Hessian.
+ *
+ * The columns of the Hessian are star colored from the pattern, and
+ * one forward-over-reverse pass is made per color with the tangent set
+ * to the indicator vector of that color. Every nonzero is then read off
+ * one of the resulting Hessian-vector products, using symmetry where
+ * needed. For block sparse or hierarchical problems the number of colors,
+ * and so the number of passes, is a small constant instead of the
+ * dimension of the argument.
+ *
+ * <p>The functor must implement
+ *
+ * <code>
+ * fvar\<var\>
+ * operator()(const
+ * Eigen::Matrix\<fvar\<var\>, Eigen::Dynamic, 1\>&)
+ * </code>
+ *
+ * using only operations that are defined for
+ * <code>fvar</code> and <code>var</code>.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[in] pattern sparsity pattern of the Hessian; only its structure is
+ * used and it is symmetrized with its transpose
+ * @param[out] fx Function applied to argument
+ * @param[out] grad gradient of function at argument
+ * @param[out] H Hessian of function at argument, with the symmetrized
+ * pattern and the diagonal as structure
+ * @throw std::invalid_argument if the pattern is not square with as many
+ * rows as the argument has elements
+ */
+template <typename F>
+void sparse_hessian(const F& f,
+                    const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+                    const Eigen::SparseMatrix<double>& pattern, double& fx,
+                    Eigen::Matrix<double, Eigen::Dynamic, 1>& grad,
+                    Eigen::SparseMatrix<double>& H) {
+  check_size_match("sparse_hessian", "rows of pattern", pattern.rows(),
+                   "size of x", x.size());
+  check_size_match("sparse_hessian", "columns of pattern", pattern.cols(),
+                   "size of x", x.size());
+  const int n = x.size();
+  grad.resize(n);
+  H.resize(n, n);
+  if (n == 0) {
+    fx = f(x);
+    return;
+  }
+
+  const std::vector<std::vector<int>> adj
+      = internal::hessian_adjacency(pattern);
+  const std::vector<int> color = internal::star_coloring(adj);
+  const int num_colors = *std::max_element(color.begin(), color.end()) + 1;
+
+  // column k holds the product of the Hessian with the indicator of color k
+  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> HS(n, num_colors);
+  for (int k = 0; k < num_colors; ++k) {
+    // Run nested autodiff in this scope
+    nested_rev_autodiff nested;
+
+    Eigen::Matrix<fvar<var>, Eigen::Dynamic, 1> x_fvar(n);
+    for (int j = 0; j < n; ++j) {
+      x_fvar(j) = fvar<var>(x(j), color[j] == k);
+    }
+    fvar<var> fx_fvar = f(x_fvar);
+    stan::math::grad(fx_fvar.d_.vi_);
+    for (int j = 0; j < n; ++j) {
+      HS(j, k) = x_fvar(j).val_.adj();
+    }
+    if (k == 0) {
+      fx = fx_fvar.val_.val();
+      set_zero_all_adjoints_nested();
+      stan::math::grad(fx_fvar.val_.vi_);
+      for (int j = 0; j < n; ++j) {
+        grad(j) = x_fvar(j).val_.adj();
+      }
+    }
+  }
+
+  // H(i, j) is the only term of color(j) in row i of HS, unless another
+  // neighbour of i shares that color; the star coloring then guarantees
+  // that H(j, i) is the only term of color(i) in row j
+  std::vector<int> owner(num_colors, -1);
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int i = 0; i < n; ++i) {
+    triplets.emplace_back(i, i, HS(i, color[i]));
+    std::fill(owner.begin(), owner.end(), -1);
+    for (int j : adj[i]) {
+      owner[color[j]] = owner[color[j]] == -1 ? j : -2;
+    }
+    for (int j : adj[i]) {
+      if (owner[color[j]] == j) {
+        triplets.emplace_back(i, j, HS(i, color[j]));
+        continue;
+      }
+      const bool unique_in_row_j
+          = std::none_of(adj[j].begin(), adj[j].end(), [&](int l) {
+              return l != i && color[l] == color[i];
+            });
+      if (!unique_in_row_j) {
+        throw_domain_error("sparse_hessian", "coloring", i,
+                           "does not separate the pattern at row ");
+      }
+      triplets.emplace_back(i, j, HS(j, color[i]));
+    }
+  }
+  H.setFromTriplets(triplets.begin(), triplets.end());
+}
+
+/**
+ * Calculate the value, the gradient, and the sparse Hessian of the
+ * specified function at the specified argument. The sparsity pattern is
+ * detected at the argument with `hessian_sparsity_pattern()`; when the
+ * Hessian is needed at several arguments, compute the pattern once and
+ * call the overload taking it instead.
+ *
+ * @tparam F Type of function
+ * @param[in] f Function
+ * @param[in] x Argument to function
+ * @param[out] fx Function applied to argument
+ * @param[out] grad gradient of function at argument
+ * @param[out] H Hessian of function at argument
+ */
+template <typename F>
+void sparse_hessian(const F& f,
+                    const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
+                    double& fx, Eigen::Matrix<double, Eigen::Dynamic, 1>& grad,
+                    Eigen::SparseMatrix<double>& H) {
+  sparse_hessian(f, x, hessian_sparsity_pattern(f, x), fx, grad, H);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -108,7 +108,8 @@ inline void check_finite(const char* function, const char* name,
  * @param y matrix to test
  * @return <code>true</code> if the matrix is finite
  **/
-template <typename Mat, require_matrix_t<Mat>* = nullptr>
+template <typename Mat, require_matrix_t<Mat>* = nullptr,
+          require_not_eigen_sparse_base_t<Mat>* = nullptr>
 inline void check_finite(const char* function, const char* name, const Mat& y) {
   if (!value_of(y).allFinite()) {
     for (int n = 0; n < y.size(); ++n) {
@@ -120,6 +121,30 @@ inline void check_finite(const char* function, const char* name, const Mat& y) {
   }
 }
 
+/**
+ * Check if the nonzero elements of the specified sparse matrix are finite.
+ *
+ * @tparam EigSparse type of the sparse matrix
+ * @param function name of function (for error messages)
+ * @param name variable name (for error messages)
+ * @param y sparse matrix to test
+ * @throw <code>domain_error</code> if any nonzero element of the matrix is
+ * not finite
+ */
+template <typename EigSparse,
+          require_eigen_sparse_base_t<EigSparse>* = nullptr>
+inline void check_finite(const char* function, const char* name,
+                         const EigSparse& y) {
+  for (int k = 0; k < y.outerSize(); ++k) {
+    for (typename EigSparse::InnerIterator it(y, k); it; ++it) {
+      if (!std::isfinite(value_of_rec(it.value()))) {
+        throw_domain_error(function, name, value_of_rec(it.value()), "is ",
+                           ", but must be finite!");
+      }
+    }
+  }
+}
+
 /**
  * Return <code>true</code> if all values in the std::vector are finite.
  *
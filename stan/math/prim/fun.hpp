@@ -20,6 +20,7 @@
 #include <stan/math/prim/fun/atanh.hpp>
 #include <stan/math/prim/fun/autocorrelation.hpp>
 #include <stan/math/prim/fun/autocovariance.hpp>
+#include <stan/math/prim/fun/batched_matrix_ops.hpp>
 #include <stan/math/prim/fun/bessel_first_kind.hpp>
 #include <stan/math/prim/fun/bessel_second_kind.hpp>
 #include <stan/math/prim/fun/beta.hpp>
@@ -101,11 +102,15 @@
 #include <stan/math/prim/fun/fmin.hpp>
 #include <stan/math/prim/fun/fmod.hpp>
 #include <stan/math/prim/fun/gamma_p.hpp>
+#include <stan/math/prim/fun/gamma_p_dd.hpp>
 #include <stan/math/prim/fun/gamma_q.hpp>
+#include <stan/math/prim/fun/gamma_q_dd.hpp>
 #include <stan/math/prim/fun/get.hpp>
 #include <stan/math/prim/fun/get_base1.hpp>
 #include <stan/math/prim/fun/get_base1_lhs.hpp>
 #include <stan/math/prim/fun/get_lp.hpp>
+#include <stan/math/prim/fun/glm_design_matrix.hpp>
+#include <stan/math/prim/fun/gp_cov_operator.hpp>
 #include <stan/math/prim/fun/gp_dot_prod_cov.hpp>
 #include <stan/math/prim/fun/gp_exponential_cov.hpp>
 #include <stan/math/prim/fun/gp_matern32_cov.hpp>
@@ -230,6 +235,7 @@
 #include <stan/math/prim/fun/ordered_constrain.hpp>
 #include <stan/math/prim/fun/ordered_free.hpp>
 #include <stan/math/prim/fun/owens_t.hpp>
+#include <stan/math/prim/fun/parallel_cholesky.hpp>
 #include <stan/math/prim/fun/Phi.hpp>
 #include <stan/math/prim/fun/Phi_approx.hpp>
 #include <stan/math/prim/fun/plus.hpp>
@@ -295,6 +301,7 @@
 #include <stan/math/prim/fun/sort_indices.hpp>
 #include <stan/math/prim/fun/sort_indices_asc.hpp>
 #include <stan/math/prim/fun/sort_indices_desc.hpp>
+#include <stan/math/prim/fun/spectral_decomposition.hpp>
 #include <stan/math/prim/fun/sqrt.hpp>
 #include <stan/math/prim/fun/square.hpp>
 #include <stan/math/prim/fun/squared_distance.hpp>
@@ -304,6 +311,8 @@
 #include <stan/math/prim/fun/sub_row.hpp>
 #include <stan/math/prim/fun/subtract.hpp>
 #include <stan/math/prim/fun/sum.hpp>
+#include <stan/math/prim/fun/svd_U.hpp>
+#include <stan/math/prim/fun/svd_V.hpp>
 #include <stan/math/prim/fun/tail.hpp>
 #include <stan/math/prim/fun/tan.hpp>
 #include <stan/math/prim/fun/tanh.hpp>
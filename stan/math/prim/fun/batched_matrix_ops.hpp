@@ -0,0 +1,296 @@
+#ifndef STAN_MATH_PRIM_FUN_BATCHED_MATRIX_OPS_HPP
+#define STAN_MATH_PRIM_FUN_BATCHED_MATRIX_OPS_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Check that all matrices of a batch have the same size as the first.
+ *
+ * @tparam EigMat type of the matrices
+ * @param function name of the calling function
+ * @param name name of the batch
+ * @param xs batch of matrices
+ * @throw std::invalid_argument if the sizes differ
+ */
+template <typename EigMat, require_eigen_t<EigMat>* = nullptr>
+inline void check_batch_sizes(const char* function, const char* name,
+                              const std::vector<EigMat>& xs) {
+  for (size_t k = 1; k < xs.size(); ++k) {
+    check_size_match(function, "Rows of first matrix", xs[0].rows(), name,
+                     xs[k].rows());
+    check_size_match(function, "Columns of first matrix", xs[0].cols(), name,
+                     xs[k].cols());
+  }
+}
+
+/**
+ * Copy a batch of equally sized matrices into a matrix with one row per
+ * matrix of the batch. Column `i + j * rows` holds element `(i, j)` of
+ * all matrices, so that the batched kernels below operate on contiguous
+ * columns and vectorize across the matrices of the batch.
+ *
+ * @tparam EigMat type of the matrices
+ * @param xs batch of matrices
+ * @return batch layout of the matrices
+ */
+template <typename EigMat, require_eigen_t<EigMat>* = nullptr>
+inline Eigen::Matrix<value_type_t<EigMat>, Eigen::Dynamic, Eigen::Dynamic>
+to_batch(const std::vector<EigMat>& xs) {
+  const Eigen::Index size = xs.empty() ? 0 : xs[0].size();
+  Eigen::Matrix<value_type_t<EigMat>, Eigen::Dynamic, Eigen::Dynamic> batch(
+      xs.size(), size);
+  for (size_t k = 0; k < xs.size(); ++k) {
+    const auto& x_ref = to_ref(xs[k]);
+    for (Eigen::Index j = 0; j < x_ref.cols(); ++j) {
+      for (Eigen::Index i = 0; i < x_ref.rows(); ++i) {
+        batch.coeffRef(k, i + j * x_ref.rows()) = x_ref.coeff(i, j);
+      }
+    }
+  }
+  return batch;
+}
+
+/**
+ * Copy a matrix in batch layout back to a batch of matrices.
+ *
+ * @tparam Ret type of the returned matrices
+ * @tparam Batch type of the matrix in batch layout
+ * @param batch matrix with one row per matrix of the batch
+ * @param rows number of rows of each matrix
+ * @param cols number of columns of each matrix
+ * @return batch of matrices
+ */
+template <typename Ret, typename Batch>
+inline std::vector<Ret> from_batch(const Batch& batch, Eigen::Index rows,
+                                   Eigen::Index cols) {
+  std::vector<Ret> xs(batch.rows());
+  for (Eigen::Index k = 0; k < batch.rows(); ++k) {
+    xs[k].resize(rows, cols);
+    for (Eigen::Index j = 0; j < cols; ++j) {
+      for (Eigen::Index i = 0; i < rows; ++i) {
+        xs[k].coeffRef(i, j) = batch.coeff(k, i + j * rows);
+      }
+    }
+  }
+  return xs;
+}
+
+/**
+ * Compute the lower Cholesky factors of a batch of `n x n` matrices in
+ * batch layout. Only the lower triangles are read and the strictly upper
+ * triangles of the factors are set to zero.
+ *
+ * @param A batch of symmetric matrices
+ * @param n number of rows of each matrix
+ * @param[out] L batch of Cholesky factors
+ * @return index of the first matrix that is not positive definite, or
+ * -1 if all are
+ */
+inline Eigen::Index batch_cholesky(const Eigen::Ref<const Eigen::MatrixXd>& A,
+                                   Eigen::Index n,
+                                   Eigen::Ref<Eigen::MatrixXd> L) {
+  L.setZero();
+  for (Eigen::Index j = 0; j < n; ++j) {
+    auto L_jj = L.col(j + j * n);
+    L_jj = A.col(j + j * n);
+    for (Eigen::Index k = 0; k < j; ++k) {
+      L_jj -= L.col(j + k * n).cwiseAbs2();
+    }
+    for (Eigen::Index b = 0; b < L.rows(); ++b) {
+      if (!(L_jj.coeff(b) > 0)) {
+        return b;
+      }
+    }
+    L_jj = L_jj.cwiseSqrt();
+    for (Eigen::Index i = j + 1; i < n; ++i) {
+      auto L_ij = L.col(i + j * n);
+      L_ij = A.col(i + j * n);
+      for (Eigen::Index k = 0; k < j; ++k) {
+        L_ij -= L.col(i + k * n).cwiseProduct(L.col(j + k * n));
+      }
+      L_ij.array() /= L_jj.array();
+    }
+  }
+  return -1;
+}
+
+/**
+ * Add the adjoints of a batch of symmetric matrices to `A_adj` given the
+ * adjoints of their Cholesky factors, by reversing the steps of
+ * `batch_cholesky()`. Only the lower triangles are read and written.
+ *
+ * @param L batch of Cholesky factors
+ * @param L_adj batch of adjoints of the Cholesky factors
+ * @param n number of rows of each matrix
+ * @param[in,out] A_adj batch of adjoints of the matrices
+ */
+inline void batch_cholesky_adjoint(
+    const Eigen::Ref<const Eigen::MatrixXd>& L,
+    const Eigen::Ref<const Eigen::MatrixXd>& L_adj, Eigen::Index n,
+    Eigen::Ref<Eigen::MatrixXd> A_adj) {
+  Eigen::MatrixXd L_bar = L_adj;
+  Eigen::VectorXd t(L.rows());
+  for (Eigen::Index j = n - 1; j >= 0; --j) {
+    const auto L_jj = L.col(j + j * n);
+    for (Eigen::Index i = n - 1; i > j; --i) {
+      t = L_bar.col(i + j * n).cwiseQuotient(L_jj);
+      A_adj.col(i + j * n) += t;
+      L_bar.col(j + j * n) -= t.cwiseProduct(L.col(i + j * n));
+      for (Eigen::Index k = 0; k < j; ++k) {
+        L_bar.col(i + k * n) -= t.cwiseProduct(L.col(j + k * n));
+        L_bar.col(j + k * n) -= t.cwiseProduct(L.col(i + k * n));
+      }
+    }
+    t = 0.5 * L_bar.col(j + j * n).cwiseQuotient(L_jj);
+    A_adj.col(j + j * n) += t;
+    for (Eigen::Index k = 0; k < j; ++k) {
+      L_bar.col(j + k * n) -= 2 * t.cwiseProduct(L.col(j + k * n));
+    }
+  }
+}
+
+/**
+ * Multiply a batch of `m x p` matrices by a batch of `p x q` matrices,
+ * both in batch layout.
+ *
+ * @param A batch of left factors
+ * @param B batch of right factors
+ * @param m number of rows of the left factors
+ * @param p number of columns of the left factors
+ * @param q number of columns of the right factors
+ * @param[out] C batch of products
+ */
+inline void batch_multiply(const Eigen::Ref<const Eigen::MatrixXd>& A,
+                           const Eigen::Ref<const Eigen::MatrixXd>& B,
+                           Eigen::Index m, Eigen::Index p, Eigen::Index q,
+                           Eigen::Ref<Eigen::MatrixXd> C) {
+  C.setZero();
+  for (Eigen::Index j = 0; j < q; ++j) {
+    for (Eigen::Index l = 0; l < p; ++l) {
+      const auto B_lj = B.col(l + j * p);
+      for (Eigen::Index i = 0; i < m; ++i) {
+        C.col(i + j * m) += A.col(i + l * m).cwiseProduct(B_lj);
+      }
+    }
+  }
+}
+
+/**
+ * Add the adjoints of the factors of a batch of products computed by
+ * `batch_multiply()` to `A_adj` and `B_adj`. Either of them may be empty,
+ * in which case it is skipped.
+ *
+ * @param A batch of left factors
+ * @param B batch of right factors
+ * @param C_adj batch of adjoints of the products
+ * @param m number of rows of the left factors
+ * @param p number of columns of the left factors
+ * @param q number of columns of the right factors
+ * @param[in,out] A_adj batch of adjoints of the left factors
+ * @param[in,out] B_adj batch of adjoints of the right factors
+ */
+inline void batch_multiply_adjoint(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& C_adj, Eigen::Index m,
+    Eigen::Index p, Eigen::Index q, Eigen::Ref<Eigen::MatrixXd> A_adj,
+    Eigen::Ref<Eigen::MatrixXd> B_adj) {
+  for (Eigen::Index j = 0; j < q; ++j) {
+    for (Eigen::Index l = 0; l < p; ++l) {
+      for (Eigen::Index i = 0; i < m; ++i) {
+        const auto C_adj_ij = C_adj.col(i + j * m);
+        if (A_adj.size() > 0) {
+          A_adj.col(i + l * m) += C_adj_ij.cwiseProduct(B.col(l + j * p));
+        }
+        if (B_adj.size() > 0) {
+          B_adj.col(l + j * p) += C_adj_ij.cwiseProduct(A.col(i + l * m));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Solve a batch of lower triangular systems `L * X = B` in batch layout
+ * by forward substitution.
+ *
+ * @param L batch of `n x n` lower triangular matrices
+ * @param B batch of `n x q` right-hand sides
+ * @param n number of rows of each system
+ * @param q number of right-hand side columns of each system
+ * @param[out] X batch of solutions
+ */
+inline void batch_tri_low_solve(const Eigen::Ref<const Eigen::MatrixXd>& L,
+                                const Eigen::Ref<const Eigen::MatrixXd>& B,
+                                Eigen::Index n, Eigen::Index q,
+                                Eigen::Ref<Eigen::MatrixXd> X) {
+  for (Eigen::Index c = 0; c < q; ++c) {
+    for (Eigen::Index i = 0; i < n; ++i) {
+      auto X_ic = X.col(i + c * n);
+      X_ic = B.col(i + c * n);
+      for (Eigen::Index k = 0; k < i; ++k) {
+        X_ic -= L.col(i + k * n).cwiseProduct(X.col(k + c * n));
+      }
+      X_ic.array() /= L.col(i + i * n).array();
+    }
+  }
+}
+
+/**
+ * Add the adjoints of the operands of a batch of lower triangular solves
+ * computed by `batch_tri_low_solve()` to `L_adj` and `B_adj`. Either of
+ * them may be empty, in which case it is skipped.
+ *
+ * @param L batch of lower triangular matrices
+ * @param X batch of solutions
+ * @param X_adj batch of adjoints of the solutions
+ * @param n number of rows of each system
+ * @param q number of right-hand side columns of each system
+ * @param[in,out] L_adj batch of adjoints of the triangular matrices
+ * @param[in,out] B_adj batch of adjoints of the right-hand sides
+ */
+inline void batch_tri_low_solve_adjoint(
+    const Eigen::Ref<const Eigen::MatrixXd>& L,
+    const Eigen::Ref<const Eigen::MatrixXd>& X,
+    const Eigen::Ref<const Eigen::MatrixXd>& X_adj, Eigen::Index n,
+    Eigen::Index q, Eigen::Ref<Eigen::MatrixXd> L_adj,
+    Eigen::Ref<Eigen::MatrixXd> B_adj) {
+  // adjoint of the right-hand side by back substitution with L^T
+  Eigen::MatrixXd B_bar(X.rows(), X.cols());
+  for (Eigen::Index c = 0; c < q; ++c) {
+    for (Eigen::Index i = n - 1; i >= 0; --i) {
+      auto B_bar_ic = B_bar.col(i + c * n);
+      B_bar_ic = X_adj.col(i + c * n);
+      for (Eigen::Index k = i + 1; k < n; ++k) {
+        B_bar_ic -= L.col(k + i * n).cwiseProduct(B_bar.col(k + c * n));
+      }
+      B_bar_ic.array() /= L.col(i + i * n).array();
+    }
+  }
+  if (L_adj.size() > 0) {
+    for (Eigen::Index c = 0; c < q; ++c) {
+      for (Eigen::Index k = 0; k < n; ++k) {
+        const auto X_kc = X.col(k + c * n);
+        for (Eigen::Index i = k; i < n; ++i) {
+          L_adj.col(i + k * n) -= B_bar.col(i + c * n).cwiseProduct(X_kc);
+        }
+      }
+    }
+  }
+  if (B_adj.size() > 0) {
+    B_adj += B_bar;
+  }
+}
+}  // namespace internal
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -12,7 +12,8 @@
 namespace stan {
 namespace math {
 
-template <typename EigVec, require_eigen_col_vector_t<EigVec>* = nullptr>
+template <typename EigVec, require_eigen_col_vector_t<EigVec>* = nullptr,
+          require_not_st_var<EigVec>* = nullptr>
 Eigen::Matrix<value_type_t<EigVec>, Eigen::Dynamic, Eigen::Dynamic>
 cholesky_corr_constrain(const EigVec& y, int K) {
   using Eigen::Dynamic;
@@ -43,7 +44,8 @@ cholesky_corr_constrain(const EigVec& y, int K) {
 }
 
 // FIXME to match above after debugged
-template <typename EigVec, require_eigen_vector_t<EigVec>* = nullptr>
+template <typename EigVec, require_eigen_vector_t<EigVec>* = nullptr,
+          require_not_st_var<EigVec>* = nullptr>
 Eigen::Matrix<value_type_t<EigVec>, Eigen::Dynamic, Eigen::Dynamic>
 cholesky_corr_constrain(const EigVec& y, int K, value_type_t<EigVec>& lp) {
   using Eigen::Dynamic;
@@ -4,11 +4,14 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/batched_matrix_ops.hpp>
+#include <stan/math/prim/fun/parallel_cholesky.hpp>
 #ifdef STAN_OPENCL
 #include <stan/math/opencl/opencl.hpp>
 #endif
 
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -54,6 +57,8 @@ cholesky_decompose(const EigMat& m) {
  *
  * @tparam EigMat type of the matrix (must be derived from \c Eigen::MatrixBase)
  * @param m Symmetric matrix.
+ * @param opts tuning parameters of the blocked algorithm used for large
+ * matrices, see `cholesky_tuning`
  * @return Square root of matrix.
  * @note Because OpenCL only works on doubles there are two
  * <code>cholesky_decompose</code> functions. One that works on doubles
@@ -65,29 +70,76 @@ template <typename EigMat, require_eigen_t<EigMat>* = nullptr,
           require_vt_same<double, EigMat>* = nullptr>
 inline Eigen::Matrix<double, EigMat::RowsAtCompileTime,
                      EigMat::ColsAtCompileTime>
-cholesky_decompose(const EigMat& m) {
+cholesky_decompose(const EigMat& m,
+                   const cholesky_tuning& opts = cholesky_tuning()) {
   const eval_return_type_t<EigMat>& m_eval = m.eval();
   check_not_nan("cholesky_decompose", "m", m_eval);
 #ifdef STAN_OPENCL
   if (m.rows() >= opencl_context.tuning_opts().cholesky_size_worth_transfer) {
     matrix_cl<double> m_cl(m_eval);
     return from_matrix_cl(cholesky_decompose(m_cl));
-  } else {
-    check_symmetric("cholesky_decompose", "m", m_eval);
-    Eigen::LLT<Eigen::Matrix<double, EigMat::RowsAtCompileTime,
-                             EigMat::ColsAtCompileTime>>
-        llt = m_eval.llt();
-    check_pos_definite("cholesky_decompose", "m", llt);
-    return llt.matrixL();
   }
-#else
+#endif
   check_symmetric("cholesky_decompose", "m", m_eval);
+  if (m_eval.rows() >= opts.parallel_size) {
+    Eigen::Matrix<double, EigMat::RowsAtCompileTime, EigMat::ColsAtCompileTime>
+        L = m_eval;
+    if (!internal::cholesky_blocked_in_place(L, opts)) {
+      throw_domain_error("cholesky_decompose", "Matrix",
+                         " is not positive definite", "m");
+    }
+    L.template triangularView<Eigen::StrictlyUpper>().setZero();
+    return L;
+  }
   Eigen::LLT<Eigen::Matrix<double, EigMat::RowsAtCompileTime,
                            EigMat::ColsAtCompileTime>>
       llt = m_eval.llt();
   check_pos_definite("cholesky_decompose", "m", llt);
   return llt.matrixL();
-#endif
+}
+
+/**
+ * Return the lower-triangular Cholesky factors of a batch of square,
+ * symmetric matrices of the same size.
+ *
+ * The matrices are factored together in a single pass over a layout that
+ * stores each element of all matrices contiguously, which avoids the
+ * per-matrix allocations and vectorizes across the batch. This is faster
+ * than factoring each matrix on its own for small matrices.
+ *
+ * @tparam EigMat type of the matrices
+ * @param m batch of symmetric matrices
+ * @return Cholesky factors of the matrices
+ * @throw std::invalid_argument if the matrices are not square or do not
+ *   all have the same size
+ * @throw std::domain_error if a matrix is not symmetric, contains a NaN
+ *   or is not positive definite
+ */
+template <typename EigMat,
+          require_eigen_vt<std::is_arithmetic, EigMat>* = nullptr>
+inline std::vector<Eigen::Matrix<double, EigMat::RowsAtCompileTime,
+                                 EigMat::ColsAtCompileTime>>
+cholesky_decompose(const std::vector<EigMat>& m) {
+  using ret_t = Eigen::Matrix<double, EigMat::RowsAtCompileTime,
+                              EigMat::ColsAtCompileTime>;
+  if (m.empty()) {
+    return {};
+  }
+  internal::check_batch_sizes("cholesky_decompose", "m", m);
+  for (size_t k = 0; k < m.size(); ++k) {
+    check_square("cholesky_decompose", "m", m[k]);
+    check_not_nan("cholesky_decompose", "m", m[k]);
+    check_symmetric("cholesky_decompose", "m", m[k]);
+  }
+  const Eigen::Index n = m[0].rows();
+  const Eigen::MatrixXd A = internal::to_batch(m).template cast<double>();
+  Eigen::MatrixXd L(A.rows(), A.cols());
+  const Eigen::Index failed = internal::batch_cholesky(A, n, L);
+  if (failed >= 0) {
+    throw_domain_error("cholesky_decompose", "Matrix", failed + 1, "number ",
+                       " is not positive definite.");
+  }
+  return internal::from_batch<ret_t>(L, n, n);
 }
 
 }  // namespace math
@@ -25,7 +25,8 @@ namespace math {
  * @param N number of columns
  * @return Cholesky factor
  */
-template <typename T, require_eigen_col_vector_t<T>* = nullptr>
+template <typename T, require_eigen_col_vector_t<T>* = nullptr,
+          require_not_st_var<T>* = nullptr>
 Eigen::Matrix<value_type_t<T>, Eigen::Dynamic, Eigen::Dynamic>
 cholesky_factor_constrain(const T& x, int M, int N) {
   using std::exp;
@@ -70,7 +71,8 @@ cholesky_factor_constrain(const T& x, int M, int N) {
  * @param lp Log probability that is incremented with the log Jacobian
  * @return Cholesky factor
  */
-template <typename T, require_eigen_vector_t<T>* = nullptr>
+template <typename T, require_eigen_vector_t<T>* = nullptr,
+          require_not_st_var<T>* = nullptr>
 Eigen::Matrix<value_type_t<T>, Eigen::Dynamic, Eigen::Dynamic>
 cholesky_factor_constrain(const T& x, int M, int N, value_type_t<T>& lp) {
   check_size_match("cholesky_factor_constrain", "x.size()", x.size(),
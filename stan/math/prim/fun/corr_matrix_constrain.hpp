@@ -36,11 +36,12 @@ namespace math {
  * @throw std::invalid_argument if x is not a valid correlation
  * matrix.
  */
-template <typename T, require_eigen_col_vector_t<T>* = nullptr>
+template <typename T, require_eigen_col_vector_t<T>* = nullptr,
+          require_not_st_var<T>* = nullptr>
 Eigen::Matrix<value_type_t<T>, Eigen::Dynamic, Eigen::Dynamic>
 corr_matrix_constrain(const T& x, Eigen::Index k) {
   Eigen::Index k_choose_2 = (k * (k - 1)) / 2;
-  check_size_match("cov_matrix_constrain", "x.size()", x.size(), "k_choose_2",
+  check_size_match("corr_matrix_constrain", "x.size()", x.size(), "k_choose_2",
                    k_choose_2);
   return read_corr_matrix(corr_constrain(x), k);
 }
@@ -65,11 +66,11 @@ corr_matrix_constrain(const T& x, Eigen::Index k) {
  * @param k Dimensionality of returned correlation matrix.
  * @param lp Log probability reference to increment.
  */
-template <typename T>
+template <typename T, require_not_st_var<T>* = nullptr>
 Eigen::Matrix<value_type_t<T>, Eigen::Dynamic, Eigen::Dynamic>
 corr_matrix_constrain(const T& x, Eigen::Index k, value_type_t<T>& lp) {
   Eigen::Index k_choose_2 = (k * (k - 1)) / 2;
-  check_size_match("cov_matrix_constrain", "x.size()", x.size(), "k_choose_2",
+  check_size_match("corr_matrix_constrain", "x.size()", x.size(), "k_choose_2",
                    k_choose_2);
   return read_corr_matrix(corr_constrain(x, lp), k, lp);
 }
@@ -0,0 +1,61 @@
+#ifndef STAN_MATH_PRIM_FUN_GAMMA_Q_DD_HPP
+#define STAN_MATH_PRIM_FUN_GAMMA_Q_DD_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/gamma_p.hpp>
+#include <stan/math/prim/fun/gamma_q.hpp>
+#include <stan/math/prim/fun/grad_reg_inc_gamma.hpp>
+#include <stan/math/prim/fun/is_any_nan.hpp>
+#include <limits>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the regularized upper incomplete gamma function Q(a, z) and
+ * set `d_a` to its derivative with respect to the shape `a`.
+ *
+ * The expansion for the derivative (see `grad_reg_inc_gamma()`) needs
+ * either P(a, z) or Q(a, z), so the incomplete gamma function is
+ * evaluated once and shared between the value and the derivative. Q(a, z)
+ * is only recomputed from scratch when the series expansion is used and
+ * P(a, z) > 1/2, where 1 - P(a, z) would lose precision.
+ *
+ * @tparam T1 type of the shape parameter
+ * @tparam T2 type of the location parameter
+ * @param a shape parameter, a > 0
+ * @param z location z >= 0
+ * @param g stan::math::tgamma(a) (precomputed value)
+ * @param dig boost::math::digamma(a) (precomputed value)
+ * @param[out] d_a derivative of Q(a, z) with respect to a
+ * @param precision required precision; applies to series expansion only
+ * @param max_steps number of steps to take.
+ * @return Q(a, z)
+ * @throw throws std::domain_error if not converged after max_steps
+ *   or increment overflows to inf.
+ */
+template <typename T1, typename T2>
+return_type_t<T1, T2> gamma_q_dd(const T1& a, const T2& z, const T1& g,
+                                 const T1& dig, return_type_t<T1, T2>& d_a,
+                                 double precision = 1e-6,
+                                 int max_steps = 1e5) {
+  using TP = return_type_t<T1, T2>;
+  if (is_any_nan(a, z, g, dig)) {
+    d_a = std::numeric_limits<TP>::quiet_NaN();
+    return std::numeric_limits<TP>::quiet_NaN();
+  }
+  if (internal::grad_reg_inc_gamma_is_asymptotic(a, z)) {
+    const TP q = gamma_q(a, z);
+    d_a = internal::grad_reg_inc_gamma_impl(a, z, g, dig, q, precision,
+                                            max_steps);
+    return q;
+  }
+  const TP p = gamma_p(a, z);
+  d_a = internal::grad_reg_inc_gamma_impl(a, z, g, dig, p, precision,
+                                          max_steps);
+  return p > 0.5 ? gamma_q(a, z) : 1.0 - p;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
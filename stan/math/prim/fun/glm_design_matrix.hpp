@@ -0,0 +1,316 @@
+#ifndef STAN_MATH_PRIM_FUN_GLM_DESIGN_MATRIX_HPP
+#define STAN_MATH_PRIM_FUN_GLM_DESIGN_MATRIX_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err/check_bounded.hpp>
+#include <stan/math/prim/err/check_size_match.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <type_traits>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+class glm_design_matrix;
+
+namespace internal {
+/**
+ * Lightweight view of the transpose of a `glm_design_matrix`. It only
+ * supports multiplication by a column vector, which is the only operation the
+ * GLM functions need on the transpose.
+ */
+class glm_design_matrix_transpose {
+  const glm_design_matrix& x_;
+
+ public:
+  explicit glm_design_matrix_transpose(const glm_design_matrix& x) : x_(x) {}
+  inline const glm_design_matrix& nested() const { return x_; }
+};
+}  // namespace internal
+
+/**
+ * A design matrix for the GLM distributions that is prepared once per data
+ * set and then reused on every evaluation of the log density.
+ *
+ * On construction the columns of the matrix are split in two groups. Columns
+ * in which the fraction of nonzero entries is at most `max_sparse_density`
+ * (typically one-hot encoded factors and their interactions) are stored in a
+ * compressed column major `Eigen::SparseMatrix`. All other columns are copied
+ * into a contiguous, column major, aligned `Eigen::MatrixXd`. The products
+ * `x * beta` and `x^T * d` needed by the GLMs then cost `O(N * K_dense + nnz)`
+ * instead of `O(N * K)`.
+ *
+ * Its usage pattern is:
+ *
+ * ~~~
+ * Eigen::MatrixXd x_raw = ...;
+ * glm_design_matrix x(x_raw);
+ *
+ * lp = poisson_log_glm_lpmf(y, x, alpha, beta);
+ * ~~~
+ *
+ * The design matrix is data, so no derivatives are propagated to it.
+ */
+class glm_design_matrix {
+ public:
+  using Scalar = double;
+  static constexpr int RowsAtCompileTime = Eigen::Dynamic;
+  static constexpr int ColsAtCompileTime = Eigen::Dynamic;
+
+  /**
+   * Prepare a design matrix.
+   *
+   * @tparam EigMat type of the matrix
+   * @param x design matrix
+   * @param max_sparse_density columns with at most this fraction of
+   * nonzero entries are stored in sparse format. A value of 0 stores only
+   * columns that are entirely zero in sparse format.
+   * @throw std::domain_error if `max_sparse_density` is not in [0, 1]
+   */
+  template <typename EigMat, require_eigen_dense_base_t<EigMat>* = nullptr,
+            require_vt_same<double, EigMat>* = nullptr>
+  explicit glm_design_matrix(const EigMat& x, double max_sparse_density = 0.1)
+      : rows_(x.rows()), cols_(x.cols()) {
+    check_bounded("glm_design_matrix", "max_sparse_density",
+                  max_sparse_density, 0.0, 1.0);
+    const auto& x_ref = to_ref(x);
+    for (Eigen::Index j = 0; j < cols_; ++j) {
+      Eigen::Index nonzeros = (x_ref.col(j).array() != 0.0).count();
+      if (nonzeros <= max_sparse_density * rows_) {
+        sparse_cols_.push_back(j);
+      } else {
+        dense_cols_.push_back(j);
+      }
+    }
+    dense_.resize(rows_, dense_cols_.size());
+    for (size_t j = 0; j < dense_cols_.size(); ++j) {
+      dense_.col(j) = x_ref.col(dense_cols_[j]);
+    }
+    sparse_.resize(rows_, sparse_cols_.size());
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (size_t j = 0; j < sparse_cols_.size(); ++j) {
+      for (Eigen::Index i = 0; i < rows_; ++i) {
+        double x_ij = x_ref.coeff(i, sparse_cols_[j]);
+        if (x_ij != 0.0) {
+          triplets.emplace_back(i, j, x_ij);
+        }
+      }
+    }
+    sparse_.setFromTriplets(triplets.begin(), triplets.end());
+    sparse_.makeCompressed();
+  }
+
+  /**
+   * Return the number of rows (instances).
+   */
+  inline Eigen::Index rows() const { return rows_; }
+
+  /**
+   * Return the number of columns (attributes).
+   */
+  inline Eigen::Index cols() const { return cols_; }
+
+  /**
+   * Return the columns that are stored densely.
+   */
+  inline const Eigen::MatrixXd& dense() const { return dense_; }
+
+  /**
+   * Return the columns that are stored in sparse format.
+   */
+  inline const Eigen::SparseMatrix<double>& sparse() const { return sparse_; }
+
+  /**
+   * Return the indices of the columns of the original matrix stored densely.
+   */
+  inline const std::vector<Eigen::Index>& dense_cols() const {
+    return dense_cols_;
+  }
+
+  /**
+   * Return the indices of the columns of the original matrix stored in sparse
+   * format.
+   */
+  inline const std::vector<Eigen::Index>& sparse_cols() const {
+    return sparse_cols_;
+  }
+
+  /**
+   * Return the design matrix as a dense matrix, with columns in the original
+   * order.
+   */
+  inline Eigen::MatrixXd to_dense() const {
+    Eigen::MatrixXd res(rows_, cols_);
+    for (size_t j = 0; j < dense_cols_.size(); ++j) {
+      res.col(dense_cols_[j]) = dense_.col(j);
+    }
+    for (size_t j = 0; j < sparse_cols_.size(); ++j) {
+      res.col(sparse_cols_[j]) = sparse_.col(j);
+    }
+    return res;
+  }
+
+  /**
+   * Return the product of the design matrix and a vector, `x * beta`.
+   *
+   * @tparam Vec type of the vector
+   * @param beta vector with `cols()` elements
+   * @return product with `rows()` elements
+   */
+  template <typename Vec,
+            require_eigen_vector_vt<std::is_arithmetic, Vec>* = nullptr>
+  inline Eigen::VectorXd multiply(const Vec& beta) const {
+    check_size_match("glm_design_matrix", "Columns of x", cols_,
+                     "size of beta", beta.size());
+    const auto& beta_ref = to_ref(beta);
+    Eigen::VectorXd res;
+    if (dense_cols_.empty()) {
+      res = Eigen::VectorXd::Zero(rows_);
+    } else {
+      Eigen::VectorXd beta_dense(dense_cols_.size());
+      for (size_t j = 0; j < dense_cols_.size(); ++j) {
+        beta_dense.coeffRef(j) = beta_ref.coeff(dense_cols_[j]);
+      }
+      res.noalias() = dense_ * beta_dense;
+    }
+    if (!sparse_cols_.empty()) {
+      Eigen::VectorXd beta_sparse(sparse_cols_.size());
+      for (size_t j = 0; j < sparse_cols_.size(); ++j) {
+        beta_sparse.coeffRef(j) = beta_ref.coeff(sparse_cols_[j]);
+      }
+      res += sparse_ * beta_sparse;
+    }
+    return res;
+  }
+
+  /**
+   * Return the product of the transpose of the design matrix and a vector,
+   * `x^T * d`.
+   *
+   * @tparam Vec type of the vector
+   * @param d vector with `rows()` elements
+   * @return product with `cols()` elements
+   */
+  template <typename Vec,
+            require_eigen_vector_vt<std::is_arithmetic, Vec>* = nullptr>
+  inline Eigen::VectorXd transpose_multiply(const Vec& d) const {
+    check_size_match("glm_design_matrix", "Rows of x", rows_, "size of d",
+                     d.size());
+    const auto& d_ref = to_ref(d);
+    Eigen::VectorXd res(cols_);
+    if (!dense_cols_.empty()) {
+      Eigen::VectorXd res_dense = dense_.transpose() * d_ref;
+      for (size_t j = 0; j < dense_cols_.size(); ++j) {
+        res.coeffRef(dense_cols_[j]) = res_dense.coeff(j);
+      }
+    }
+    if (!sparse_cols_.empty()) {
+      Eigen::VectorXd res_sparse = sparse_.transpose() * d_ref;
+      for (size_t j = 0; j < sparse_cols_.size(); ++j) {
+        res.coeffRef(sparse_cols_[j]) = res_sparse.coeff(j);
+      }
+    }
+    return res;
+  }
+
+  /**
+   * Return a view of the transpose of this design matrix.
+   */
+  inline internal::glm_design_matrix_transpose transpose() const {
+    return internal::glm_design_matrix_transpose(*this);
+  }
+
+  /**
+   * Return this design matrix with every element multiplied by a scalar.
+   *
+   * @param a scalar
+   */
+  inline glm_design_matrix scale(double a) const {
+    glm_design_matrix res(*this);
+    res.dense_ *= a;
+    res.sparse_ *= a;
+    return res;
+  }
+
+ private:
+  Eigen::Index rows_;
+  Eigen::Index cols_;
+  Eigen::MatrixXd dense_;
+  Eigen::SparseMatrix<double> sparse_;
+  std::vector<Eigen::Index> dense_cols_;
+  std::vector<Eigen::Index> sparse_cols_;
+};
+
+/**
+ * Return the product of a prepared design matrix and a vector.
+ *
+ * @tparam Vec type of the vector
+ * @param x design matrix
+ * @param beta vector
+ * @return `x * beta`
+ */
+template <typename Vec,
+          require_eigen_vector_vt<std::is_arithmetic, Vec>* = nullptr>
+inline Eigen::VectorXd operator*(const glm_design_matrix& x, const Vec& beta) {
+  return x.multiply(beta);
+}
+
+namespace internal {
+/**
+ * Return the product of the transpose of a prepared design matrix and a
+ * vector.
+ *
+ * @tparam Vec type of the vector
+ * @param xt transpose of design matrix
+ * @param d vector
+ * @return `x^T * d`
+ */
+template <typename Vec,
+          require_eigen_vector_vt<std::is_arithmetic, Vec>* = nullptr>
+inline Eigen::VectorXd operator*(const glm_design_matrix_transpose& xt,
+                                 const Vec& d) {
+  return xt.nested().transpose_multiply(d);
+}
+}  // namespace internal
+
+/**
+ * Return the product of a row vector and a prepared design matrix.
+ *
+ * @tparam RowVec type of the row vector
+ * @param d row vector
+ * @param x design matrix
+ * @return `d * x`
+ */
+template <typename RowVec,
+          require_eigen_row_vector_vt<std::is_arithmetic, RowVec>* = nullptr>
+inline Eigen::RowVectorXd operator*(const RowVec& d,
+                                    const glm_design_matrix& x) {
+  return x.transpose_multiply(d.transpose()).transpose();
+}
+
+/**
+ * Return a prepared design matrix multiplied by a scalar.
+ *
+ * @param a scalar
+ * @param x design matrix
+ * @return `a * x`
+ */
+inline glm_design_matrix operator*(double a, const glm_design_matrix& x) {
+  return x.scale(a);
+}
+
+/**
+ * Return the prepared design matrix. It always holds doubles.
+ *
+ * @param x design matrix
+ * @return `x`
+ */
+inline const glm_design_matrix& value_of_rec(const glm_design_matrix& x) {
+  return x;
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
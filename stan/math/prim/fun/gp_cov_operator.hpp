@@ -0,0 +1,755 @@
+#ifndef STAN_MATH_PRIM_FUN_GP_COV_OPERATOR_HPP
+#define STAN_MATH_PRIM_FUN_GP_COV_OPERATOR_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/square.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+#ifdef STAN_THREADS
+#include <tbb/blocked_range.h>
+#include <tbb/combinable.h>
+#include <tbb/parallel_for.h>
+#endif
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Squared exponential kernel
+ * `sigma^2 * exp(-d^2 / (2 * l^2))` with parameters `(sigma, l)`.
+ */
+struct gp_exp_quad_kernel {
+  static constexpr int num_params = 2;
+
+  template <typename T1, typename T2>
+  static inline double value(const T1& x1, const T2& x2, const double* theta) {
+    const double d_sq = (x1 - x2).squaredNorm();
+    return square(theta[0]) * std::exp(-0.5 * d_sq / square(theta[1]));
+  }
+
+  template <typename T1, typename T2>
+  static inline void gradient(const T1& x1, const T2& x2, const double* theta,
+                              double* grad) {
+    const double l = theta[1];
+    const double d_sq = (x1 - x2).squaredNorm();
+    const double k = square(theta[0]) * std::exp(-0.5 * d_sq / (l * l));
+    grad[0] = 2.0 * k / theta[0];
+    grad[1] = k * d_sq / (l * l * l);
+  }
+};
+
+/**
+ * Matern 3/2 kernel `sigma^2 * (1 + r) * exp(-r)` with
+ * `r = sqrt(3) * d / l` and parameters `(sigma, l)`.
+ */
+struct gp_matern32_kernel {
+  static constexpr int num_params = 2;
+
+  template <typename T1, typename T2>
+  static inline double value(const T1& x1, const T2& x2, const double* theta) {
+    const double r = std::sqrt(3.0) * (x1 - x2).norm() / theta[1];
+    return square(theta[0]) * (1.0 + r) * std::exp(-r);
+  }
+
+  template <typename T1, typename T2>
+  static inline void gradient(const T1& x1, const T2& x2, const double* theta,
+                              double* grad) {
+    const double r = std::sqrt(3.0) * (x1 - x2).norm() / theta[1];
+    const double sigma_sq_exp = square(theta[0]) * std::exp(-r);
+    grad[0] = 2.0 * sigma_sq_exp * (1.0 + r) / theta[0];
+    grad[1] = sigma_sq_exp * r * r / theta[1];
+  }
+};
+
+/**
+ * Matern 5/2 kernel `sigma^2 * (1 + r + r^2 / 3) * exp(-r)` with
+ * `r = sqrt(5) * d / l` and parameters `(sigma, l)`.
+ */
+struct gp_matern52_kernel {
+  static constexpr int num_params = 2;
+
+  template <typename T1, typename T2>
+  static inline double value(const T1& x1, const T2& x2, const double* theta) {
+    const double r = std::sqrt(5.0) * (x1 - x2).norm() / theta[1];
+    return square(theta[0]) * (1.0 + r + r * r / 3.0) * std::exp(-r);
+  }
+
+  template <typename T1, typename T2>
+  static inline void gradient(const T1& x1, const T2& x2, const double* theta,
+                              double* grad) {
+    const double r = std::sqrt(5.0) * (x1 - x2).norm() / theta[1];
+    const double sigma_sq_exp = square(theta[0]) * std::exp(-r);
+    grad[0] = 2.0 * sigma_sq_exp * (1.0 + r + r * r / 3.0) / theta[0];
+    grad[1] = sigma_sq_exp * r * r * (1.0 + r) / (3.0 * theta[1]);
+  }
+};
+
+/**
+ * Periodic kernel `sigma^2 * exp(-2 * sin(pi * d / p)^2 / l^2)` with
+ * parameters `(sigma, l, p)`.
+ */
+struct gp_periodic_kernel {
+  static constexpr int num_params = 3;
+
+  template <typename T1, typename T2>
+  static inline double value(const T1& x1, const T2& x2, const double* theta) {
+    const double s = std::sin(pi() * (x1 - x2).norm() / theta[2]);
+    return square(theta[0]) * std::exp(-2.0 * s * s / square(theta[1]));
+  }
+
+  template <typename T1, typename T2>
+  static inline void gradient(const T1& x1, const T2& x2, const double* theta,
+                              double* grad) {
+    const double l = theta[1];
+    const double p = theta[2];
+    const double d = (x1 - x2).norm();
+    const double s = std::sin(pi() * d / p);
+    const double k = square(theta[0]) * std::exp(-2.0 * s * s / (l * l));
+    grad[0] = 2.0 * k / theta[0];
+    grad[1] = 4.0 * k * s * s / (l * l * l);
+    grad[2]
+        = 4.0 * pi() * k * d * s * std::cos(pi() * d / p) / (l * l * p * p);
+  }
+};
+
+/**
+ * Dot product kernel `sigma^2 + x1^T * x2` with parameter `sigma`.
+ */
+struct gp_dot_prod_kernel {
+  static constexpr int num_params = 1;
+
+  template <typename T1, typename T2>
+  static inline double value(const T1& x1, const T2& x2, const double* theta) {
+    return square(theta[0]) + x1.dot(x2);
+  }
+
+  template <typename T1, typename T2>
+  static inline void gradient(const T1& x1, const T2& x2, const double* theta,
+                              double* grad) {
+    grad[0] = 2.0 * theta[0];
+  }
+};
+
+/**
+ * Return the inputs of a Gaussian process as the columns of a matrix.
+ *
+ * @tparam T_x type of the inputs, `double` or an Eigen vector of `double`
+ * @param function name of the calling function (for error messages)
+ * @param x inputs
+ * @return matrix with one column per input
+ * @throw std::domain_error if an input is NaN
+ * @throw std::invalid_argument if the inputs have different sizes
+ */
+template <typename T_x, require_stan_scalar_t<T_x>* = nullptr>
+inline Eigen::MatrixXd gp_inputs_matrix(const char* function,
+                                        const std::vector<T_x>& x) {
+  check_not_nan(function, "x", x);
+  Eigen::MatrixXd x_mat(1, x.size());
+  for (size_t i = 0; i < x.size(); ++i) {
+    x_mat(0, i) = x[i];
+  }
+  return x_mat;
+}
+
+template <typename T_x, require_eigen_col_vector_t<T_x>* = nullptr>
+inline Eigen::MatrixXd gp_inputs_matrix(const char* function,
+                                        const std::vector<T_x>& x) {
+  const Eigen::Index dim = x.empty() ? 0 : x[0].size();
+  Eigen::MatrixXd x_mat(dim, x.size());
+  for (size_t i = 0; i < x.size(); ++i) {
+    check_size_match(function, "size of x[i]", x[i].size(), "size of x[0]",
+                     dim);
+    check_not_nan(function, "x", x[i]);
+    x_mat.col(i) = x[i];
+  }
+  return x_mat;
+}
+}  // namespace internal
+
+/**
+ * Settings of the iterative algorithms used with a `gp_cov_operator`.
+ */
+struct gp_cov_operator_options {
+  /**
+   * Number of random probe vectors of the stochastic trace and
+   * log-determinant estimates.
+   */
+  int num_probes = 32;
+  /**
+   * Number of Lanczos steps per probe of the log-determinant estimate.
+   */
+  int lanczos_steps = 50;
+  /**
+   * Conjugate gradients stop once the norm of every residual is below this
+   * tolerance relative to the norm of its right-hand side.
+   */
+  double cg_tolerance = 1e-8;
+  /**
+   * Maximum number of conjugate gradient iterations.
+   */
+  int cg_max_iterations = 1000;
+  /**
+   * Seed of the random probe vectors, fixed so that repeated evaluations
+   * give identical estimates.
+   */
+  unsigned int seed = 0;
+};
+
+/**
+ * A Gaussian process covariance matrix that is never stored.
+ *
+ * The operator holds the inputs, the kernel parameters and a constant
+ * added to the diagonal, and evaluates the kernel on the fly. Products with
+ * the matrix, its diagonal and an estimate of its log determinant are
+ * computed with `O(N)` memory for `N` inputs, and so are the products with
+ * the derivatives of the matrix with respect to the parameters that
+ * `multi_normal_lpdf()` needs for its gradients. Each product costs
+ * `O(N^2)` kernel evaluations and, when `STAN_THREADS` is defined, is split
+ * across TBB tasks by rows.
+ *
+ * Operators are created by `gp_exp_quad_cov_operator()`,
+ * `gp_matern32_cov_operator()`, `gp_matern52_cov_operator()`,
+ * `gp_periodic_cov_operator()` and `gp_dot_prod_cov_operator()`, which take
+ * the same arguments as the functions returning dense matrices, and by
+ * `add_diag()`.
+ *
+ * ~~~
+ * auto K = add_diag(gp_exp_quad_cov_operator(x, alpha, rho), square(sigma));
+ * lp += multi_normal_lpdf(y, mu, K);
+ * ~~~
+ *
+ * The inputs are data; derivatives only propagate to the parameters.
+ *
+ * @tparam Kernel type of the kernel, see `internal::gp_exp_quad_kernel`
+ * @tparam T scalar type of the parameters
+ */
+template <typename Kernel, typename T>
+class gp_cov_operator {
+ public:
+  using kernel_type = Kernel;
+  using value_type = T;
+
+  /**
+   * Number of parameters: those of the kernel followed by the constant
+   * added to the diagonal.
+   */
+  static constexpr int num_params = Kernel::num_params + 1;
+
+  /**
+   * Construct a covariance operator.
+   *
+   * @param x inputs, one per column
+   * @param theta kernel parameters followed by the constant added to the
+   * diagonal
+   * @throw std::invalid_argument if `theta` has the wrong size
+   */
+  gp_cov_operator(Eigen::MatrixXd x, Eigen::Matrix<T, Eigen::Dynamic, 1> theta)
+      : x_(std::move(x)),
+        theta_(std::move(theta)),
+        theta_val_(value_of(theta_)) {
+    check_size_match("gp_cov_operator", "number of parameters", theta_.size(),
+                     "expected number of parameters",
+                     static_cast<int>(num_params));
+  }
+
+  inline Eigen::Index rows() const { return x_.cols(); }
+  inline Eigen::Index cols() const { return x_.cols(); }
+
+  /**
+   * Return the inputs, one per column.
+   */
+  inline const Eigen::MatrixXd& inputs() const { return x_; }
+
+  /**
+   * Return the parameters: those of the kernel followed by the constant
+   * added to the diagonal.
+   */
+  inline const Eigen::Matrix<T, Eigen::Dynamic, 1>& theta() const {
+    return theta_;
+  }
+
+  inline gp_cov_operator_options& options() { return options_; }
+  inline const gp_cov_operator_options& options() const { return options_; }
+
+  /**
+   * Return the values of the diagonal of the matrix.
+   *
+   * @return diagonal
+   */
+  inline Eigen::VectorXd diagonal() const {
+    Eigen::VectorXd diag(rows());
+    for (Eigen::Index i = 0; i < rows(); ++i) {
+      diag.coeffRef(i) = Kernel::value(x_.col(i), x_.col(i), theta_val_.data())
+                         + theta_val_.coeff(Kernel::num_params);
+    }
+    return diag;
+  }
+
+  /**
+   * Return the product of the values of the matrix with the specified
+   * matrix or vector.
+   *
+   * @tparam EigMat type of the right-hand side
+   * @param v right-hand side with as many rows as the operator
+   * @return product
+   * @throw std::invalid_argument if the sizes do not match
+   */
+  template <typename EigMat,
+            require_eigen_vt<std::is_arithmetic, EigMat>* = nullptr>
+  inline Eigen::Matrix<double, Eigen::Dynamic, EigMat::ColsAtCompileTime>
+  multiply(const EigMat& v) const {
+    check_size_match("gp_cov_operator::multiply", "columns of operator",
+                     cols(), "rows of right-hand side", v.rows());
+    const auto& v_ref = to_ref(v);
+    const Eigen::Index N = rows();
+    const double jitter = theta_val_.coeff(Kernel::num_params);
+    Eigen::Matrix<double, Eigen::Dynamic, EigMat::ColsAtCompileTime> res(
+        N, v.cols());
+    auto multiply_rows = [&](Eigen::Index begin, Eigen::Index end) {
+      Eigen::RowVectorXd k_row(N);
+      for (Eigen::Index i = begin; i < end; ++i) {
+        for (Eigen::Index j = 0; j < N; ++j) {
+          k_row.coeffRef(j)
+              = Kernel::value(x_.col(i), x_.col(j), theta_val_.data());
+        }
+        k_row.coeffRef(i) += jitter;
+        res.row(i).noalias() = k_row * v_ref;
+      }
+    };
+#ifdef STAN_THREADS
+    tbb::parallel_for(tbb::blocked_range<Eigen::Index>(0, N, grain_size),
+                      [&](const tbb::blocked_range<Eigen::Index>& r) {
+                        multiply_rows(r.begin(), r.end());
+                      });
+#else
+    multiply_rows(0, N);
+#endif
+    return res;
+  }
+
+  /**
+   * Return `U.col(c)^T * dK_k * V.col(c)` for every column `c` of the
+   * specified matrices and every parameter `k`, where `dK_k` is the
+   * derivative of the matrix with respect to parameter `k`.
+   *
+   * @param U left vectors, one per column
+   * @param V right vectors, one per column
+   * @return matrix with one row per parameter and one column per pair of
+   * vectors
+   */
+  inline Eigen::MatrixXd quad_form_gradients(const Eigen::MatrixXd& U,
+                                             const Eigen::MatrixXd& V) const {
+    const Eigen::Index N = rows();
+    const Eigen::Index M = U.cols();
+    // copies, as the Eigen constructors would odr-use the static members
+    const Eigen::Index num_kernel_params = Kernel::num_params;
+    const Eigen::Index num_all_params = num_params;
+    auto add_rows = [&](Eigen::MatrixXd& G, Eigen::Index begin,
+                        Eigen::Index end) {
+      Eigen::Matrix<double, Kernel::num_params, Eigen::Dynamic> dk_row(
+          num_kernel_params, N);
+      for (Eigen::Index i = begin; i < end; ++i) {
+        for (Eigen::Index j = 0; j < N; ++j) {
+          Kernel::gradient(x_.col(i), x_.col(j), theta_val_.data(),
+                           dk_row.col(j).data());
+        }
+        G.noalias() += (dk_row * V) * U.row(i).asDiagonal();
+      }
+    };
+    Eigen::MatrixXd G(num_all_params, M);
+#ifdef STAN_THREADS
+    tbb::combinable<Eigen::MatrixXd> partial_sums([M, num_kernel_params]() {
+      return Eigen::MatrixXd::Zero(num_kernel_params, M).eval();
+    });
+    tbb::parallel_for(tbb::blocked_range<Eigen::Index>(0, N, grain_size),
+                      [&](const tbb::blocked_range<Eigen::Index>& r) {
+                        add_rows(partial_sums.local(), r.begin(), r.end());
+                      });
+    G.topRows(num_kernel_params) = partial_sums.combine(
+        [](const Eigen::MatrixXd& a, const Eigen::MatrixXd& b) {
+          return (a + b).eval();
+        });
+#else
+    Eigen::MatrixXd G_kernel = Eigen::MatrixXd::Zero(num_kernel_params, M);
+    add_rows(G_kernel, 0, N);
+    G.topRows(num_kernel_params) = G_kernel;
+#endif
+    G.row(num_kernel_params) = U.cwiseProduct(V).colwise().sum();
+    return G;
+  }
+
+  /**
+   * Return the values of the matrix as a dense matrix. This needs `O(N^2)`
+   * memory and is meant for small problems and tests.
+   *
+   * @return dense matrix
+   */
+  inline Eigen::MatrixXd to_dense() const {
+    return multiply(Eigen::MatrixXd::Identity(rows(), cols()));
+  }
+
+  /**
+   * Return a stochastic Lanczos quadrature estimate of the log determinant
+   * of the values of the matrix, using the probe vectors and number of
+   * Lanczos steps given by `options()`.
+   *
+   * @return estimate of the log determinant
+   * @throw std::domain_error if the matrix is not positive definite
+   */
+  inline double log_determinant() const;
+
+ private:
+  static constexpr Eigen::Index grain_size = 16;
+  Eigen::MatrixXd x_;
+  Eigen::Matrix<T, Eigen::Dynamic, 1> theta_;
+  Eigen::VectorXd theta_val_;
+  gp_cov_operator_options options_;
+};
+
+namespace internal {
+/**
+ * Return a matrix of independent Rademacher (+1 or -1) entries.
+ *
+ * @param rows number of rows
+ * @param cols number of columns
+ * @param seed seed of the random number generator
+ * @return random matrix
+ */
+inline Eigen::MatrixXd rademacher_probes(Eigen::Index rows, Eigen::Index cols,
+                                         unsigned int seed) {
+  boost::random::mt19937 rng(seed);
+  Eigen::MatrixXd Z(rows, cols);
+  for (Eigen::Index j = 0; j < cols; ++j) {
+    for (Eigen::Index i = 0; i < rows; ++i) {
+      Z.coeffRef(i, j) = (rng() & 1u) ? 1.0 : -1.0;
+    }
+  }
+  return Z;
+}
+
+/**
+ * Solve `K * X = B` column by column with Jacobi preconditioned conjugate
+ * gradients, where `K` is the values of the specified operator. All columns
+ * are iterated together so that every iteration needs a single product
+ * with the operator.
+ *
+ * @tparam Op type of the operator
+ * @param op symmetric positive definite operator
+ * @param B right-hand sides
+ * @return solutions
+ * @throw std::domain_error if the iterations do not converge
+ */
+template <typename Op>
+inline Eigen::MatrixXd gp_cov_conjugate_gradient(const Op& op,
+                                                 const Eigen::MatrixXd& B) {
+  const gp_cov_operator_options& opts = op.options();
+  const Eigen::VectorXd inv_diag = op.diagonal().cwiseInverse();
+  const Eigen::VectorXd threshold = opts.cg_tolerance * B.colwise().norm();
+  Eigen::MatrixXd X = Eigen::MatrixXd::Zero(B.rows(), B.cols());
+  Eigen::MatrixXd R = B;
+  Eigen::MatrixXd P = inv_diag.asDiagonal() * R;
+  Eigen::VectorXd rz = R.cwiseProduct(P).colwise().sum();
+  std::vector<int> active(B.cols());
+  int num_active = 0;
+  for (Eigen::Index c = 0; c < B.cols(); ++c) {
+    active[c] = R.col(c).norm() > threshold.coeff(c);
+    if (active[c]) {
+      ++num_active;
+    } else {
+      P.col(c).setZero();
+    }
+  }
+  for (int iter = 0; num_active > 0; ++iter) {
+    if (iter == opts.cg_max_iterations) {
+      throw_domain_error("gp_cov_operator", "conjugate gradients",
+                         opts.cg_max_iterations,
+                         "did not converge in ", " iterations");
+    }
+    const Eigen::MatrixXd AP = op.multiply(P);
+    for (Eigen::Index c = 0; c < B.cols(); ++c) {
+      if (!active[c]) {
+        continue;
+      }
+      const double alpha = rz.coeff(c) / P.col(c).dot(AP.col(c));
+      X.col(c) += alpha * P.col(c);
+      R.col(c) -= alpha * AP.col(c);
+      if (R.col(c).norm() <= threshold.coeff(c)) {
+        active[c] = false;
+        --num_active;
+        P.col(c).setZero();
+        continue;
+      }
+      const Eigen::VectorXd z = inv_diag.cwiseProduct(R.col(c));
+      const double rz_new = R.col(c).dot(z);
+      P.col(c) = z + (rz_new / rz.coeff(c)) * P.col(c);
+      rz.coeffRef(c) = rz_new;
+    }
+  }
+  return X;
+}
+
+/**
+ * Return the stochastic Lanczos quadrature estimate of the log
+ * determinant of the values of the specified operator,
+ *
+ * <code>
+ * log det(K) = tr(log(K)) ~ mean_i z_i^T log(K) z_i,
+ * </code>
+ *
+ * where each quadratic form is evaluated with the Gauss quadrature given
+ * by the Lanczos tridiagonalization of `K` started at the probe `z_i`. The
+ * Lanczos recurrences of all probes are run together, so every step needs
+ * a single product with the operator, and no basis is stored.
+ *
+ * @tparam Op type of the operator
+ * @param op symmetric positive definite operator
+ * @param Z probe vectors, one per column
+ * @param num_steps maximum number of Lanczos steps per probe
+ * @return estimate of the log determinant
+ * @throw std::domain_error if the operator is not positive definite
+ */
+template <typename Op>
+inline double stochastic_lanczos_log_determinant(const Op& op,
+                                                 const Eigen::MatrixXd& Z,
+                                                 int num_steps) {
+  const Eigen::Index N = Z.rows();
+  const Eigen::Index P = Z.cols();
+  const int m = std::max<Eigen::Index>(1, std::min<Eigen::Index>(num_steps, N));
+  Eigen::MatrixXd alpha = Eigen::MatrixXd::Zero(m, P);
+  Eigen::MatrixXd beta = Eigen::MatrixXd::Zero(m, P);
+  std::vector<int> steps(P, m);
+  Eigen::MatrixXd Q_prev = Eigen::MatrixXd::Zero(N, P);
+  Eigen::MatrixXd Q = Z * Z.colwise().norm().cwiseInverse().asDiagonal();
+  for (int j = 0; j < m; ++j) {
+    Eigen::MatrixXd W = op.multiply(Q);
+    for (Eigen::Index c = 0; c < P; ++c) {
+      if (j >= steps[c]) {
+        continue;
+      }
+      if (j > 0) {
+        W.col(c) -= beta.coeff(j - 1, c) * Q_prev.col(c);
+      }
+      alpha.coeffRef(j, c) = Q.col(c).dot(W.col(c));
+      W.col(c) -= alpha.coeff(j, c) * Q.col(c);
+      beta.coeffRef(j, c) = W.col(c).norm();
+      if (j + 1 < m
+          && beta.coeff(j, c) <= EPSILON * std::fabs(alpha.coeff(j, c))) {
+        // the Krylov space is invariant, the quadrature is exact
+        steps[c] = j + 1;
+        W.col(c).setZero();
+      } else {
+        W.col(c) /= beta.coeff(j, c);
+      }
+    }
+    Q_prev.swap(Q);
+    Q.swap(W);
+  }
+  double log_det = 0;
+  for (Eigen::Index c = 0; c < P; ++c) {
+    const int k = steps[c];
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver;
+    Eigen::VectorXd diag = alpha.col(c).head(k);
+    Eigen::VectorXd sub_diag = beta.col(c).head(k - 1);
+    solver.computeFromTridiagonal(diag, sub_diag, Eigen::ComputeEigenvectors);
+    const Eigen::VectorXd& eigenvalues = solver.eigenvalues();
+    if (!(eigenvalues.array() > 0.0).all()) {
+      throw_domain_error("gp_cov_operator", "Covariance operator",
+                         " is not positive definite", "");
+    }
+    log_det += Z.col(c).squaredNorm()
+               * solver.eigenvectors()
+                     .row(0)
+                     .array()
+                     .square()
+                     .matrix()
+                     .dot(eigenvalues.array().log().matrix());
+  }
+  return log_det / P;
+}
+}  // namespace internal
+
+template <typename Kernel, typename T>
+inline double gp_cov_operator<Kernel, T>::log_determinant() const {
+  if (rows() == 0) {
+    return 0;
+  }
+  return internal::stochastic_lanczos_log_determinant(
+      *this,
+      internal::rademacher_probes(rows(), options_.num_probes, options_.seed),
+      options_.lanczos_steps);
+}
+
+/**
+ * Return a squared exponential covariance operator, the lazy counterpart
+ * of `gp_exp_quad_cov()`.
+ *
+ * @tparam T_x type of the inputs, `double` or an Eigen vector of `double`
+ * @tparam T_sigma type of the marginal standard deviation
+ * @tparam T_l type of the length scale
+ * @param x inputs
+ * @param sigma marginal standard deviation
+ * @param length_scale length scale
+ * @return covariance operator
+ * @throw std::domain_error if `sigma` or `length_scale` is not positive
+ * and finite or if an input is NaN
+ */
+template <typename T_x, typename T_sigma, typename T_l>
+inline gp_cov_operator<internal::gp_exp_quad_kernel,
+                       return_type_t<T_sigma, T_l>>
+gp_exp_quad_cov_operator(const std::vector<T_x>& x, const T_sigma& sigma,
+                         const T_l& length_scale) {
+  static const char* function = "gp_exp_quad_cov_operator";
+  check_positive_finite(function, "magnitude", sigma);
+  check_positive_finite(function, "length scale", length_scale);
+  Eigen::Matrix<return_type_t<T_sigma, T_l>, Eigen::Dynamic, 1> theta(3);
+  theta << sigma, length_scale, 0.0;
+  return {internal::gp_inputs_matrix(function, x), std::move(theta)};
+}
+
+/**
+ * Return a Matern 3/2 covariance operator, the lazy counterpart of
+ * `gp_matern32_cov()`.
+ *
+ * @tparam T_x type of the inputs, `double` or an Eigen vector of `double`
+ * @tparam T_sigma type of the marginal standard deviation
+ * @tparam T_l type of the length scale
+ * @param x inputs
+ * @param sigma marginal standard deviation
+ * @param length_scale length scale
+ * @return covariance operator
+ * @throw std::domain_error if `sigma` or `length_scale` is not positive
+ * and finite or if an input is NaN
+ */
+template <typename T_x, typename T_sigma, typename T_l>
+inline gp_cov_operator<internal::gp_matern32_kernel,
+                       return_type_t<T_sigma, T_l>>
+gp_matern32_cov_operator(const std::vector<T_x>& x, const T_sigma& sigma,
+                         const T_l& length_scale) {
+  static const char* function = "gp_matern32_cov_operator";
+  check_positive_finite(function, "magnitude", sigma);
+  check_positive_finite(function, "length scale", length_scale);
+  Eigen::Matrix<return_type_t<T_sigma, T_l>, Eigen::Dynamic, 1> theta(3);
+  theta << sigma, length_scale, 0.0;
+  return {internal::gp_inputs_matrix(function, x), std::move(theta)};
+}
+
+/**
+ * Return a Matern 5/2 covariance operator, the lazy counterpart of
+ * `gp_matern52_cov()`.
+ *
+ * @tparam T_x type of the inputs, `double` or an Eigen vector of `double`
+ * @tparam T_sigma type of the marginal standard deviation
+ * @tparam T_l type of the length scale
+ * @param x inputs
+ * @param sigma marginal standard deviation
+ * @param length_scale length scale
+ * @return covariance operator
+ * @throw std::domain_error if `sigma` or `length_scale` is not positive
+ * and finite or if an input is NaN
+ */
+template <typename T_x, typename T_sigma, typename T_l>
+inline gp_cov_operator<internal::gp_matern52_kernel,
+                       return_type_t<T_sigma, T_l>>
+gp_matern52_cov_operator(const std::vector<T_x>& x, const T_sigma& sigma,
+                         const T_l& length_scale) {
+  static const char* function = "gp_matern52_cov_operator";
+  check_positive_finite(function, "magnitude", sigma);
+  check_positive_finite(function, "length scale", length_scale);
+  Eigen::Matrix<return_type_t<T_sigma, T_l>, Eigen::Dynamic, 1> theta(3);
+  theta << sigma, length_scale, 0.0;
+  return {internal::gp_inputs_matrix(function, x), std::move(theta)};
+}
+
+/**
+ * Return a periodic covariance operator, the lazy counterpart of
+ * `gp_periodic_cov()`.
+ *
+ * @tparam T_x type of the inputs, `double` or an Eigen vector of `double`
+ * @tparam T_sigma type of the marginal standard deviation
+ * @tparam T_l type of the length scale
+ * @tparam T_p type of the period
+ * @param x inputs
+ * @param sigma marginal standard deviation
+ * @param l length scale
+ * @param p period
+ * @return covariance operator
+ * @throw std::domain_error if `sigma`, `l` or `p` is not positive and
+ * finite or if an input is NaN
+ */
+template <typename T_x, typename T_sigma, typename T_l, typename T_p>
+inline gp_cov_operator<internal::gp_periodic_kernel,
+                       return_type_t<T_sigma, T_l, T_p>>
+gp_periodic_cov_operator(const std::vector<T_x>& x, const T_sigma& sigma,
+                         const T_l& l, const T_p& p) {
+  static const char* function = "gp_periodic_cov_operator";
+  check_positive_finite(function, "signal standard deviation", sigma);
+  check_positive_finite(function, "length-scale", l);
+  check_positive_finite(function, "period", p);
+  Eigen::Matrix<return_type_t<T_sigma, T_l, T_p>, Eigen::Dynamic, 1> theta(4);
+  theta << sigma, l, p, 0.0;
+  return {internal::gp_inputs_matrix(function, x), std::move(theta)};
+}
+
+/**
+ * Return a dot product covariance operator, the lazy counterpart of
+ * `gp_dot_prod_cov()`.
+ *
+ * @tparam T_x type of the inputs, `double` or an Eigen vector of `double`
+ * @tparam T_sigma type of the bias
+ * @param x inputs
+ * @param sigma bias
+ * @return covariance operator
+ * @throw std::domain_error if `sigma` is negative or not finite or if an
+ * input is NaN
+ */
+template <typename T_x, typename T_sigma>
+inline gp_cov_operator<internal::gp_dot_prod_kernel, return_type_t<T_sigma>>
+gp_dot_prod_cov_operator(const std::vector<T_x>& x, const T_sigma& sigma) {
+  static const char* function = "gp_dot_prod_cov_operator";
+  check_nonnegative(function, "sigma", sigma);
+  check_finite(function, "sigma", sigma);
+  Eigen::Matrix<return_type_t<T_sigma>, Eigen::Dynamic, 1> theta(2);
+  theta << sigma, 0.0;
+  return {internal::gp_inputs_matrix(function, x), std::move(theta)};
+}
+
+/**
+ * Return the covariance operator with the specified constant added to its
+ * diagonal, typically the variance of observation noise or a jitter that
+ * keeps the matrix well conditioned.
+ *
+ * @tparam Kernel type of the kernel
+ * @tparam T scalar type of the parameters of the operator
+ * @tparam T_a type of the constant
+ * @param op covariance operator
+ * @param to_add constant to add to the diagonal
+ * @return covariance operator
+ * @throw std::domain_error if `to_add` is negative or not finite
+ */
+template <typename Kernel, typename T, typename T_a,
+          require_stan_scalar_t<T_a>* = nullptr>
+inline gp_cov_operator<Kernel, return_type_t<T, T_a>> add_diag(
+    const gp_cov_operator<Kernel, T>& op, const T_a& to_add) {
+  check_nonnegative("add_diag", "to_add", to_add);
+  check_finite("add_diag", "to_add", to_add);
+  Eigen::Matrix<return_type_t<T, T_a>, Eigen::Dynamic, 1> theta = op.theta();
+  theta.coeffRef(Kernel::num_params) += to_add;
+  gp_cov_operator<Kernel, return_type_t<T, T_a>> res(op.inputs(),
+                                                     std::move(theta));
+  res.options() = op.options();
+  return res;
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
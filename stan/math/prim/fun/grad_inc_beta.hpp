@@ -17,24 +17,33 @@ namespace math {
 
 // Gradient of the incomplete beta function beta(a, b, z)
 // with respect to the first two arguments, using the
-// equivalence to a hypergeometric function.
+// equivalence to a hypergeometric function, given the
+// precomputed value of beta(a, b) * inc_beta(a, b, z).
 // See http://dlmf.nist.gov/8.17#ii
 inline void grad_inc_beta(double& g1, double& g2, double a, double b,
-                          double z) {
+                          double z, double beta_inc_beta) {
   using std::exp;
   using std::log;
 
   double c1 = log(z);
   double c2 = log1m(z);
-  double c3 = beta(a, b) * inc_beta(a, b, z);
   double C = exp(a * c1 + b * c2) / a;
   double dF1 = 0;
   double dF2 = 0;
   if (C) {
     grad_2F1(dF1, dF2, a + b, 1.0, a + 1, z);
   }
-  g1 = fma((c1 - inv(a)), c3, C * (dF1 + dF2));
-  g2 = fma(c2, c3, C * dF1);
+  g1 = fma((c1 - inv(a)), beta_inc_beta, C * (dF1 + dF2));
+  g2 = fma(c2, beta_inc_beta, C * dF1);
+}
+
+// Gradient of the incomplete beta function beta(a, b, z)
+// with respect to the first two arguments, using the
+// equivalence to a hypergeometric function.
+// See http://dlmf.nist.gov/8.17#ii
+inline void grad_inc_beta(double& g1, double& g2, double a, double b,
+                          double z) {
+  grad_inc_beta(g1, g2, a, b, z, beta(a, b) * inc_beta(a, b, z));
 }
 
 }  // namespace math
@@ -16,6 +16,10 @@ namespace math {
  * <code>ibeta(a, b, z)</code>, with respect to the arguments
  * <code>a</code> and <code>b</code>.
  *
+ * This overload reuses the value of <code>ibeta(a, b, z)</code>
+ * that callers computing the incomplete beta function already have,
+ * rather than evaluating it again.
+ *
  * @tparam T type of arguments
  * @param[out] g1 partial derivative of <code>ibeta(a, b, z)</code>
  * with respect to <code>a</code>
@@ -28,20 +32,48 @@ namespace math {
  * @param[in] digammaB the value of <code>digamma(b)</code>
  * @param[in] digammaSum the value of <code>digamma(a + b)</code>
  * @param[in] betaAB the value of <code>beta(a, b)</code>
+ * @param[in] ibetaABZ the value of <code>ibeta(a, b, z)</code>
  */
 template <typename T>
 void grad_reg_inc_beta(T& g1, T& g2, const T& a, const T& b, const T& z,
                        const T& digammaA, const T& digammaB,
-                       const T& digammaSum, const T& betaAB) {
-  using std::exp;
+                       const T& digammaSum, const T& betaAB,
+                       const T& ibetaABZ) {
   T dBda = 0;
   T dBdb = 0;
-  grad_inc_beta(dBda, dBdb, a, b, z);
-  T b1 = beta(a, b) * inc_beta(a, b, z);
+  const T b1 = betaAB * ibetaABZ;
+  grad_inc_beta(dBda, dBdb, a, b, z, b1);
   g1 = (dBda - b1 * (digammaA - digammaSum)) / betaAB;
   g2 = (dBdb - b1 * (digammaB - digammaSum)) / betaAB;
 }
 
+/**
+ * Computes the gradients of the regularized incomplete beta
+ * function.  Specifically, this function computes gradients of
+ * <code>ibeta(a, b, z)</code>, with respect to the arguments
+ * <code>a</code> and <code>b</code>.
+ *
+ * @tparam T type of arguments
+ * @param[out] g1 partial derivative of <code>ibeta(a, b, z)</code>
+ * with respect to <code>a</code>
+ * @param[out] g2 partial derivative of <code>ibeta(a, b,
+ * z)</code> with respect to <code>b</code>
+ * @param[in] a a
+ * @param[in] b b
+ * @param[in] z z
+ * @param[in] digammaA the value of <code>digamma(a)</code>
+ * @param[in] digammaB the value of <code>digamma(b)</code>
+ * @param[in] digammaSum the value of <code>digamma(a + b)</code>
+ * @param[in] betaAB the value of <code>beta(a, b)</code>
+ */
+template <typename T>
+void grad_reg_inc_beta(T& g1, T& g2, const T& a, const T& b, const T& z,
+                       const T& digammaA, const T& digammaB,
+                       const T& digammaSum, const T& betaAB) {
+  grad_reg_inc_beta(g1, g2, a, b, z, digammaA, digammaB, digammaSum, betaAB,
+                    static_cast<T>(inc_beta(a, b, z)));
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -17,52 +17,54 @@
 namespace stan {
 namespace math {
 
+namespace internal {
 /**
- * Gradient of the regularized incomplete gamma functions igamma(a, z)
+ * Return true if the gradient of the regularized incomplete gamma
+ * functions at (a, z) is computed with the asymptotic expansion, which
+ * needs Q(a, z), and false if it is computed with the series expansion,
+ * which needs P(a, z).
  *
- * For small z, the gradient is computed via the series expansion;
- * for large z, the series is numerically inaccurate due to cancellation
- * and the asymptotic expansion is used.
+ * @tparam T1 type of the shape parameter
+ * @tparam T2 type of the location parameter
+ * @param a shape parameter
+ * @param z location
+ */
+template <typename T1, typename T2>
+inline bool grad_reg_inc_gamma_is_asymptotic(const T1& a, const T2& z) {
+  return z >= a && z >= 8;
+}
+
+/**
+ * Return the derivative of Q(a, z) with respect to a given the value of
+ * the regularized incomplete gamma function the expansion needs: Q(a, z)
+ * if `grad_reg_inc_gamma_is_asymptotic(a, z)` and P(a, z) otherwise.
+ * This lets callers that already computed the value reuse it.
  *
  * @tparam T1 type of the shape parameter
  * @tparam T2 type of the location parameter
+ * @tparam T3 type of the regularized incomplete gamma value
  * @param a shape parameter, a > 0
  * @param z location z >= 0
  * @param g stan::math::tgamma(a) (precomputed value)
  * @param dig boost::math::digamma(a) (precomputed value)
+ * @param p_or_q Q(a, z) or P(a, z), see above
  * @param precision required precision; applies to series expansion only
  * @param max_steps number of steps to take.
  * @throw throws std::domain_error if not converged after max_steps
  *   or increment overflows to inf.
- *
- * For the asymptotic expansion, the gradient is given by:
-   \f[
-   \begin{array}{rcl}
-   \Gamma(a, z) & = & z^{a-1}e^{-z} \sum_{k=0}^N \frac{(a-1)_k}{z^k} \qquad , z
- \gg a\\
-   Q(a, z) & = & \frac{z^{a-1}e^{-z}}{\Gamma(a)} \sum_{k=0}^N
- \frac{(a-1)_k}{z^k}\\
-   (a)_k & = & (a)_{k-1}(a-k)\\
-   \frac{d}{da} (a)_k & = & (a)_{k-1} + (a-k)\frac{d}{da} (a)_{k-1}\\
-   \frac{d}{da}Q(a, z) & = & (log(z) - \psi(a)) Q(a, z)\\
-   && + \frac{z^{a-1}e^{-z}}{\Gamma(a)} \sum_{k=0}^N \left(\frac{d}{da}
- (a-1)_k\right) \frac{1}{z^k} \end{array} \f]
  */
-template <typename T1, typename T2>
-return_type_t<T1, T2> grad_reg_inc_gamma(T1 a, T2 z, T1 g, T1 dig,
-                                         double precision = 1e-6,
-                                         int max_steps = 1e5) {
+template <typename T1, typename T2, typename T3>
+return_type_t<T1, T2> grad_reg_inc_gamma_impl(T1 a, T2 z, T1 g, T1 dig,
+                                              const T3& p_or_q,
+                                              double precision,
+                                              int max_steps) {
   using std::exp;
   using std::fabs;
   using std::log;
   using TP = return_type_t<T1, T2>;
 
-  if (is_any_nan(a, z, g, dig)) {
-    return std::numeric_limits<TP>::quiet_NaN();
-  }
-
   T2 l = log(z);
-  if (z >= a && z >= 8) {
+  if (grad_reg_inc_gamma_is_asymptotic(a, z)) {
     // asymptotic expansion http://dlmf.nist.gov/8.11#E2
     TP S = 0;
     T1 a_minus_one_minus_k = a - 1;
@@ -86,7 +88,7 @@ return_type_t<T1, T2> grad_reg_inc_gamma(T1 a, T2 z, T1 g, T1 dig,
       }
     }
 
-    return gamma_q(a, z) * (l - dig) + exp(-z + (a - 1) * l) * S / g;
+    return p_or_q * (l - dig) + exp(-z + (a - 1) * l) * S / g;
   } else {
     // gradient of series expansion http://dlmf.nist.gov/8.7#E3
     TP S = 0;
@@ -103,7 +105,7 @@ return_type_t<T1, T2> grad_reg_inc_gamma(T1 a, T2 z, T1 g, T1 dig,
         throw_domain_error("grad_reg_inc_gamma", "is not converging", "", "");
       }
       if (log_delta <= log(precision)) {
-        return gamma_p(a, z) * (dig - l) + exp(a * l) * S / g;
+        return p_or_q * (dig - l) + exp(a * l) * S / g;
       }
     }
     throw_domain_error(
@@ -113,6 +115,57 @@ return_type_t<T1, T2> grad_reg_inc_gamma(T1 a, T2 z, T1 g, T1 dig,
   }
 }
 
+}  // namespace internal
+
+/**
+ * Gradient of the regularized incomplete gamma functions igamma(a, z)
+ *
+ * For small z, the gradient is computed via the series expansion;
+ * for large z, the series is numerically inaccurate due to cancellation
+ * and the asymptotic expansion is used.
+ *
+ * @tparam T1 type of the shape parameter
+ * @tparam T2 type of the location parameter
+ * @param a shape parameter, a > 0
+ * @param z location z >= 0
+ * @param g stan::math::tgamma(a) (precomputed value)
+ * @param dig boost::math::digamma(a) (precomputed value)
+ * @param precision required precision; applies to series expansion only
+ * @param max_steps number of steps to take.
+ * @throw throws std::domain_error if not converged after max_steps
+ *   or increment overflows to inf.
+ *
+ * For the asymptotic expansion, the gradient is given by:
+   \f[
+   \begin{array}{rcl}
+   \Gamma(a, z) & = & z^{a-1}e^{-z} \sum_{k=0}^N \frac{(a-1)_k}{z^k} \qquad , z
+ \gg a\\
+   Q(a, z) & = & \frac{z^{a-1}e^{-z}}{\Gamma(a)} \sum_{k=0}^N
+ \frac{(a-1)_k}{z^k}\\
+   (a)_k & = & (a)_{k-1}(a-k)\\
+   \frac{d}{da} (a)_k & = & (a)_{k-1} + (a-k)\frac{d}{da} (a)_{k-1}\\
+   \frac{d}{da}Q(a, z) & = & (log(z) - \psi(a)) Q(a, z)\\
+   && + \frac{z^{a-1}e^{-z}}{\Gamma(a)} \sum_{k=0}^N \left(\frac{d}{da}
+ (a-1)_k\right) \frac{1}{z^k} \end{array} \f]
+ */
+template <typename T1, typename T2>
+return_type_t<T1, T2> grad_reg_inc_gamma(T1 a, T2 z, T1 g, T1 dig,
+                                         double precision = 1e-6,
+                                         int max_steps = 1e5) {
+  using TP = return_type_t<T1, T2>;
+
+  if (is_any_nan(a, z, g, dig)) {
+    return std::numeric_limits<TP>::quiet_NaN();
+  }
+
+  if (internal::grad_reg_inc_gamma_is_asymptotic(a, z)) {
+    return internal::grad_reg_inc_gamma_impl(a, z, g, dig, gamma_q(a, z),
+                                             precision, max_steps);
+  }
+  return internal::grad_reg_inc_gamma_impl(a, z, g, dig, gamma_p(a, z),
+                                           precision, max_steps);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
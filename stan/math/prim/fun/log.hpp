@@ -44,7 +44,8 @@ struct log_fun {
  */
 template <typename Container,
           require_not_container_st<std::is_arithmetic, Container>* = nullptr,
-          require_not_matrix_cl_t<Container>* = nullptr>
+          require_not_matrix_cl_t<Container>* = nullptr,
+          require_not_var_matrix_t<Container>* = nullptr>
 inline auto log(const Container& x) {
   return apply_scalar_unary<log_fun, Container>::apply(x);
 }
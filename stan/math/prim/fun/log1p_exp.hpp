@@ -72,7 +72,7 @@ struct log1p_exp_fun {
  * @param x container
  * @return Natural log of (1 + exp()) applied to each value in x.
  */
-template <typename T>
+template <typename T, require_not_var_matrix_t<T>* = nullptr>
 inline auto log1p_exp(const T& x) {
   return apply_scalar_unary<log1p_exp_fun, T>::apply(x);
 }
@@ -3,6 +3,7 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
 #include <vector>
 #include <cmath>
 
@@ -35,35 +36,31 @@ class matrix_exp_action_handler {
     return m.colwise().lpNorm<1>().maxCoeff();
   }
 
- public:
   /**
-   * Perform the matrix exponential action exp(A*t)*B
-   * @param [in] mat matrix A
+   * Perform the truncated Taylor series with scaling for exp(A*t)*B,
+   * where the shift mu has already been subtracted from the diagonal of
+   * A.
+   *
+   * @param [in] A shifted matrix A - mu*I
+   * @param [in] mu shift of the diagonal
    * @param [in] b matrix B
    * @param [in] t double t, e.g. time.
+   * @param [in] m degree of the Taylor series
+   * @param [in] s number of scaling steps
    * @return matrix exp(A*t)*B
    */
-  template <typename EigMat1, typename EigMat2,
-            require_all_eigen_t<EigMat1, EigMat2>* = nullptr,
-            require_all_st_same<double, EigMat1, EigMat2>* = nullptr>
-  inline Eigen::MatrixXd action(const EigMat1& mat, const EigMat2& b,
-                                const double& t = 1.0) {
-    Eigen::MatrixXd A = mat;
-    double mu = A.trace() / A.rows();
-    for (int i = 0; i < A.rows(); ++i) {
-      A(i, i) -= mu;
-    }
-
-    int m{0}, s{0};
-    set_approximation_parameter(A, t, m, s);
-
+  template <typename EigMat>
+  inline Eigen::MatrixXd shifted_action(const Eigen::MatrixXd& A, double mu,
+                                        const EigMat& b, double t, int m,
+                                        int s) {
     Eigen::MatrixXd res(A.rows(), b.cols());
 
     for (int col = 0; col < b.cols(); ++col) {
-      bool conv = false;
       Eigen::VectorXd B = b.col(col);
       Eigen::VectorXd F = B;
       const auto eta = std::exp(t * mu / s);
+      // the series of each of the s scaling steps may converge early, but
+      // all of the steps must be taken
       for (int i = 1; i < s + 1; ++i) {
         auto c1 = B.template lpNorm<Eigen::Infinity>();
         if (m > 0) {
@@ -72,7 +69,6 @@ class matrix_exp_action_handler {
             auto c2 = B.template lpNorm<Eigen::Infinity>();
             F += B;
             if (c1 + c2 < tol * F.template lpNorm<Eigen::Infinity>()) {
-              conv = true;
               break;
             }
             c1 = c2;
@@ -80,15 +76,101 @@ class matrix_exp_action_handler {
         }
         F *= eta;
         B = F;
-        if (conv) {
-          break;
-        }
       }
       res.col(col) = F;
     }  // loop b columns
     return res;
   }
 
+ public:
+  /**
+   * Perform the matrix exponential action exp(A*t)*B
+   * @param [in] mat matrix A
+   * @param [in] b matrix B
+   * @param [in] t double t, e.g. time.
+   * @return matrix exp(A*t)*B
+   */
+  template <typename EigMat1, typename EigMat2,
+            require_all_eigen_t<EigMat1, EigMat2>* = nullptr,
+            require_all_st_same<double, EigMat1, EigMat2>* = nullptr>
+  inline Eigen::MatrixXd action(const EigMat1& mat, const EigMat2& b,
+                                const double& t = 1.0) {
+    Eigen::MatrixXd A = mat;
+    double mu = A.trace() / A.rows();
+    for (int i = 0; i < A.rows(); ++i) {
+      A(i, i) -= mu;
+    }
+
+    int m{0}, s{0};
+    set_approximation_parameter(A, t, m, s);
+
+    return shifted_action(A, mu, b, t, m, s);
+  }
+
+  /**
+   * Perform the matrix exponential actions exp(A*t)*B for several
+   * times t.
+   *
+   * The times are visited in increasing order and each action is
+   * computed from the previous one, exp(A*t_i)*B =
+   * exp(A*(t_i - t_{i-1}))*exp(A*t_{i-1})*B, so that every step only
+   * needs the scaling of its own, usually short, time step. The shift of
+   * A and the norm estimate used to choose the scaling are computed once
+   * for all times.
+   *
+   * @param [in] mat matrix A
+   * @param [in] b matrix B
+   * @param [in] ts non-negative times
+   * @return matrices exp(A*t)*B, in the order of the times
+   */
+  template <typename EigMat1, typename EigMat2,
+            require_all_eigen_t<EigMat1, EigMat2>* = nullptr,
+            require_all_st_same<double, EigMat1, EigMat2>* = nullptr>
+  inline std::vector<Eigen::MatrixXd> action(const EigMat1& mat,
+                                             const EigMat2& b,
+                                             const std::vector<double>& ts) {
+    Eigen::MatrixXd A = mat;
+    double mu = A.trace() / A.rows();
+    for (int i = 0; i < A.rows(); ++i) {
+      A(i, i) -= mu;
+    }
+
+    // ||(A*t)^p_max||^(1/p_max) = t * ||A^p_max||^(1/p_max)
+    const bool small_norm = l1norm(A) < tol;
+    double ap = 0;
+    if (!small_norm) {
+      Eigen::MatrixXd a = A;
+      for (auto i = 0; i < std::ceil(std::log2(p_max)); ++i) {
+        a *= a;
+      }
+      ap = std::pow(l1norm(a), 1.0 / p_max);
+    }
+
+    std::vector<size_t> order(ts.size());
+    for (size_t i = 0; i < ts.size(); ++i) {
+      order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&ts](size_t i, size_t j) { return ts[i] < ts[j]; });
+
+    std::vector<Eigen::MatrixXd> res(ts.size());
+    Eigen::MatrixXd F = b;
+    double t_prev = 0;
+    for (size_t i : order) {
+      const double dt = ts[i] - t_prev;
+      int m{0}, s{1};
+      if (!small_norm && dt >= tol) {
+        m = m_max;
+        const int c = std::ceil(dt * ap / theta_m_double_precision.back());
+        s = (c < 1 ? 1 : c);
+      }
+      F = shifted_action(A, mu, F, dt, m, s);
+      res[i] = F;
+      t_prev = ts[i];
+    }
+    return res;
+  }
+
   /**
    * Approximation is based on parameter "m" and "s",
    * proposed in CODE FRAGMENT 3.1 of the reference. The
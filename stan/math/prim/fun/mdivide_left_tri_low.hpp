@@ -3,7 +3,9 @@
 
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/batched_matrix_ops.hpp>
 #include <stan/math/prim/fun/mdivide_left_tri.hpp>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -51,6 +53,49 @@ inline plain_type_t<T> mdivide_left_tri_low(const T& A) {
   return mdivide_left_tri<Eigen::Lower>(A);
 }
 
+/**
+ * Return the results of left dividing a batch of dividends by a batch of
+ * lower triangular divisors, `A[k]^-1 * b[k]`.
+ *
+ * The matrices of each batch must all have the same size. The systems are
+ * solved in a single pass over a layout that stores each element of all
+ * matrices contiguously, which vectorizes across the batch and is faster
+ * than separate solves for small matrices.
+ *
+ * @tparam T1 type of the divisor matrices
+ * @tparam T2 type of the dividend matrices or vectors
+ * @param A batch of divisors, lower triangular square matrices
+ * @param b batch of dividends
+ * @return batch of left divisions
+ * @throws std::invalid_argument if the batches have different sizes, the
+ *   matrices of a batch differ in size, the divisors are not square or
+ *   the dividends do not have as many rows as the divisors have columns
+ */
+template <typename T1, typename T2,
+          require_all_eigen_vt<std::is_arithmetic, T1, T2>* = nullptr>
+inline std::vector<
+    Eigen::Matrix<double, T1::RowsAtCompileTime, T2::ColsAtCompileTime>>
+mdivide_left_tri_low(const std::vector<T1>& A, const std::vector<T2>& b) {
+  using ret_t
+      = Eigen::Matrix<double, T1::RowsAtCompileTime, T2::ColsAtCompileTime>;
+  check_size_match("mdivide_left_tri_low", "size of A", A.size(), "size of b",
+                   b.size());
+  if (A.empty()) {
+    return {};
+  }
+  internal::check_batch_sizes("mdivide_left_tri_low", "A", A);
+  internal::check_batch_sizes("mdivide_left_tri_low", "b", b);
+  check_square("mdivide_left_tri_low", "A", A[0]);
+  check_multiplicable("mdivide_left_tri_low", "A", A[0], "b", b[0]);
+  const Eigen::Index n = A[0].rows();
+  const Eigen::Index q = b[0].cols();
+  Eigen::MatrixXd x(A.size(), n * q);
+  internal::batch_tri_low_solve(internal::to_batch(A).template cast<double>(),
+                                internal::to_batch(b).template cast<double>(),
+                                n, q, x);
+  return internal::from_batch<ret_t>(x, n, q);
+}
+
 }  // namespace math
 }  // namespace stan
 
@@ -4,11 +4,13 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/batched_matrix_ops.hpp>
 #include <stan/math/prim/fun/dot_product.hpp>
 #ifdef STAN_OPENCL
 #include <stan/math/opencl/opencl.hpp>
 #endif
 #include <type_traits>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -148,6 +150,47 @@ inline return_type_t<Scalar1, Scalar2> multiply(Scalar1 m, Scalar2 c) {
   return c * m;
 }
 
+/**
+ * Return the products of two batches of matrices, `A[k] * B[k]`.
+ *
+ * The matrices of each batch must all have the same size. The products
+ * are computed in a single pass over a layout that stores each element of
+ * all matrices contiguously, which vectorizes across the batch and is
+ * faster than separate products for small matrices.
+ *
+ * @tparam EigMat1 type of the left matrices
+ * @tparam EigMat2 type of the right matrices
+ * @param A batch of left matrices
+ * @param B batch of right matrices
+ * @return batch of products
+ * @throw std::invalid_argument if the batches have different sizes, the
+ *   matrices of a batch differ in size or the matrices are not
+ *   multiplicable
+ */
+template <typename EigMat1, typename EigMat2,
+          require_all_eigen_vt<std::is_arithmetic, EigMat1, EigMat2>* = nullptr>
+inline std::vector<Eigen::Matrix<double, EigMat1::RowsAtCompileTime,
+                                 EigMat2::ColsAtCompileTime>>
+multiply(const std::vector<EigMat1>& A, const std::vector<EigMat2>& B) {
+  using ret_t = Eigen::Matrix<double, EigMat1::RowsAtCompileTime,
+                              EigMat2::ColsAtCompileTime>;
+  check_size_match("multiply", "size of A", A.size(), "size of B", B.size());
+  if (A.empty()) {
+    return {};
+  }
+  internal::check_batch_sizes("multiply", "A", A);
+  internal::check_batch_sizes("multiply", "B", B);
+  check_multiplicable("multiply", "A", A[0], "B", B[0]);
+  const Eigen::Index m = A[0].rows();
+  const Eigen::Index p = A[0].cols();
+  const Eigen::Index q = B[0].cols();
+  Eigen::MatrixXd C(A.size(), m * q);
+  internal::batch_multiply(internal::to_batch(A).template cast<double>(),
+                           internal::to_batch(B).template cast<double>(), m, p,
+                           q, C);
+  return internal::from_batch<ret_t>(C, m, q);
+}
+
 }  // namespace math
 }  // namespace stan
 
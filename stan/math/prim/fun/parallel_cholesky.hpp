@@ -0,0 +1,175 @@
+#ifndef STAN_MATH_PRIM_FUN_PARALLEL_CHOLESKY_HPP
+#define STAN_MATH_PRIM_FUN_PARALLEL_CHOLESKY_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
+#ifdef STAN_THREADS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+namespace stan {
+namespace math {
+
+/**
+ * Tuning parameters of the blocked Cholesky factorization, its reverse
+ * mode adjoint and the triangular solves paired with it.
+ *
+ * The defaults reproduce the block sizes used before the blocked
+ * algorithms were parallelized. Other values can be passed to
+ * `cholesky_decompose()`, for example from a benchmark. The updates are
+ * only split across TBB tasks when `STAN_THREADS` is defined.
+ */
+struct cholesky_tuning {
+  /**
+   * Size of the diagonal blocks. Zero selects
+   * `min(max(M / 8, 8), 128)` for a matrix with `M` rows.
+   */
+  int block_size = 0;
+  /**
+   * Matrices with at least this many rows are factored with the blocked
+   * algorithm and their updates are split across TBB tasks.
+   */
+  int parallel_size = 512;
+  /**
+   * Minimum number of rows or columns handled by one TBB task.
+   */
+  int grain_size = 64;
+};
+
+/**
+ * Return the size of the diagonal blocks used by the blocked Cholesky
+ * algorithms for a matrix with the specified number of rows.
+ *
+ * @param M number of rows
+ * @param opts tuning parameters
+ * @return block size
+ */
+inline int cholesky_block_size(
+    int M, const cholesky_tuning& opts = cholesky_tuning()) {
+  if (opts.block_size > 0) {
+    return opts.block_size;
+  }
+  return std::min(std::max(M / 8, 8), 128);
+}
+
+namespace internal {
+/**
+ * Call `f(start, size)` on consecutive ranges covering `[0, n)`. When
+ * `STAN_THREADS` is defined, `parallel` is true and there is more than one
+ * grain of work the ranges are processed by TBB tasks, so `f` must only
+ * write to data owned by its range.
+ *
+ * @tparam F type of functor
+ * @param n number of elements
+ * @param parallel whether to split the work across TBB tasks
+ * @param grain_size minimum number of elements of a range
+ * @param f functor called with the start and size of each range
+ */
+template <typename F>
+inline void parallel_for_ranges(Eigen::Index n, bool parallel, int grain_size,
+                                const F& f) {
+#ifdef STAN_THREADS
+  const Eigen::Index grain = std::max(grain_size, 1);
+  if (parallel && n >= 2 * grain) {
+    tbb::parallel_for(tbb::blocked_range<Eigen::Index>(0, n, grain),
+                      [&f](const tbb::blocked_range<Eigen::Index>& r) {
+                        f(r.begin(), r.end() - r.begin());
+                      });
+    return;
+  }
+#endif
+  f(Eigen::Index(0), n);
+}
+
+/**
+ * Solve the triangular system `op(A) * X = B` in place of `B`, where
+ * `op(A)` is `A` or its transpose. The columns of `B` are independent, so
+ * for large systems they are solved in parallel.
+ *
+ * @tparam TriView `Eigen::Lower` or `Eigen::Upper`
+ * @tparam Transpose whether to solve with the transpose of `A`
+ * @tparam EigMat1 type of the triangular matrix
+ * @tparam EigMat2 type of the right-hand side
+ * @param A triangular matrix, only the `TriView` part is used
+ * @param[in,out] B right-hand side on input, solution on output
+ * @param opts tuning parameters
+ */
+template <Eigen::UpLoType TriView, bool Transpose = false, typename EigMat1,
+          typename EigMat2>
+inline void tri_solve_in_place(const EigMat1& A, EigMat2&& B,
+                               const cholesky_tuning& opts
+                               = cholesky_tuning()) {
+  const bool parallel = A.rows() >= opts.parallel_size;
+  parallel_for_ranges(B.cols(), parallel, opts.grain_size,
+                      [&A, &B](Eigen::Index start, Eigen::Index size) {
+                        auto B_cols = B.middleCols(start, size);
+                        if (Transpose) {
+                          A.template triangularView<TriView>()
+                              .transpose()
+                              .solveInPlace(B_cols);
+                        } else {
+                          A.template triangularView<TriView>().solveInPlace(
+                              B_cols);
+                        }
+                      });
+}
+
+/**
+ * Compute the lower Cholesky factor of a symmetric positive definite
+ * matrix in place with a right-looking blocked algorithm.
+ *
+ * Each diagonal block is factored with `Eigen::LLT`. The panel below it is
+ * then solved and the trailing submatrix is updated, both split across
+ * TBB tasks by rows and columns respectively. Only the lower triangle of
+ * `A` is read; the strictly upper triangle is left unspecified.
+ *
+ * @param[in,out] A symmetric matrix on input, Cholesky factor in its lower
+ * triangle on output
+ * @param opts tuning parameters
+ * @return false if the matrix is not positive definite
+ */
+inline bool cholesky_blocked_in_place(Eigen::Ref<Eigen::MatrixXd> A,
+                                      const cholesky_tuning& opts
+                                      = cholesky_tuning()) {
+  using Eigen::Index;
+  const Index M = A.rows();
+  const Index b = cholesky_block_size(M, opts);
+  const bool parallel = M >= opts.parallel_size;
+  for (Index k = 0; k < M; k += b) {
+    const Index kb = std::min(b, M - k);
+    const Index rest = M - k - kb;
+    Eigen::Ref<Eigen::MatrixXd> A11 = A.block(k, k, kb, kb);
+    Eigen::LLT<Eigen::Ref<Eigen::MatrixXd>> llt(A11);
+    if (llt.info() != Eigen::Success || !(A11.diagonal().array() > 0.0).all()) {
+      return false;
+    }
+    if (rest == 0) {
+      break;
+    }
+    auto A21 = A.block(k + kb, k, rest, kb);
+    auto A22 = A.block(k + kb, k + kb, rest, rest);
+    // A21 = A21 * L11^-T, row by row
+    parallel_for_ranges(
+        rest, parallel, opts.grain_size, [&](Index start, Index size) {
+          auto rows = A21.middleRows(start, size);
+          A11.template triangularView<Eigen::Lower>()
+              .transpose()
+              .template solveInPlace<Eigen::OnTheRight>(rows);
+        });
+    // lower triangle of A22 -= A21 * A21^T, column block by column block
+    parallel_for_ranges(
+        rest, parallel, opts.grain_size, [&](Index start, Index size) {
+          A22.block(start, start, rest - start, size).noalias()
+              -= A21.bottomRows(rest - start)
+                 * A21.middleRows(start, size).transpose();
+        });
+  }
+  return true;
+}
+}  // namespace internal
+
+}  // namespace math
+}  // namespace stan
+#endif
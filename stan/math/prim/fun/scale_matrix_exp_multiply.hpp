@@ -6,6 +6,7 @@
 #include <stan/math/prim/fun/matrix_exp.hpp>
 #include <stan/math/prim/fun/matrix_exp_action_handler.hpp>
 #include <stan/math/prim/fun/multiply.hpp>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -67,6 +68,80 @@ scale_matrix_exp_multiply(const Tt& t, const EigMat1& A, const EigMat2& B) {
   return multiply(matrix_exp(multiply(A, t)), B);
 }
 
+/**
+ * Return the products of exp(At) and B for each of the specified times
+ * t, where A is a NxN double matrix and B is a NxCb double matrix.
+ *
+ * The actions are computed in order of increasing time, each one from
+ * the previous one, with the shift and norm estimates of A shared by all
+ * times. This makes many time points cost little more than the longest
+ * one.
+ *
+ * @tparam EigMat1 type of the first matrix
+ * @tparam EigMat2 type of the second matrix
+ *
+ * @param[in] ts non-negative times
+ * @param[in] A Matrix
+ * @param[in] B Matrix
+ * @return exponential of At multiplied by B, for each t in ts
+ * @throw std::domain_error if a time is negative or not finite
+ */
+template <typename EigMat1, typename EigMat2,
+          require_all_eigen_vt<std::is_arithmetic, EigMat1, EigMat2>* = nullptr>
+inline std::vector<
+    Eigen::Matrix<double, Eigen::Dynamic, EigMat2::ColsAtCompileTime>>
+scale_matrix_exp_multiply(const std::vector<double>& ts, const EigMat1& A,
+                          const EigMat2& B) {
+  using ret_t
+      = Eigen::Matrix<double, Eigen::Dynamic, EigMat2::ColsAtCompileTime>;
+  check_square("scale_matrix_exp_multiply", "input matrix", A);
+  check_multiplicable("scale_matrix_exp_multiply", "A", A, "B", B);
+  check_nonnegative("scale_matrix_exp_multiply", "times", ts);
+  check_finite("scale_matrix_exp_multiply", "times", ts);
+  if (A.size() == 0) {
+    return std::vector<ret_t>(ts.size(), ret_t(0, B.cols()));
+  }
+
+  std::vector<Eigen::MatrixXd> res
+      = matrix_exp_action_handler().action(A, B, ts);
+  return std::vector<ret_t>(res.begin(), res.end());
+}
+
+/**
+ * Return the products of exp(At) and B for each of the specified times
+ * t, where A is a NxN matrix and B is a NxCb matrix.
+ *
+ * Generic implementation for forward mode, which computes each product
+ * separately.
+ *
+ * @tparam Tt type of the times
+ * @tparam EigMat1 type of the first matrix
+ * @tparam EigMat2 type of the second matrix
+ * @param[in] ts non-negative times
+ * @param[in] A Matrix
+ * @param[in] B Matrix
+ * @return exponential of At multiplied by B, for each t in ts
+ * @throw std::domain_error if a time is negative or not finite
+ */
+template <typename Tt, typename EigMat1, typename EigMat2,
+          require_all_eigen_t<EigMat1, EigMat2>* = nullptr,
+          require_any_st_fvar<Tt, EigMat1, EigMat2>* = nullptr>
+inline std::vector<Eigen::Matrix<return_type_t<Tt, EigMat1, EigMat2>,
+                                 Eigen::Dynamic, EigMat2::ColsAtCompileTime>>
+scale_matrix_exp_multiply(const std::vector<Tt>& ts, const EigMat1& A,
+                          const EigMat2& B) {
+  check_nonnegative("scale_matrix_exp_multiply", "times", ts);
+  check_finite("scale_matrix_exp_multiply", "times", ts);
+  std::vector<Eigen::Matrix<return_type_t<Tt, EigMat1, EigMat2>,
+                            Eigen::Dynamic, EigMat2::ColsAtCompileTime>>
+      res;
+  res.reserve(ts.size());
+  for (const auto& t : ts) {
+    res.emplace_back(scale_matrix_exp_multiply(t, A, B));
+  }
+  return res;
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,157 @@
+#ifndef STAN_MATH_PRIM_FUN_SPECTRAL_DECOMPOSITION_HPP
+#define STAN_MATH_PRIM_FUN_SPECTRAL_DECOMPOSITION_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <algorithm>
+#ifdef STAN_THREADS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+namespace stan {
+namespace math {
+
+/**
+ * Tuning parameters of the symmetric eigendecompositions and singular
+ * value decompositions used by the reverse mode `eigenvalues_sym()`,
+ * `eigenvectors_sym()`, `singular_values()`, `svd_U()` and `svd_V()`.
+ *
+ * Other values can be passed to these functions, for example from a
+ * benchmark. The products are only split across TBB tasks when
+ * `STAN_THREADS` is defined.
+ */
+struct spectral_tuning {
+  /**
+   * Matrices with at least this many rows and columns are decomposed
+   * with Eigen's divide and conquer SVD instead of the QR iterations of
+   * `SelfAdjointEigenSolver` or the one-sided Jacobi SVD, and the
+   * matrix products of their adjoints are split across TBB tasks.
+   */
+  int divide_conquer_size = 500;
+  /**
+   * Minimum number of columns of a matrix product handled by one TBB
+   * task.
+   */
+  int grain_size = 64;
+};
+
+namespace internal {
+/**
+ * Return whether a matrix with the specified dimensions is large enough
+ * to use the divide and conquer decompositions and parallel products.
+ *
+ * @param rows number of rows
+ * @param cols number of columns
+ * @param opts tuning parameters
+ * @return whether the matrix is large
+ */
+inline bool use_divide_conquer(Eigen::Index rows, Eigen::Index cols,
+                               const spectral_tuning& opts) {
+  return std::min(rows, cols) >= opts.divide_conquer_size;
+}
+
+/**
+ * Compute the eigenvalues, in increasing order, and the eigenvectors of
+ * the specified symmetric matrix.
+ *
+ * <p>Large matrices are shifted by a multiple of the identity to make
+ * them positive definite, so that their singular value decomposition
+ * computed by `Eigen::BDCSVD` is also their eigendecomposition. The shift
+ * is the infinity norm of the matrix, which bounds its spectral radius,
+ * so the absolute accuracy of the eigenvalues is the same as that of the
+ * QR iterations.
+ *
+ * @param m symmetric matrix
+ * @param[out] eigenvalues eigenvalues in increasing order
+ * @param[out] eigenvectors corresponding eigenvectors as columns
+ * @param opts tuning parameters
+ */
+inline void eigendecompose_sym(const Eigen::MatrixXd& m,
+                               Eigen::VectorXd& eigenvalues,
+                               Eigen::MatrixXd& eigenvectors,
+                               const spectral_tuning& opts
+                               = spectral_tuning()) {
+  const double shift = m.cwiseAbs().rowwise().sum().maxCoeff();
+  if (!use_divide_conquer(m.rows(), m.cols(), opts) || !(shift > 0)) {
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(m);
+    eigenvalues = solver.eigenvalues();
+    eigenvectors = solver.eigenvectors();
+    return;
+  }
+  Eigen::MatrixXd shifted = m;
+  shifted.diagonal().array() += shift;
+  Eigen::BDCSVD<Eigen::MatrixXd> svd(shifted, Eigen::ComputeThinU);
+  eigenvalues = svd.singularValues().reverse().array() - shift;
+  eigenvectors = svd.matrixU().rowwise().reverse();
+}
+
+/**
+ * Compute the thin singular value decomposition `m = U * diag(D) * V^T`
+ * of the specified matrix, with the singular values in decreasing order.
+ *
+ * @param m matrix
+ * @param[out] D singular values
+ * @param[out] U left singular vectors
+ * @param[out] V right singular vectors
+ * @param opts tuning parameters
+ */
+inline void singular_value_decompose(const Eigen::MatrixXd& m,
+                                     Eigen::VectorXd& D, Eigen::MatrixXd& U,
+                                     Eigen::MatrixXd& V,
+                                     const spectral_tuning& opts
+                                     = spectral_tuning()) {
+  if (use_divide_conquer(m.rows(), m.cols(), opts)) {
+    Eigen::BDCSVD<Eigen::MatrixXd> svd(
+        m, Eigen::ComputeThinU | Eigen::ComputeThinV);
+    D = svd.singularValues();
+    U = svd.matrixU();
+    V = svd.matrixV();
+  } else {
+    Eigen::JacobiSVD<Eigen::MatrixXd> svd(
+        m, Eigen::ComputeThinU | Eigen::ComputeThinV);
+    D = svd.singularValues();
+    U = svd.matrixU();
+    V = svd.matrixV();
+  }
+}
+
+/**
+ * Return the product of the specified matrices. When `STAN_THREADS` is
+ * defined the columns of the product of large matrices are computed in
+ * parallel by TBB tasks.
+ *
+ * @tparam EigMat1 type of the first matrix
+ * @tparam EigMat2 type of the second matrix
+ * @param A first matrix
+ * @param B second matrix
+ * @param opts tuning parameters
+ * @return product `A * B`
+ */
+template <typename EigMat1, typename EigMat2>
+inline Eigen::MatrixXd spectral_multiply(const EigMat1& A, const EigMat2& B,
+                                         const spectral_tuning& opts
+                                         = spectral_tuning()) {
+  Eigen::MatrixXd res(A.rows(), B.cols());
+#ifdef STAN_THREADS
+  const Eigen::Index grain = std::max(opts.grain_size, 1);
+  if (use_divide_conquer(A.rows(), A.cols(), opts)
+      && B.cols() >= 2 * grain) {
+    tbb::parallel_for(tbb::blocked_range<Eigen::Index>(0, B.cols(), grain),
+                      [&](const tbb::blocked_range<Eigen::Index>& r) {
+                        const Eigen::Index size = r.end() - r.begin();
+                        res.middleCols(r.begin(), size).noalias()
+                            = A * B.middleCols(r.begin(), size);
+                      });
+    return res;
+  }
+#endif
+  res.noalias() = A * B;
+  return res;
+}
+}  // namespace internal
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef STAN_MATH_PRIM_FUN_SVD_U_HPP
+#define STAN_MATH_PRIM_FUN_SVD_U_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Given input matrix m, return the matrix U where `m = U * D * V^T` is
+ * the thin singular value decomposition of m, with the singular values
+ * in D in decreasing order. The columns of U are the left singular
+ * vectors of m.
+ *
+ * @tparam EigMat type of the matrix
+ * @param m MxN input matrix
+ * @return U, a MxK matrix with K = min(M, N)
+ */
+template <typename EigMat, require_eigen_matrix_dynamic_t<EigMat>* = nullptr,
+          require_not_st_var<EigMat>* = nullptr>
+Eigen::Matrix<value_type_t<EigMat>, Eigen::Dynamic, Eigen::Dynamic> svd_U(
+    const EigMat& m) {
+  using MatType = Eigen::Matrix<value_type_t<EigMat>, Eigen::Dynamic,
+                                Eigen::Dynamic>;
+  check_nonzero_size("svd_U", "m", m);
+
+  return Eigen::JacobiSVD<MatType>(m, Eigen::ComputeThinU).matrixU();
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
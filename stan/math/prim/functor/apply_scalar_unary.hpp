@@ -2,9 +2,14 @@
 #define STAN_MATH_PRIM_FUNCTOR_APPLY_SCALAR_UNARY_HPP
 
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/meta/bool_constant.hpp>
+#include <stan/math/prim/meta/conjunction.hpp>
 #include <stan/math/prim/meta/is_eigen.hpp>
+#include <stan/math/prim/meta/is_var.hpp>
 #include <stan/math/prim/meta/is_vector.hpp>
 #include <stan/math/prim/meta/is_vector_like.hpp>
+#include <stan/math/prim/meta/void_t.hpp>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -37,20 +42,57 @@ namespace math {
 template <typename F, typename T, typename Enable = void>
 struct apply_scalar_unary;
 
+/**
+ * Derivative of the unary function defined by the template class
+ * <code>F</code>, used by the reverse mode library to apply it to Eigen
+ * matrices of `var` with a single node on the autodiff stack.
+ *
+ * <p>Specializations define the function
+ * <code>static double partial(double x, double f_x)</code>, which returns
+ * the derivative of the function at <code>x</code>, where
+ * <code>f_x</code> is the value of the function at <code>x</code>.
+ * Functions without a specialization are applied to each `var`
+ * separately. The specialization must be declared with the reverse mode
+ * overload of the function, before it is applied to any Eigen matrix of
+ * `var`.
+ *
+ * @tparam F Type of function.
+ */
+template <typename F>
+struct apply_scalar_unary_partial {};
+
+namespace internal {
+template <typename F, typename = void>
+struct has_apply_scalar_unary_partial : std::false_type {};
+
+template <typename F>
+struct has_apply_scalar_unary_partial<
+    F, void_t<decltype(apply_scalar_unary_partial<F>::partial(0.0, 0.0))>>
+    : std::true_type {};
+}  // namespace internal
+
 /**
  *
  * Template specialization for vectorized functions applying to
- * Eigen matrix arguments.
+ * Eigen matrix arguments. Eigen matrices of `var` for functions with
+ * a specialization of <code>apply_scalar_unary_partial</code> are
+ * handled by the specialization in the reverse mode library.
  *
  * @tparam F Type of function to apply.
  * @tparam T Type of argument to which function is applied.
  */
 template <typename F, typename T>
-struct apply_scalar_unary<F, T, require_eigen_t<T>> {
+struct apply_scalar_unary<
+    F, T,
+    require_t<bool_constant<
+        is_eigen<T>::value
+        && !conjunction<
+            is_var<value_type_t<T>>,
+            internal::has_apply_scalar_unary_partial<F>>::value>>> {
   /**
    * Type of underlying scalar for the matrix type T.
    */
-  using scalar_t = typename Eigen::internal::traits<T>::Scalar;
+  using scalar_t = value_type_t<T>;
 
   /**
    * Return the result of applying the function defined by the
@@ -0,0 +1,31 @@
+#ifndef STAN_MATH_PRIM_FUNCTOR_PARALLEL_REGION_HPP
+#define STAN_MATH_PRIM_FUNCTOR_PARALLEL_REGION_HPP
+
+#include <stan/math/prim/meta.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the result of calling the specified functor with the specified
+ * arguments.
+ *
+ * This is the version for arguments without `var` scalars. Nothing is
+ * recorded on the autodiff stack, so the functor is called directly.
+ *
+ * @tparam F type of the functor
+ * @tparam Args types of the arguments
+ * @param f functor
+ * @param args arguments of the functor
+ * @return `f(args...)`
+ */
+template <typename F, typename... Args,
+          require_all_not_st_var<Args...>* = nullptr>
+inline auto parallel_region(const F& f, const Args&... args) {
+  return f(args...);
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef STAN_MATH_PRIM_META_IS_GLM_DESIGN_MATRIX_HPP
+#define STAN_MATH_PRIM_META_IS_GLM_DESIGN_MATRIX_HPP
+
+#include <stan/math/prim/meta/bool_constant.hpp>
+#include <stan/math/prim/meta/is_constant.hpp>
+#include <stan/math/prim/meta/is_eigen_dense_base.hpp>
+#include <stan/math/prim/meta/is_eigen_sparse_base.hpp>
+#include <stan/math/prim/meta/require_helpers.hpp>
+#include <stan/math/prim/meta/scalar_type.hpp>
+#include <stan/math/prim/meta/value_type.hpp>
+#include <type_traits>
+
+namespace stan {
+namespace math {
+class glm_design_matrix;
+}  // namespace math
+
+/** \ingroup type_trait
+ * Checks whether type `T` is a `glm_design_matrix`.
+ */
+template <typename T>
+struct is_glm_design_matrix
+    : std::is_same<std::decay_t<T>, math::glm_design_matrix> {};
+
+/** \ingroup type_trait
+ * Checks whether type `T` can be used as the design matrix of the GLM
+ * distributions: a dense Eigen matrix or row vector, an Eigen sparse matrix of
+ * data or a `glm_design_matrix`.
+ */
+template <typename T>
+struct is_glm_design
+    : bool_constant<is_eigen_dense_base<T>::value
+                    || (is_eigen_sparse_base<T>::value
+                        && std::is_arithmetic<value_type_t<T>>::value)
+                    || is_glm_design_matrix<T>::value> {};
+
+STAN_ADD_REQUIRE_UNARY(glm_design, is_glm_design, require_eigens_types);
+
+/** \ingroup type_trait
+ * The scalar type of a `glm_design_matrix` is `double`.
+ */
+template <typename T>
+struct scalar_type<T, std::enable_if_t<is_glm_design_matrix<T>::value>> {
+  using type = double;
+};
+
+/** \ingroup type_trait
+ * A `glm_design_matrix` is always data.
+ */
+template <typename T>
+struct is_constant<T, std::enable_if_t<is_glm_design_matrix<T>::value>>
+    : std::true_type {};
+
+}  // namespace stan
+
+#endif
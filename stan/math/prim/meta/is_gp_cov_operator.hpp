@@ -0,0 +1,34 @@
+#ifndef STAN_MATH_PRIM_META_IS_GP_COV_OPERATOR_HPP
+#define STAN_MATH_PRIM_META_IS_GP_COV_OPERATOR_HPP
+
+#include <stan/math/prim/meta/scalar_type.hpp>
+#include <type_traits>
+
+namespace stan {
+namespace math {
+template <typename Kernel, typename T>
+class gp_cov_operator;
+}  // namespace math
+
+/** \ingroup type_trait
+ * Checks whether type `T` is a `gp_cov_operator`.
+ */
+template <typename T>
+struct is_gp_cov_operator : std::false_type {};
+
+template <typename Kernel, typename T>
+struct is_gp_cov_operator<math::gp_cov_operator<Kernel, T>>
+    : std::true_type {};
+
+/** \ingroup type_trait
+ * The scalar type of a `gp_cov_operator` is the type of its parameters.
+ */
+template <typename T>
+struct scalar_type<
+    T, std::enable_if_t<is_gp_cov_operator<std::decay_t<T>>::value>> {
+  using type = typename std::decay_t<T>::value_type;
+};
+
+}  // namespace stan
+
+#endif
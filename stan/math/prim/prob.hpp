@@ -193,12 +193,14 @@
 #include <stan/math/prim/prob/multi_normal_cholesky_log.hpp>
 #include <stan/math/prim/prob/multi_normal_cholesky_lpdf.hpp>
 #include <stan/math/prim/prob/multi_normal_cholesky_rng.hpp>
+#include <stan/math/prim/prob/multi_normal_kronecker_lpdf.hpp>
 #include <stan/math/prim/prob/multi_normal_log.hpp>
 #include <stan/math/prim/prob/multi_normal_lpdf.hpp>
 #include <stan/math/prim/prob/multi_normal_prec_log.hpp>
 #include <stan/math/prim/prob/multi_normal_prec_lpdf.hpp>
 #include <stan/math/prim/prob/multi_normal_prec_rng.hpp>
 #include <stan/math/prim/prob/multi_normal_rng.hpp>
+#include <stan/math/prim/prob/multi_normal_toeplitz_lpdf.hpp>
 #include <stan/math/prim/prob/multi_student_t_log.hpp>
 #include <stan/math/prim/prob/multi_student_t_lpdf.hpp>
 #include <stan/math/prim/prob/multi_student_t_rng.hpp>
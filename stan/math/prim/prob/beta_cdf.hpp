@@ -5,6 +5,7 @@
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/inc_beta.hpp>
+#include <stan/math/prim/fun/inc_beta_dd.hpp>
 #include <stan/math/prim/fun/inc_beta_dda.hpp>
 #include <stan/math/prim/fun/inc_beta_ddb.hpp>
 #include <stan/math/prim/fun/inc_beta_ddz.hpp>
@@ -99,6 +100,9 @@ return_type_t<T_y, T_scale_succ, T_scale_fail> beta_cdf(
     }
   }
 
+  constexpr bool both_shapes = !is_constant_all<T_scale_succ>::value
+                               && !is_constant_all<T_scale_fail>::value;
+
   for (size_t n = 0; n < N; n++) {
     const T_partials_return y_dbl = value_of(y_vec[n]);
 
@@ -110,7 +114,15 @@ return_type_t<T_y, T_scale_succ, T_scale_fail> beta_cdf(
 
     const T_partials_return alpha_dbl = value_of(alpha_vec[n]);
     const T_partials_return beta_dbl = value_of(beta_vec[n]);
-    const T_partials_return Pn = inc_beta(alpha_dbl, beta_dbl, y_dbl);
+    // When both shape derivatives are needed they are accumulated in a
+    // single series that also yields the value of the incomplete beta
+    T_partials_return d_alpha(0);
+    T_partials_return d_beta(0);
+    const T_partials_return Pn
+        = both_shapes ? inc_beta_dd(alpha_dbl, beta_dbl, y_dbl,
+                                    digamma_alpha[n], digamma_beta[n],
+                                    digamma_sum[n], d_alpha, d_beta)
+                      : inc_beta(alpha_dbl, beta_dbl, y_dbl);
     const T_partials_return inv_Pn
         = is_constant_all<T_y, T_scale_succ, T_scale_fail>::value ? 0 : inv(Pn);
 
@@ -123,14 +135,16 @@ return_type_t<T_y, T_scale_succ, T_scale_fail> beta_cdf(
 
     if (!is_constant_all<T_scale_succ>::value) {
       ops_partials.edge2_.partials_[n]
-          += inc_beta_dda(alpha_dbl, beta_dbl, y_dbl, digamma_alpha[n],
-                          digamma_sum[n])
+          += (both_shapes ? d_alpha
+                          : inc_beta_dda(alpha_dbl, beta_dbl, y_dbl,
+                                         digamma_alpha[n], digamma_sum[n]))
              * inv_Pn;
     }
     if (!is_constant_all<T_scale_fail>::value) {
       ops_partials.edge3_.partials_[n]
-          += inc_beta_ddb(alpha_dbl, beta_dbl, y_dbl, digamma_beta[n],
-                          digamma_sum[n])
+          += (both_shapes ? d_beta
+                          : inc_beta_ddb(alpha_dbl, beta_dbl, y_dbl,
+                                         digamma_beta[n], digamma_sum[n]))
              * inv_Pn;
     }
   }
@@ -99,7 +99,8 @@ return_type_t<T_y, T_scale_succ, T_scale_fail> beta_lccdf(
     const T_partials_return alpha_dbl = value_of(alpha_vec[n]);
     const T_partials_return beta_dbl = value_of(beta_vec[n]);
     const T_partials_return betafunc_dbl = beta(alpha_dbl, beta_dbl);
-    const T_partials_return Pn = 1.0 - inc_beta(alpha_dbl, beta_dbl, y_dbl);
+    const T_partials_return inc_beta_dbl = inc_beta(alpha_dbl, beta_dbl, y_dbl);
+    const T_partials_return Pn = 1.0 - inc_beta_dbl;
     const T_partials_return inv_Pn
         = is_constant_all<T_y, T_scale_succ, T_scale_fail>::value ? 0 : inv(Pn);
 
@@ -116,7 +117,8 @@ return_type_t<T_y, T_scale_succ, T_scale_fail> beta_lccdf(
 
     if (!is_constant_all<T_scale_succ, T_scale_fail>::value) {
       grad_reg_inc_beta(g1, g2, alpha_dbl, beta_dbl, y_dbl, digamma_alpha[n],
-                        digamma_beta[n], digamma_sum[n], betafunc_dbl);
+                        digamma_beta[n], digamma_sum[n], betafunc_dbl,
+                        inc_beta_dbl);
     }
     if (!is_constant_all<T_scale_succ>::value) {
       ops_partials.edge2_.partials_[n] -= g1 * inv_Pn;
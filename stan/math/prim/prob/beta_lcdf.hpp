@@ -116,7 +116,7 @@ return_type_t<T_y, T_scale_succ, T_scale_fail> beta_lcdf(
 
     if (!is_constant_all<T_scale_succ, T_scale_fail>::value) {
       grad_reg_inc_beta(g1, g2, alpha_dbl, beta_dbl, y_dbl, digamma_alpha[n],
-                        digamma_beta[n], digamma_sum[n], betafunc_dbl);
+                        digamma_beta[n], digamma_sum[n], betafunc_dbl, Pn);
     }
     if (!is_constant_all<T_scale_succ>::value) {
       ops_partials.edge2_.partials_[n] += g1 * inv_Pn;
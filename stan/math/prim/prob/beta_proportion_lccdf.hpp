@@ -106,8 +106,9 @@ return_type_t<T_y, T_loc, T_prec> beta_proportion_lccdf(const T_y& y,
     const T_partials_return mukappa_dbl = mu_dbl * kappa_dbl;
     const T_partials_return kappa_mukappa_dbl = kappa_dbl - mukappa_dbl;
     const T_partials_return betafunc_dbl = beta(mukappa_dbl, kappa_mukappa_dbl);
-    const T_partials_return Pn
-        = 1 - inc_beta(mukappa_dbl, kappa_mukappa_dbl, y_dbl);
+    const T_partials_return inc_beta_dbl
+        = inc_beta(mukappa_dbl, kappa_mukappa_dbl, y_dbl);
+    const T_partials_return Pn = 1 - inc_beta_dbl;
 
     ccdf_log += log(Pn);
 
@@ -126,7 +127,7 @@ return_type_t<T_y, T_loc, T_prec> beta_proportion_lccdf(const T_y& y,
     if (!is_constant_all<T_loc, T_prec>::value) {
       grad_reg_inc_beta(g1, g2, mukappa_dbl, kappa_mukappa_dbl, y_dbl,
                         digamma_mukappa[n], digamma_kappa_mukappa[n],
-                        digamma_kappa[n], betafunc_dbl);
+                        digamma_kappa[n], betafunc_dbl, inc_beta_dbl);
     }
     if (!is_constant_all<T_loc>::value) {
       ops_partials.edge2_.partials_[n] -= kappa_dbl * (g1 - g2) * inv_Pn;
@@ -126,7 +126,7 @@ return_type_t<T_y, T_loc, T_prec> beta_proportion_lcdf(const T_y& y,
     if (!is_constant_all<T_loc, T_prec>::value) {
       grad_reg_inc_beta(g1, g2, mukappa_dbl, kappa_mukappa_dbl, y_dbl,
                         digamma_mukappa[n], digamma_kappa_mukappa[n],
-                        digamma_kappa[n], betafunc_dbl);
+                        digamma_kappa[n], betafunc_dbl, Pn);
     }
     if (!is_constant_all<T_loc>::value) {
       ops_partials.edge2_.partials_[n] += kappa_dbl * (g1 - g2) * inv_Pn;
@@ -4,6 +4,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/exp.hpp>
+#include <stan/math/prim/fun/glm_design_matrix.hpp>
 #include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/size.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
@@ -12,6 +13,7 @@
 #include <stan/math/prim/functor/operands_and_partials.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <cmath>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -29,6 +31,8 @@ namespace math {
  * classes, including endpoints.
  * @param x design matrix or row vector. If it is a row vector it will be
  * broadcast - used for all instances.
+ * Can also be an `Eigen::SparseMatrix` of data, in which case the cost is
+ * proportional to the number of nonzeros.
  * @param alpha intercept vector (in log odds)
  * @param beta weight matrix
  * @return log probability or log sum of probabilities
@@ -38,6 +42,7 @@ namespace math {
  */
 template <bool propto, typename T_y, typename T_x, typename T_alpha,
           typename T_beta, require_eigen_t<T_x>* = nullptr,
+          require_glm_design_t<T_x>* = nullptr,
           require_eigen_col_vector_t<T_alpha>* = nullptr,
           require_eigen_matrix_dynamic_t<T_beta>* = nullptr>
 return_type_t<T_x, T_alpha, T_beta> categorical_logit_glm_lpmf(
@@ -172,11 +177,25 @@ return_type_t<T_x, T_alpha, T_beta> categorical_logit_glm_lpmf(
         beta_derivative = x_val.transpose() * neg_softmax_lin.matrix();
       }
 
-      for (int i = 0; i < N_instances; i++) {
-        if (T_x_rows == 1) {
-          beta_derivative.col(y_seq[i] - 1) += x_val;
-        } else {
-          beta_derivative.col(y_seq[i] - 1) += x_val.row(i);
+      if (is_eigen_sparse_base<T_x>::value) {
+        // accessing rows of a column major sparse matrix is slow, so the
+        // indicators of the classes are collected in a sparse matrix instead
+        std::vector<Eigen::Triplet<T_partials_return>> y_triplets;
+        y_triplets.reserve(N_instances);
+        for (int i = 0; i < N_instances; i++) {
+          y_triplets.emplace_back(i, y_seq[i] - 1, 1);
+        }
+        Eigen::SparseMatrix<T_partials_return> y_indicator(N_instances,
+                                                           N_classes);
+        y_indicator.setFromTriplets(y_triplets.begin(), y_triplets.end());
+        beta_derivative += x_val.transpose() * y_indicator;
+      } else {
+        for (int i = 0; i < N_instances; i++) {
+          if (T_x_rows == 1) {
+            beta_derivative.col(y_seq[i] - 1) += x_val;
+          } else {
+            beta_derivative.col(y_seq[i] - 1) += x_val.row(i);
+          }
         }
       }
       // TODO(Tadej) maybe we can replace previous loop with the following line
@@ -7,7 +7,7 @@
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/exp.hpp>
 #include <stan/math/prim/fun/gamma_q.hpp>
-#include <stan/math/prim/fun/grad_reg_inc_gamma.hpp>
+#include <stan/math/prim/fun/gamma_q_dd.hpp>
 #include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
 #include <stan/math/prim/fun/size.hpp>
@@ -93,7 +93,12 @@ return_type_t<T_y, T_dof> chi_square_lccdf(const T_y& y, const T_dof& nu) {
     const T_partials_return alpha_dbl = value_of(nu_vec[n]) * 0.5;
     const T_partials_return beta_dbl = 0.5;
 
-    const T_partials_return Pn = gamma_q(alpha_dbl, beta_dbl * y_dbl);
+    T_partials_return d_alpha(0);
+    const T_partials_return Pn
+        = is_constant_all<T_dof>::value
+              ? gamma_q(alpha_dbl, beta_dbl * y_dbl)
+              : gamma_q_dd(alpha_dbl, beta_dbl * y_dbl, gamma_vec[n],
+                           digamma_vec[n], d_alpha);
 
     ccdf_log += log(Pn);
 
@@ -104,10 +109,7 @@ return_type_t<T_y, T_dof> chi_square_lccdf(const T_y& y, const T_dof& nu) {
     }
     if (!is_constant_all<T_dof>::value) {
       ops_partials.edge2_.partials_[n]
-          += 0.5
-             * grad_reg_inc_gamma(alpha_dbl, beta_dbl * y_dbl, gamma_vec[n],
-                                  digamma_vec[n])
-             / Pn;
+          += 0.5 * d_alpha / Pn;
     }
   }
   return ops_partials.build(ccdf_log);
@@ -37,10 +37,12 @@ inline typename VectorBuilder<true, double, T_inv>::type exponential_rng(
   size_t N = stan::math::size(beta);
   VectorBuilder<true, double, T_inv> output(N);
 
+  // One standard exponential generator is shared by all draws; the inverse
+  // scale is applied afterwards, exactly as exponential_distribution does
+  variate_generator<RNG&, exponential_distribution<> > std_exp_rng(
+      rng, exponential_distribution<>(1));
   for (size_t n = 0; n < N; ++n) {
-    variate_generator<RNG&, exponential_distribution<> > exp_rng(
-        rng, exponential_distribution<>(beta_vec[n]));
-    output[n] = exp_rng();
+    output[n] = std_exp_rng() / beta_vec[n];
   }
 
   return output.data();
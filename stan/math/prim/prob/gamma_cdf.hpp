@@ -7,7 +7,7 @@
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/exp.hpp>
 #include <stan/math/prim/fun/gamma_p.hpp>
-#include <stan/math/prim/fun/grad_reg_inc_gamma.hpp>
+#include <stan/math/prim/fun/gamma_p_dd.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
 #include <stan/math/prim/fun/multiply_log.hpp>
 #include <stan/math/prim/fun/size.hpp>
@@ -103,25 +103,30 @@ return_type_t<T_y, T_shape, T_inv_scale> gamma_cdf(const T_y& y,
     const T_partials_return alpha_dbl = value_of(alpha_vec[n]);
     const T_partials_return beta_dbl = value_of(beta_vec[n]);
 
-    const T_partials_return Pn = gamma_p(alpha_dbl, beta_dbl * y_dbl);
+    // The incomplete gamma function is evaluated once and shared with the
+    // derivative with respect to the shape
+    T_partials_return d_alpha(0);
+    const T_partials_return Pn
+        = is_constant_all<T_shape>::value
+              ? gamma_p(alpha_dbl, beta_dbl * y_dbl)
+              : gamma_p_dd(alpha_dbl, beta_dbl * y_dbl, gamma_vec[n],
+                           digamma_vec[n], d_alpha);
 
     P *= Pn;
 
-    if (!is_constant_all<T_y>::value) {
-      ops_partials.edge1_.partials_[n] += beta_dbl * exp(-beta_dbl * y_dbl)
-                                          * pow(beta_dbl * y_dbl, alpha_dbl - 1)
-                                          / tgamma(alpha_dbl) / Pn;
+    if (!is_constant_all<T_y, T_inv_scale>::value) {
+      const T_partials_return rep_deriv
+          = exp(-beta_dbl * y_dbl) * pow(beta_dbl * y_dbl, alpha_dbl - 1)
+            / tgamma(alpha_dbl) / Pn;
+      if (!is_constant_all<T_y>::value) {
+        ops_partials.edge1_.partials_[n] += beta_dbl * rep_deriv;
+      }
+      if (!is_constant_all<T_inv_scale>::value) {
+        ops_partials.edge3_.partials_[n] += y_dbl * rep_deriv;
+      }
     }
     if (!is_constant_all<T_shape>::value) {
-      ops_partials.edge2_.partials_[n]
-          -= grad_reg_inc_gamma(alpha_dbl, beta_dbl * y_dbl, gamma_vec[n],
-                                digamma_vec[n])
-             / Pn;
-    }
-    if (!is_constant_all<T_inv_scale>::value) {
-      ops_partials.edge3_.partials_[n] += y_dbl * exp(-beta_dbl * y_dbl)
-                                          * pow(beta_dbl * y_dbl, alpha_dbl - 1)
-                                          / tgamma(alpha_dbl) / Pn;
+      ops_partials.edge2_.partials_[n] += d_alpha / Pn;
     }
   }
 
@@ -48,6 +48,17 @@ inline typename VectorBuilder<true, double, T_shape, T_inv>::type gamma_rng(
   size_t N = max_size(alpha, beta);
   VectorBuilder<true, double, T_shape, T_inv> output(N);
 
+  if (stan::math::size(alpha) == 1) {
+    // With a single shape one unit scale generator is shared by all draws;
+    // the scale is applied afterwards, exactly as gamma_distribution does
+    variate_generator<RNG&, gamma_distribution<> > std_gamma_rng(
+        rng, gamma_distribution<>(alpha_vec[0], 1));
+    for (size_t n = 0; n < N; ++n) {
+      output[n] = std_gamma_rng() * (1 / static_cast<double>(beta_vec[n]));
+    }
+    return output.data();
+  }
+
   for (size_t n = 0; n < N; ++n) {
     // Convert rate (inverse scale) argument to scale for boost
     variate_generator<RNG&, gamma_distribution<> > gamma_rng(
@@ -7,7 +7,7 @@
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/exp.hpp>
 #include <stan/math/prim/fun/gamma_q.hpp>
-#include <stan/math/prim/fun/grad_reg_inc_gamma.hpp>
+#include <stan/math/prim/fun/gamma_q_dd.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
 #include <stan/math/prim/fun/size.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
@@ -91,7 +91,12 @@ return_type_t<T_y, T_dof> inv_chi_square_cdf(const T_y& y, const T_dof& nu) {
     const T_partials_return y_inv_dbl = 1.0 / y_dbl;
     const T_partials_return nu_dbl = value_of(nu_vec[n]);
 
-    const T_partials_return Pn = gamma_q(0.5 * nu_dbl, 0.5 * y_inv_dbl);
+    T_partials_return d_half_nu(0);
+    const T_partials_return Pn
+        = is_constant_all<T_dof>::value
+              ? gamma_q(0.5 * nu_dbl, 0.5 * y_inv_dbl)
+              : gamma_q_dd(0.5 * nu_dbl, 0.5 * y_inv_dbl, gamma_vec[n],
+                           digamma_vec[n], d_half_nu);
 
     P *= Pn;
 
@@ -103,10 +108,7 @@ return_type_t<T_y, T_dof> inv_chi_square_cdf(const T_y& y, const T_dof& nu) {
     }
     if (!is_constant_all<T_dof>::value) {
       ops_partials.edge2_.partials_[n]
-          += 0.5
-             * grad_reg_inc_gamma(0.5 * nu_dbl, 0.5 * y_inv_dbl, gamma_vec[n],
-                                  digamma_vec[n])
-             / Pn;
+          += 0.5 * d_half_nu / Pn;
     }
   }
 
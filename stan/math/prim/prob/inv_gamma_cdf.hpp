@@ -7,7 +7,7 @@
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/exp.hpp>
 #include <stan/math/prim/fun/gamma_q.hpp>
-#include <stan/math/prim/fun/grad_reg_inc_gamma.hpp>
+#include <stan/math/prim/fun/gamma_q_dd.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
 #include <stan/math/prim/fun/size.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
@@ -103,7 +103,12 @@ return_type_t<T_y, T_shape, T_scale> inv_gamma_cdf(const T_y& y,
     const T_partials_return alpha_dbl = value_of(alpha_vec[n]);
     const T_partials_return beta_dbl = value_of(beta_vec[n]);
 
-    const T_partials_return Pn = gamma_q(alpha_dbl, beta_dbl * y_inv_dbl);
+    T_partials_return d_alpha(0);
+    const T_partials_return Pn
+        = is_constant_all<T_shape>::value
+              ? gamma_q(alpha_dbl, beta_dbl * y_inv_dbl)
+              : gamma_q_dd(alpha_dbl, beta_dbl * y_inv_dbl, gamma_vec[n],
+                           digamma_vec[n], d_alpha);
 
     P *= Pn;
 
@@ -115,9 +120,7 @@ return_type_t<T_y, T_shape, T_scale> inv_gamma_cdf(const T_y& y,
     }
     if (!is_constant_all<T_shape>::value) {
       ops_partials.edge2_.partials_[n]
-          += grad_reg_inc_gamma(alpha_dbl, beta_dbl * y_inv_dbl, gamma_vec[n],
-                                digamma_vec[n])
-             / Pn;
+          += d_alpha / Pn;
     }
     if (!is_constant_all<T_scale>::value) {
       ops_partials.edge3_.partials_[n]
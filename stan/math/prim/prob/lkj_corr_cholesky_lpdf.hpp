@@ -3,10 +3,11 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/log.hpp>
-#include <stan/math/prim/fun/make_nu.hpp>
-#include <stan/math/prim/fun/multiply.hpp>
 #include <stan/math/prim/fun/to_ref.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/functor/operands_and_partials.hpp>
 #include <stan/math/prim/prob/lkj_corr_log.hpp>
 
 namespace stan {
@@ -14,13 +15,40 @@ namespace math {
 
 // LKJ_Corr(L|eta) [ L Cholesky factor of correlation matrix
 //                  eta > 0; eta == 1 <-> uniform]
+/** \ingroup multivar_dists
+ * The log of the LKJ density for the Cholesky factor of a correlation
+ * matrix given a shape parameter.
+ *
+ * Only the diagonal of the Cholesky factor enters the density, so the
+ * gradients are computed analytically and stored in a single node,
+ *
+ * \f[
+ * \frac{\partial}{\partial L_{kk}} \log p(L \,|\, \eta)
+ * = \frac{K - k - 1 + 2 \eta - 2}{L_{kk}},
+ * \f]
+ *
+ * for \f$k = 1, \ldots, K - 1\f$ (zero based), instead of building the
+ * density with scalar arithmetic.
+ *
+ * @tparam T_covar type of the Cholesky factor
+ * @tparam T_shape type of the shape parameter
+ * @param L Cholesky factor of a correlation matrix
+ * @param eta shape parameter
+ * @return log of the LKJ density
+ * @throw std::domain_error if eta is not positive or L is not lower
+ * triangular
+ */
 template <bool propto, typename T_covar, typename T_shape>
 return_type_t<T_covar, T_shape> lkj_corr_cholesky_lpdf(const T_covar& L,
                                                        const T_shape& eta) {
-  using lp_ret = return_type_t<T_covar, T_shape>;
+  using T_partials_return = partials_return_t<T_covar, T_shape>;
+  using T_partials_mat = Eigen::Matrix<T_partials_return, -1, -1>;
+  using T_L_ref = ref_type_t<T_covar>;
+  using T_eta_ref = ref_type_t<T_shape>;
   static const char* function = "lkj_corr_cholesky_lpdf";
-  const auto& L_ref = to_ref(L);
-  check_positive(function, "Shape parameter", eta);
+  T_L_ref L_ref = L;
+  T_eta_ref eta_ref = eta;
+  check_positive(function, "Shape parameter", eta_ref);
   check_lower_triangular(function, "Random variable", L_ref);
 
   const unsigned int K = L.rows();
@@ -28,28 +56,48 @@ return_type_t<T_covar, T_shape> lkj_corr_cholesky_lpdf(const T_covar& L,
     return 0.0;
   }
 
-  lp_ret lp(0.0);
+  const T_partials_return eta_val = value_of(eta_ref);
+  const int Km1 = K - 1;
+  T_partials_return lp(0.0);
+  T_partials_return d_eta(0.0);
+  operands_and_partials<T_L_ref, T_eta_ref> ops_partials(L_ref, eta_ref);
 
   if (include_summand<propto, T_shape>::value) {
-    lp += do_lkj_constant(eta, K);
+    lp += do_lkj_constant(eta_val, K);
+    if (!is_constant_all<T_shape>::value) {
+      d_eta += Km1 * digamma(eta_val + 0.5 * Km1);
+      for (int k = 1; k <= Km1; k++) {
+        d_eta -= digamma(eta_val + 0.5 * (Km1 - k));
+      }
+    }
   }
   if (include_summand<propto, T_covar, T_shape>::value) {
-    const int Km1 = K - 1;
-    Eigen::Matrix<value_type_t<T_covar>, Eigen::Dynamic, 1> log_diagonals
-        = log(L_ref.diagonal().tail(Km1).array());
-    Eigen::Matrix<lp_ret, Eigen::Dynamic, 1> values(Km1);
+    const Eigen::Matrix<T_partials_return, -1, 1> L_diag
+        = value_of(L_ref).diagonal().tail(Km1);
+    T_partials_mat d_L;
+    if (!is_constant_all<T_covar>::value) {
+      d_L = T_partials_mat::Zero(K, K);
+    }
     for (int k = 0; k < Km1; k++) {
-      values(k) = (Km1 - k - 1) * log_diagonals(k);
+      const T_partials_return log_diagonal = log(L_diag.coeff(k));
+      const T_partials_return coeff = (Km1 - k - 1) + 2.0 * eta_val - 2.0;
+      lp += coeff * log_diagonal;
+      if (!is_constant_all<T_covar>::value) {
+        d_L.coeffRef(k + 1, k + 1) = coeff / L_diag.coeff(k);
+      }
+      if (!is_constant_all<T_shape>::value) {
+        d_eta += 2.0 * log_diagonal;
+      }
     }
-    if (eta == 1.0 && is_constant_all<scalar_type<T_shape>>::value) {
-      lp += sum(values);
-      return (lp);
+    if (!is_constant_all<T_covar>::value) {
+      ops_partials.edge1_.partials_ = d_L;
     }
-    values += multiply(2.0 * eta - 2.0, log_diagonals);
-    lp += sum(values);
+  }
+  if (!is_constant_all<T_shape>::value) {
+    ops_partials.edge2_.partials_[0] = d_eta;
   }
 
-  return lp;
+  return ops_partials.build(lp);
 }
 
 template <typename T_covar, typename T_shape>
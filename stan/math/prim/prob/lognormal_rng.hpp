@@ -4,8 +4,9 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
-#include <boost/random/lognormal_distribution.hpp>
+#include <boost/random/normal_distribution.hpp>
 #include <boost/random/variate_generator.hpp>
+#include <cmath>
 
 namespace stan {
 namespace math {
@@ -32,7 +33,7 @@ template <typename T_loc, typename T_scale, class RNG>
 inline typename VectorBuilder<true, double, T_loc, T_scale>::type lognormal_rng(
     const T_loc& mu, const T_scale& sigma, RNG& rng) {
   using boost::variate_generator;
-  using boost::random::lognormal_distribution;
+  using boost::normal_distribution;
   using T_mu_ref = ref_type_t<T_loc>;
   using T_sigma_ref = ref_type_t<T_scale>;
   static const char* function = "lognormal_rng";
@@ -48,10 +49,12 @@ inline typename VectorBuilder<true, double, T_loc, T_scale>::type lognormal_rng(
   size_t N = max_size(mu, sigma);
   VectorBuilder<true, double, T_loc, T_scale> output(N);
 
+  // One standard normal generator is shared by all draws; location and
+  // scale are applied afterwards, exactly as lognormal_distribution does
+  variate_generator<RNG&, normal_distribution<> > std_normal_rng(
+      rng, normal_distribution<>(0, 1));
   for (size_t n = 0; n < N; ++n) {
-    variate_generator<RNG&, lognormal_distribution<> > lognorm_rng(
-        rng, lognormal_distribution<>(mu_vec[n], sigma_vec[n]));
-    output[n] = lognorm_rng();
+    output[n] = std::exp(std_normal_rng() * sigma_vec[n] + mu_vec[n]);
   }
 
   return output.data();
@@ -61,8 +61,8 @@ multi_normal_cholesky_rng(
   variate_generator<RNG&, normal_distribution<> > std_normal_rng(
       rng, normal_distribution<>(0, 1));
 
+  Eigen::VectorXd z(L.cols());
   for (size_t n = 0; n < N; ++n) {
-    Eigen::VectorXd z(L.cols());
     for (int i = 0; i < L.cols(); i++) {
       z(i) = std_normal_rng();
     }
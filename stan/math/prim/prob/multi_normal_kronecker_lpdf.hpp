@@ -0,0 +1,274 @@
+#ifndef STAN_MATH_PRIM_PROB_MULTI_NORMAL_KRONECKER_LPDF_HPP
+#define STAN_MATH_PRIM_PROB_MULTI_NORMAL_KRONECKER_LPDF_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/functor/operands_and_partials.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Multiply the specified vector in place by the Kronecker product
+ * `I_left ⊗ M ⊗ I_right`, where the identity matrices have `n_left` and
+ * `n_right` rows.
+ *
+ * The vector is viewed as `n_left` consecutive column major blocks with
+ * `n_right` rows and `M.cols()` columns, each of which is multiplied on
+ * the right by the transpose of `M`.
+ *
+ * @param M square matrix for the multiplied dimension
+ * @param n_left product of the sizes of the preceding dimensions
+ * @param n_right product of the sizes of the following dimensions
+ * @param[in,out] x vector to multiply
+ */
+inline void kronecker_mode_multiply(const Eigen::MatrixXd& M,
+                                    Eigen::Index n_left, Eigen::Index n_right,
+                                    Eigen::VectorXd& x) {
+  const Eigen::Index n = M.rows();
+  Eigen::MatrixXd block(n_right, n);
+  for (Eigen::Index l = 0; l < n_left; ++l) {
+    Eigen::Map<Eigen::MatrixXd> x_block(x.data() + l * n_right * n, n_right,
+                                        n);
+    block.noalias() = x_block * M.transpose();
+    x_block = block;
+  }
+}
+
+/**
+ * Multiply the specified vector in place by the Kronecker product of the
+ * specified matrices, skipping the matrix at index `skip`.
+ *
+ * @param Ms square matrices of the Kronecker product, the last one varies
+ * fastest
+ * @param skip index of the matrix replaced by the identity, or
+ * `Ms.size()` to use all of them
+ * @param[in,out] x vector to multiply
+ */
+inline void kronecker_multiply(const std::vector<Eigen::MatrixXd>& Ms,
+                               size_t skip, Eigen::VectorXd& x) {
+  Eigen::Index n_left = 1;
+  for (size_t d = 0; d < Ms.size(); ++d) {
+    const Eigen::Index n_right = x.size() / (n_left * Ms[d].rows());
+    if (d != skip) {
+      kronecker_mode_multiply(Ms[d], n_left, n_right, x);
+    }
+    n_left *= Ms[d].rows();
+  }
+}
+
+/**
+ * Return the Kronecker product of the specified vectors, the last of which
+ * varies fastest.
+ *
+ * @param vs vectors of the Kronecker product
+ * @return Kronecker product
+ */
+inline Eigen::VectorXd kronecker_vector_product(
+    const std::vector<Eigen::VectorXd>& vs) {
+  Eigen::VectorXd product = Eigen::VectorXd::Ones(1);
+  for (const auto& v : vs) {
+    Eigen::VectorXd next(product.size() * v.size());
+    for (Eigen::Index i = 0; i < product.size(); ++i) {
+      next.segment(i * v.size(), v.size()) = product.coeff(i) * v;
+    }
+    product = std::move(next);
+  }
+  return product;
+}
+}  // namespace internal
+
+/** \ingroup multivar_dists
+ * The log of the multivariate normal density for the given y and mu and
+ * the covariance matrix
+ *
+ * <code>
+ * Sigma = K[1] ⊗ K[2] ⊗ ... ⊗ K[D] + delta * I,
+ * </code>
+ *
+ * where the last factor varies fastest in `y`. A kernel evaluated on a
+ * Cartesian product grid gives such a covariance when it factors over the
+ * dimensions of the grid, as the squared exponential kernel does, with
+ * `K[d] = gp_exp_quad_cov(x[d], sigma[d], l[d])` and `delta` a nugget or
+ * observation noise variance.
+ *
+ * <p>Each factor is eigendecomposed, `K[d] = Q[d] * diag(lambda[d]) *
+ * Q[d]^T`, so that the solve and the log determinant cost
+ * `O(sum(n[d]^3) + N * sum(n[d]))` operations for `N = prod(n[d])`
+ * instead of the `O(N^3)` of a Cholesky factorization of `Sigma`. The
+ * adjoints of the factors and of `delta` are computed from the same
+ * decompositions, so the gradients with respect to the kernel
+ * hyperparameters flow through the `K[d]`.
+ *
+ * @tparam T_y type of the random variable
+ * @tparam T_loc type of the location
+ * @tparam T_covar type of the Kronecker factors
+ * @tparam T_delta type of the diagonal term
+ * @param y random variable
+ * @param mu mean vector of the multivariate normal distribution
+ * @param Ks symmetric positive semi-definite Kronecker factors
+ * @param delta non-negative variance added to the diagonal
+ * @return log of the multivariate normal density
+ * @throw std::domain_error if a factor is not symmetric, if the
+ * covariance matrix is not positive definite, if `mu`, `Ks` or `delta` are
+ * not finite or if `y` is nan
+ * @throw std::invalid_argument if there are no factors, a factor is not
+ * square or the sizes do not match
+ */
+template <bool propto, typename T_y, typename T_loc, typename T_covar,
+          typename T_delta,
+          require_all_eigen_col_vector_t<T_y, T_loc>* = nullptr,
+          require_eigen_t<T_covar>* = nullptr,
+          require_stan_scalar_t<T_delta>* = nullptr>
+return_type_t<T_y, T_loc, T_covar, T_delta> multi_normal_kronecker_lpdf(
+    const T_y& y, const T_loc& mu, const std::vector<T_covar>& Ks,
+    const T_delta& delta) {
+  static const char* function = "multi_normal_kronecker_lpdf";
+  using T_covar_elem = value_type_t<T_covar>;
+  using T_return = return_type_t<T_y, T_loc, T_covar, T_delta>;
+  using Eigen::Index;
+  using Eigen::MatrixXd;
+  using Eigen::VectorXd;
+  using T_y_ref = ref_type_t<T_y>;
+  using T_mu_ref = ref_type_t<T_loc>;
+
+  check_nonzero_size(function, "Kronecker factors", Ks);
+  check_size_match(function, "Size of random variable", y.size(),
+                   "size of location parameter", mu.size());
+  Index N = 1;
+  for (size_t d = 0; d < Ks.size(); ++d) {
+    check_square(function, "Kronecker factor", Ks[d]);
+    check_finite(function, "Kronecker factor", Ks[d]);
+    check_symmetric(function, "Kronecker factor", Ks[d]);
+    N *= Ks[d].rows();
+  }
+  check_size_match(function, "Size of random variable", y.size(),
+                   "size of covariance matrix", N);
+  T_y_ref y_ref = y;
+  T_mu_ref mu_ref = mu;
+  check_not_nan(function, "Random variable", y_ref);
+  check_finite(function, "Location parameter", mu_ref);
+  check_nonnegative(function, "Diagonal term", delta);
+  check_finite(function, "Diagonal term", delta);
+
+  if (unlikely(N == 0)) {
+    return T_return(0);
+  }
+
+  const size_t D = Ks.size();
+  const double delta_val = value_of(delta);
+  std::vector<MatrixXd> Qs(D);
+  std::vector<MatrixXd> Qts(D);
+  std::vector<VectorXd> lambdas(D);
+  for (size_t d = 0; d < D; ++d) {
+    Eigen::SelfAdjointEigenSolver<MatrixXd> eig(value_of(Ks[d]));
+    Qs[d] = eig.eigenvectors();
+    Qts[d] = Qs[d].transpose();
+    lambdas[d] = eig.eigenvalues();
+  }
+  const VectorXd eigenvalues
+      = internal::kronecker_vector_product(lambdas).array() + delta_val;
+  if (!(eigenvalues.array() > 0).all()) {
+    throw_domain_error(function, "Covariance matrix",
+                       "is not positive definite.", "");
+  }
+
+  // alpha = Sigma^-1 (y - mu), rotated into the eigenbasis and back
+  const VectorXd diff = value_of(y_ref) - value_of(mu_ref);
+  VectorXd alpha = diff;
+  internal::kronecker_multiply(Qts, D, alpha);
+  alpha.array() /= eigenvalues.array();
+  internal::kronecker_multiply(Qs, D, alpha);
+
+  operands_and_partials<T_y_ref, T_mu_ref, std::vector<T_covar>, T_delta>
+      ops_partials(y_ref, mu_ref, Ks, delta);
+
+  double logp = 0;
+  if (include_summand<propto>::value) {
+    logp += NEG_LOG_SQRT_TWO_PI * N;
+  }
+  if (include_summand<propto, T_covar_elem, T_delta>::value) {
+    logp -= 0.5 * eigenvalues.array().log().sum();
+  }
+  if (include_summand<propto, T_y, T_loc, T_covar_elem, T_delta>::value) {
+    logp -= 0.5 * diff.dot(alpha);
+  }
+
+  if (!is_constant_all<T_y>::value) {
+    ops_partials.edge1_.partials_ = -alpha;
+  }
+  if (!is_constant_all<T_loc>::value) {
+    ops_partials.edge2_.partials_ = alpha;
+  }
+  if (!is_constant_all<T_covar>::value) {
+    std::vector<MatrixXd> K_vals(D);
+    for (size_t d = 0; d < D; ++d) {
+      K_vals[d] = value_of(Ks[d]);
+    }
+    Index n_left = 1;
+    for (size_t d = 0; d < D; ++d) {
+      const Index n = Ks[d].rows();
+      const Index n_right = N / (n_left * n);
+      // quadratic term: sum of the outer products of the blocks of alpha
+      // and of alpha multiplied by all other factors
+      VectorXd beta = alpha;
+      internal::kronecker_multiply(K_vals, d, beta);
+      MatrixXd quad = MatrixXd::Zero(n, n);
+      // log determinant term: weights of the eigenvalues of factor d
+      std::vector<VectorXd> other_lambdas = lambdas;
+      other_lambdas[d] = VectorXd::Ones(n);
+      VectorXd other_lambda = internal::kronecker_vector_product(other_lambdas);
+      other_lambda.array() /= eigenvalues.array();
+      VectorXd weights = VectorXd::Zero(n);
+      for (Index l = 0; l < n_left; ++l) {
+        const Index offset = l * n_right * n;
+        Eigen::Map<const MatrixXd> alpha_block(alpha.data() + offset, n_right,
+                                               n);
+        Eigen::Map<const MatrixXd> beta_block(beta.data() + offset, n_right,
+                                              n);
+        Eigen::Map<const MatrixXd> weight_block(other_lambda.data() + offset,
+                                                n_right, n);
+        quad.noalias() += alpha_block.transpose() * beta_block;
+        weights += weight_block.colwise().sum().transpose();
+      }
+      ops_partials.edge3_.partials_vec_[d]
+          = 0.5 * (quad - Qs[d] * weights.asDiagonal() * Qts[d]);
+      n_left *= n;
+    }
+  }
+  if (!is_constant_all<T_delta>::value) {
+    ops_partials.edge4_.partials_[0]
+        = 0.5 * (alpha.squaredNorm() - eigenvalues.cwiseInverse().sum());
+  }
+
+  return ops_partials.build(logp);
+}
+
+template <typename T_y, typename T_loc, typename T_covar, typename T_delta>
+inline return_type_t<T_y, T_loc, T_covar, T_delta> multi_normal_kronecker_lpdf(
+    const T_y& y, const T_loc& mu, const std::vector<T_covar>& Ks,
+    const T_delta& delta) {
+  return multi_normal_kronecker_lpdf<false>(y, mu, Ks, delta);
+}
+
+template <bool propto, typename T_y, typename T_loc, typename T_covar>
+inline return_type_t<T_y, T_loc, T_covar> multi_normal_kronecker_lpdf(
+    const T_y& y, const T_loc& mu, const std::vector<T_covar>& Ks) {
+  return multi_normal_kronecker_lpdf<propto>(y, mu, Ks, 0.0);
+}
+
+template <typename T_y, typename T_loc, typename T_covar>
+inline return_type_t<T_y, T_loc, T_covar> multi_normal_kronecker_lpdf(
+    const T_y& y, const T_loc& mu, const std::vector<T_covar>& Ks) {
+  return multi_normal_kronecker_lpdf<false>(y, mu, Ks, 0.0);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
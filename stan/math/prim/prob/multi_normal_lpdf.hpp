@@ -4,11 +4,14 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/gp_cov_operator.hpp>
 #include <stan/math/prim/fun/log_determinant_ldlt.hpp>
 #include <stan/math/prim/fun/max_size_mvt.hpp>
 #include <stan/math/prim/fun/size_mvt.hpp>
 #include <stan/math/prim/fun/to_ref.hpp>
 #include <stan/math/prim/fun/trace_inv_quad_form_ldlt.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/functor/operands_and_partials.hpp>
 
 namespace stan {
 namespace math {
@@ -100,6 +103,106 @@ return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(const T_y& y,
   return lp;
 }
 
+/**
+ * Return the log of the multivariate normal density for the specified
+ * vector, location and lazy Gaussian process covariance operator.
+ *
+ * The covariance matrix is never formed. The quadratic form uses the
+ * solution of `Sigma * alpha = y - mu` computed with conjugate gradients,
+ * and the log determinant is estimated by stochastic Lanczos quadrature.
+ * The derivatives with respect to the parameters of the operator,
+ *
+ * <code>
+ * 0.5 * alpha^T * dSigma * alpha - 0.5 * tr(Sigma^-1 * dSigma),
+ * </code>
+ *
+ * use a Hutchinson estimate of the trace with the same probe vectors, whose
+ * solutions are found together with `alpha`. Memory is `O(N)` per probe
+ * vector and only one node per parameter is placed on the autodiff stack.
+ * The number of probes, Lanczos steps and the conjugate gradient tolerance
+ * are taken from `Sigma.options()`.
+ *
+ * @tparam propto whether to drop constant terms
+ * @tparam T_y type of the random variable, an Eigen column vector
+ * @tparam T_loc type of the location, an Eigen column vector
+ * @tparam Kernel type of the kernel of the covariance operator
+ * @tparam T_covar type of the parameters of the covariance operator
+ * @param y random variable
+ * @param mu location
+ * @param Sigma covariance operator
+ * @return log density, up to the error of the stochastic estimates
+ * @throw std::domain_error if `mu` is not finite, `y` has NaN elements or
+ * the operator is not positive definite
+ * @throw std::invalid_argument if the sizes do not match
+ */
+template <bool propto, typename T_y, typename T_loc, typename Kernel,
+          typename T_covar,
+          require_all_eigen_col_vector_t<T_y, T_loc>* = nullptr>
+return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(
+    const T_y& y, const T_loc& mu,
+    const gp_cov_operator<Kernel, T_covar>& Sigma) {
+  using T_y_ref = ref_type_t<T_y>;
+  using T_mu_ref = ref_type_t<T_loc>;
+  using T_theta = Eigen::Matrix<T_covar, Eigen::Dynamic, 1>;
+  static const char* function = "multi_normal_lpdf";
+  check_size_match(function, "Size of random variable", y.size(),
+                   "size of location parameter", mu.size());
+  check_size_match(function, "Size of random variable", y.size(),
+                   "rows of covariance parameter", Sigma.rows());
+  T_y_ref y_ref = y;
+  T_mu_ref mu_ref = mu;
+  check_not_nan(function, "Random variable", y_ref);
+  check_finite(function, "Location parameter", mu_ref);
+
+  const Eigen::Index N = y.size();
+  if (N == 0 || !include_summand<propto, T_y, T_loc, T_covar>::value) {
+    return 0.0;
+  }
+  operands_and_partials<T_y_ref, T_mu_ref, T_theta> ops_partials(
+      y_ref, mu_ref, Sigma.theta());
+
+  const gp_cov_operator_options& opts = Sigma.options();
+  const bool need_probes = include_summand<propto, T_covar>::value
+                           || !is_constant_all<T_covar>::value;
+  const int num_probes = need_probes ? std::max(opts.num_probes, 1) : 0;
+  Eigen::MatrixXd B(N, 1 + num_probes);
+  B.col(0) = value_of(y_ref) - value_of(mu_ref);
+  if (need_probes) {
+    B.rightCols(num_probes)
+        = internal::rademacher_probes(N, num_probes, opts.seed);
+  }
+  const Eigen::MatrixXd X = internal::gp_cov_conjugate_gradient(
+      Sigma,
+      !is_constant_all<T_covar>::value ? B : B.leftCols(1).eval());
+  const auto& alpha = X.col(0);
+
+  double logp = -0.5 * B.col(0).dot(alpha);
+  if (include_summand<propto>::value) {
+    logp += NEG_LOG_SQRT_TWO_PI * N;
+  }
+  if (include_summand<propto, T_covar>::value) {
+    logp -= 0.5
+            * internal::stochastic_lanczos_log_determinant(
+                Sigma, B.rightCols(num_probes), opts.lanczos_steps);
+  }
+
+  if (!is_constant_all<T_y>::value) {
+    ops_partials.edge1_.partials_ = -alpha;
+  }
+  if (!is_constant_all<T_loc>::value) {
+    ops_partials.edge2_.partials_ = alpha;
+  }
+  if (!is_constant_all<T_covar>::value) {
+    Eigen::MatrixXd U(N, 1 + num_probes);
+    U.col(0) = alpha;
+    U.rightCols(num_probes) = B.rightCols(num_probes);
+    const Eigen::MatrixXd G = Sigma.quad_form_gradients(U, X);
+    ops_partials.edge3_.partials_
+        = 0.5 * G.col(0) - 0.5 * G.rightCols(num_probes).rowwise().mean();
+  }
+  return ops_partials.build(logp);
+}
+
 template <typename T_y, typename T_loc, typename T_covar>
 inline return_type_t<T_y, T_loc, T_covar> multi_normal_lpdf(
     const T_y& y, const T_loc& mu, const T_covar& Sigma) {
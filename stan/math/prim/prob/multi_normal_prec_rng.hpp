@@ -68,8 +68,8 @@ multi_normal_prec_rng(const T_loc &mu, const Eigen::MatrixXd &S, RNG &rng) {
   variate_generator<RNG &, normal_distribution<>> std_normal_rng(
       rng, normal_distribution<>(0, 1));
 
+  Eigen::VectorXd z(S.cols());
   for (size_t n = 0; n < N; ++n) {
-    Eigen::VectorXd z(S.cols());
     for (int i = 0; i < S.cols(); i++) {
       z(i) = std_normal_rng();
     }
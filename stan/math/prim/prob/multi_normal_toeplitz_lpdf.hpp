@@ -0,0 +1,187 @@
+#ifndef STAN_MATH_PRIM_PROB_MULTI_NORMAL_TOEPLITZ_LPDF_HPP
+#define STAN_MATH_PRIM_PROB_MULTI_NORMAL_TOEPLITZ_LPDF_HPP
+
+#include <stan/math/prim/meta.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/functor/operands_and_partials.hpp>
+#include <cmath>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Sum of the `k`-th subdiagonal of `L(a) * L(a)^T`, where `L(a)` is the
+ * lower triangular Toeplitz matrix with first column `a`.
+ *
+ * @param a first column of the triangular Toeplitz matrix
+ * @param k index of the subdiagonal
+ * @return sum of the subdiagonal
+ */
+inline double lower_toeplitz_gram_diagonal_sum(const Eigen::VectorXd& a,
+                                               Eigen::Index k) {
+  const Eigen::Index n = a.size();
+  double sum = 0;
+  for (Eigen::Index p = 0; p < n - k; ++p) {
+    sum += a.coeff(p) * a.coeff(p + k) * (n - k - p);
+  }
+  return sum;
+}
+}  // namespace internal
+
+/** \ingroup multivar_dists
+ * The log of the multivariate normal density for the given y and mu and
+ * a symmetric Toeplitz covariance matrix given by its first column.
+ *
+ * <p>A stationary kernel evaluated on a regular one dimensional grid
+ * gives a Toeplitz covariance matrix, for example
+ * `gp_exp_quad_cov(x, {x[0]}, sigma, l).col(0)` for sorted equally spaced
+ * `x`. Gradients with respect to the kernel hyperparameters flow through
+ * the first column.
+ *
+ * <p>The system `Sigma * alpha = y - mu` and the log determinant are
+ * computed with the Levinson-Durbin recursion in `O(N^2)` operations and
+ * `O(N)` memory instead of the `O(N^3)` operations and `O(N^2)` memory of
+ * a Cholesky factorization. The recursion also yields the first column of
+ * `Sigma^-1`, from which the Gohberg-Semencul formula gives the sums of
+ * the diagonals of `Sigma^-1` needed by the adjoint of the first column
+ * without forming the inverse.
+ *
+ * @tparam T_y type of the random variable
+ * @tparam T_loc type of the location
+ * @tparam T_covar type of the first column of the covariance matrix
+ * @param y random variable
+ * @param mu mean vector of the multivariate normal distribution
+ * @param c first column of the covariance matrix
+ * @return log of the multivariate normal density
+ * @throw std::domain_error if the covariance matrix is not positive
+ * definite, if `mu` or `c` are not finite or if `y` is nan
+ * @throw std::invalid_argument if the sizes do not match
+ */
+template <bool propto, typename T_y, typename T_loc, typename T_covar,
+          require_all_eigen_col_vector_t<T_y, T_loc, T_covar>* = nullptr>
+return_type_t<T_y, T_loc, T_covar> multi_normal_toeplitz_lpdf(
+    const T_y& y, const T_loc& mu, const T_covar& c) {
+  static const char* function = "multi_normal_toeplitz_lpdf";
+  using T_covar_elem = value_type_t<T_covar>;
+  using T_return = return_type_t<T_y, T_loc, T_covar>;
+  using Eigen::Index;
+  using Eigen::VectorXd;
+  using T_y_ref = ref_type_t<T_y>;
+  using T_mu_ref = ref_type_t<T_loc>;
+  using T_c_ref = ref_type_t<T_covar>;
+
+  check_size_match(function, "Size of random variable", y.size(),
+                   "size of location parameter", mu.size());
+  check_size_match(function, "Size of random variable", y.size(),
+                   "size of covariance column", c.size());
+  T_y_ref y_ref = y;
+  T_mu_ref mu_ref = mu;
+  T_c_ref c_ref = c;
+  check_not_nan(function, "Random variable", y_ref);
+  check_finite(function, "Location parameter", mu_ref);
+  check_finite(function, "Covariance column", c_ref);
+
+  const Index N = y.size();
+  if (unlikely(N == 0)) {
+    return T_return(0);
+  }
+
+  const VectorXd c_val = value_of(c_ref);
+  check_positive(function, "Variance", c_val.coeff(0));
+  const VectorXd diff = value_of(y_ref) - value_of(mu_ref);
+
+  // Levinson-Durbin recursion on the covariance scaled to unit diagonal.
+  // x solves the system and the Yule-Walker solution z gives the first
+  // column of the inverse.
+  const double c0 = c_val.coeff(0);
+  const VectorXd r = c_val / c0;
+  VectorXd x = VectorXd::Zero(N);
+  VectorXd z = VectorXd::Zero(N);
+  VectorXd z_prev(N);
+  x.coeffRef(0) = diff.coeff(0) / c0;
+  double beta = 1;
+  double log_det = N * std::log(c0);
+  if (N > 1) {
+    z.coeffRef(0) = -r.coeff(1);
+  }
+  for (Index k = 1; k < N; ++k) {
+    const double z_last = z.coeff(k - 1);
+    beta *= (1 - z_last) * (1 + z_last);
+    if (!(beta > 0)) {
+      throw_domain_error(function, "Covariance matrix",
+                         "is not positive definite.", "");
+    }
+    log_det += std::log(beta);
+    const double eta
+        = (diff.coeff(k) / c0 - r.segment(1, k).dot(x.head(k).reverse()))
+          / beta;
+    x.head(k) += eta * z.head(k).reverse();
+    x.coeffRef(k) = eta;
+    if (k < N - 1) {
+      const double a
+          = (-r.coeff(k + 1) - r.segment(1, k).dot(z.head(k).reverse())) / beta;
+      z_prev.head(k) = z.head(k);
+      z.head(k) += a * z_prev.head(k).reverse();
+      z.coeffRef(k) = a;
+    }
+  }
+  const VectorXd& alpha = x;
+
+  operands_and_partials<T_y_ref, T_mu_ref, T_c_ref> ops_partials(y_ref, mu_ref,
+                                                                 c_ref);
+
+  double logp = 0;
+  if (include_summand<propto>::value) {
+    logp += NEG_LOG_SQRT_TWO_PI * N;
+  }
+  if (include_summand<propto, T_covar_elem>::value) {
+    logp -= 0.5 * log_det;
+  }
+  if (include_summand<propto, T_y, T_loc, T_covar_elem>::value) {
+    logp -= 0.5 * diff.dot(alpha);
+  }
+
+  if (!is_constant_all<T_y>::value) {
+    ops_partials.edge1_.partials_ = -alpha;
+  }
+  if (!is_constant_all<T_loc>::value) {
+    ops_partials.edge2_.partials_ = alpha;
+  }
+  if (!is_constant_all<T_covar>::value) {
+    // first column of the inverse and the Gohberg-Semencul vectors
+    VectorXd inv_col(N);
+    inv_col.coeffRef(0) = 1;
+    inv_col.tail(N - 1) = z.head(N - 1);
+    inv_col /= c0 * beta;
+    VectorXd inv_col_shift(N);
+    inv_col_shift.coeffRef(0) = 0;
+    inv_col_shift.tail(N - 1) = inv_col.tail(N - 1).reverse();
+    auto& c_partials = ops_partials.edge3_.partials_;
+    for (Index k = 0; k < N; ++k) {
+      const double inv_diag_sum
+          = (internal::lower_toeplitz_gram_diagonal_sum(inv_col, k)
+             - internal::lower_toeplitz_gram_diagonal_sum(inv_col_shift, k))
+            / inv_col.coeff(0);
+      const double alpha_corr = alpha.head(N - k).dot(alpha.tail(N - k));
+      c_partials[k] = k == 0 ? 0.5 * (alpha_corr - inv_diag_sum)
+                             : alpha_corr - inv_diag_sum;
+    }
+  }
+
+  return ops_partials.build(logp);
+}
+
+template <typename T_y, typename T_loc, typename T_covar>
+inline return_type_t<T_y, T_loc, T_covar> multi_normal_toeplitz_lpdf(
+    const T_y& y, const T_loc& mu, const T_covar& c) {
+  return multi_normal_toeplitz_lpdf<false>(y, mu, c);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
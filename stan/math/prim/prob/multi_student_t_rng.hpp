@@ -75,8 +75,8 @@ multi_student_t_rng(
       rng, gamma_distribution<>(nu / 2.0, 2.0 / nu));
 
   double w = 1.0 / gamma_rng();
+  Eigen::VectorXd z(S.cols());
   for (size_t n = 0; n < N; ++n) {
-    Eigen::VectorXd z(S.cols());
     for (int i = 0; i < S.cols(); i++) {
       z(i) = std::sqrt(w) * std_normal_rng();
     }
@@ -4,6 +4,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <stan/math/prim/fun/glm_design_matrix.hpp>
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/exp.hpp>
 #include <stan/math/prim/fun/lgamma.hpp>
@@ -47,7 +48,9 @@ namespace math {
  * @param y failures count scalar or vector parameter. If it is a scalar it will
  * be broadcast - used for all instances.
  * @param x design matrix or row vector. If it is a row vector it will be
- * broadcast - used for all instances.
+ * broadcast - used for all instances. Can also be an `Eigen::SparseMatrix`
+ * of data, in which case the cost is proportional to the number of nonzeros,
+ * or a `glm_design_matrix` prepared once per data set.
  * @param alpha intercept (in log odds)
  * @param beta weight vector
  * @param phi (vector of) precision parameter(s)
@@ -59,7 +62,7 @@ namespace math {
  */
 template <bool propto, typename T_y, typename T_x, typename T_alpha,
           typename T_beta, typename T_precision,
-          require_eigen_t<T_x>* = nullptr>
+          require_glm_design_t<T_x>* = nullptr>
 return_type_t<T_x, T_alpha, T_beta, T_precision> neg_binomial_2_log_glm_lpmf(
     const T_y& y, const T_x& x, const T_alpha& alpha, const T_beta& beta,
     const T_precision& phi) {
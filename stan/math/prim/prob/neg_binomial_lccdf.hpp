@@ -100,7 +100,9 @@ return_type_t<T_shape, T_inv_scale> neg_binomial_lccdf(
     const T_partials_return inv_beta_p1 = inv(beta_dbl + 1);
     const T_partials_return p_dbl = beta_dbl * inv_beta_p1;
     const T_partials_return d_dbl = square(inv_beta_p1);
-    const T_partials_return Pi = 1.0 - inc_beta(alpha_dbl, n_dbl + 1.0, p_dbl);
+    const T_partials_return inc_beta_dbl
+        = inc_beta(alpha_dbl, n_dbl + 1.0, p_dbl);
+    const T_partials_return Pi = 1.0 - inc_beta_dbl;
     const T_partials_return beta_func = beta(n_dbl + 1, alpha_dbl);
 
     P += log(Pi);
@@ -111,7 +113,7 @@ return_type_t<T_shape, T_inv_scale> neg_binomial_lccdf(
 
       grad_reg_inc_beta(g1, g2, alpha_dbl, n_dbl + 1, p_dbl,
                         digammaAlpha_vec[i], digammaN_vec[i], digammaSum_vec[i],
-                        beta_func);
+                        beta_func, inc_beta_dbl);
       ops_partials.edge1_.partials_[i] -= g1 / Pi;
     }
     if (!is_constant_all<T_inv_scale>::value) {
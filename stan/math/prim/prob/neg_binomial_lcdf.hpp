@@ -111,7 +111,7 @@ return_type_t<T_shape, T_inv_scale> neg_binomial_lcdf(
 
       grad_reg_inc_beta(g1, g2, alpha_dbl, n_dbl + 1, p_dbl,
                         digammaAlpha_vec[i], digammaN_vec[i], digammaSum_vec[i],
-                        beta_func);
+                        beta_func, Pi);
       ops_partials.edge1_.partials_[i] += g1 / Pi;
     }
     if (!is_constant_all<T_inv_scale>::value) {
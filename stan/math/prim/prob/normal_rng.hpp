@@ -48,10 +48,12 @@ inline typename VectorBuilder<true, double, T_loc, T_scale>::type normal_rng(
   size_t N = max_size(mu, sigma);
   VectorBuilder<true, double, T_loc, T_scale> output(N);
 
+  // One standard normal generator is shared by all draws; location and
+  // scale are applied afterwards, exactly as normal_distribution does
+  variate_generator<RNG&, normal_distribution<> > std_normal_rng(
+      rng, normal_distribution<>(0, 1));
   for (size_t n = 0; n < N; ++n) {
-    variate_generator<RNG&, normal_distribution<> > norm_rng(
-        rng, normal_distribution<>(mu_vec[n], sigma_vec[n]));
-    output[n] = norm_rng();
+    output[n] = std_normal_rng() * sigma_vec[n] + mu_vec[n];
   }
 
   return output.data();
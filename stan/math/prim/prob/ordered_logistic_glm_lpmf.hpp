@@ -4,6 +4,7 @@
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/exp.hpp>
+#include <stan/math/prim/fun/glm_design_matrix.hpp>
 #include <stan/math/prim/fun/log1m_exp.hpp>
 #include <stan/math/prim/fun/size.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
@@ -31,6 +32,8 @@ namespace math {
  * classes, including endpoints.
  * @param x design matrix or row vector. If it is a row vector it will be
  * broadcast - used for all instances.
+ * Can also be an `Eigen::SparseMatrix` of data, in which case the cost is
+ * proportional to the number of nonzeros.
  * @param beta weight vector
  * @param cuts cutpoints vector
  * @return log probability
@@ -41,6 +44,7 @@ namespace math {
  */
 template <bool propto, typename T_y, typename T_x, typename T_beta,
           typename T_cuts, require_eigen_t<T_x>* = nullptr,
+          require_glm_design_t<T_x>* = nullptr,
           require_all_eigen_col_vector_t<T_beta, T_cuts>* = nullptr>
 return_type_t<T_x, T_beta, T_cuts> ordered_logistic_glm_lpmf(
     const T_y& y, const T_x& x, const T_beta& beta, const T_cuts& cuts) {
@@ -178,8 +182,7 @@ return_type_t<T_x, T_beta, T_cuts> ordered_logistic_glm_lpmf(
       if (!is_constant_all<T_beta>::value) {
         if (T_x_rows == 1) {
           ops_partials.edge2_.partials_
-              = (location_derivative * x_val.replicate(N_instances, 1))
-                    .transpose();
+              = (location_derivative.sum() * x_val).transpose();
         } else {
           ops_partials.edge2_.partials_
               = (location_derivative * x_val).transpose();
@@ -7,7 +7,7 @@
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/exp.hpp>
 #include <stan/math/prim/fun/gamma_q.hpp>
-#include <stan/math/prim/fun/grad_reg_inc_gamma.hpp>
+#include <stan/math/prim/fun/gamma_q_dd.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
 #include <stan/math/prim/fun/size.hpp>
 #include <stan/math/prim/fun/size_zero.hpp>
@@ -104,7 +104,12 @@ return_type_t<T_y, T_dof, T_scale> scaled_inv_chi_square_cdf(const T_y& y,
     const T_partials_return half_nu_s2_overx_dbl
         = 2.0 * half_nu_dbl * half_s2_overx_dbl;
 
-    const T_partials_return Pn = gamma_q(half_nu_dbl, half_nu_s2_overx_dbl);
+    T_partials_return d_half_nu(0);
+    const T_partials_return Pn
+        = is_constant_all<T_dof>::value
+              ? gamma_q(half_nu_dbl, half_nu_s2_overx_dbl)
+              : gamma_q_dd(half_nu_dbl, half_nu_s2_overx_dbl, gamma_vec[n],
+                           digamma_vec[n], d_half_nu);
     const T_partials_return gamma_p_deriv
         = exp(-half_nu_s2_overx_dbl)
           * pow(half_nu_s2_overx_dbl, half_nu_dbl - 1) / tgamma(half_nu_dbl);
@@ -118,11 +123,7 @@ return_type_t<T_y, T_dof, T_scale> scaled_inv_chi_square_cdf(const T_y& y,
 
     if (!is_constant_all<T_dof>::value) {
       ops_partials.edge2_.partials_[n]
-          += (0.5
-                  * grad_reg_inc_gamma(half_nu_dbl, half_nu_s2_overx_dbl,
-                                       gamma_vec[n], digamma_vec[n])
-              - half_s2_overx_dbl * gamma_p_deriv)
-             / Pn;
+          += (0.5 * d_half_nu - half_s2_overx_dbl * gamma_p_deriv) / Pn;
     }
 
     if (!is_constant_all<T_scale>::value) {
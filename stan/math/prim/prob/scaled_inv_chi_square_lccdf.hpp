@@ -7,7 +7,7 @@
 #include <stan/math/prim/fun/digamma.hpp>
 #include <stan/math/prim/fun/exp.hpp>
 #include <stan/math/prim/fun/gamma_p.hpp>
-#include <stan/math/prim/fun/grad_reg_inc_gamma.hpp>
+#include <stan/math/prim/fun/gamma_p_dd.hpp>
 #include <stan/math/prim/fun/log.hpp>
 #include <stan/math/prim/fun/max_size.hpp>
 #include <stan/math/prim/fun/size.hpp>
@@ -90,7 +90,12 @@ return_type_t<T_y, T_dof, T_scale> scaled_inv_chi_square_lccdf(
     const T_partials_return half_nu_s2_overx_dbl
         = 2.0 * half_nu_dbl * half_s2_overx_dbl;
 
-    const T_partials_return Pn = gamma_p(half_nu_dbl, half_nu_s2_overx_dbl);
+    T_partials_return d_half_nu(0);
+    const T_partials_return Pn
+        = is_constant_all<T_dof>::value
+              ? gamma_p(half_nu_dbl, half_nu_s2_overx_dbl)
+              : gamma_p_dd(half_nu_dbl, half_nu_s2_overx_dbl, gamma_vec[n],
+                           digamma_vec[n], d_half_nu);
     const T_partials_return gamma_p_deriv
         = exp(-half_nu_s2_overx_dbl)
           * pow(half_nu_s2_overx_dbl, half_nu_dbl - 1) / tgamma(half_nu_dbl);
@@ -103,11 +108,7 @@ return_type_t<T_y, T_dof, T_scale> scaled_inv_chi_square_lccdf(
     }
     if (!is_constant_all<T_dof>::value) {
       ops_partials.edge2_.partials_[n]
-          -= (0.5
-                  * grad_reg_inc_gamma(half_nu_dbl, half_nu_s2_overx_dbl,
-                                       gamma_vec[n], digamma_vec[n])
-              - half_s2_overx_dbl * gamma_p_deriv)
-             / Pn;
+          += (0.5 * d_half_nu + half_s2_overx_dbl * gamma_p_deriv) / Pn;
     }
     if (!is_constant_all<T_scale>::value) {
       ops_partials.edge3_.partials_[n]
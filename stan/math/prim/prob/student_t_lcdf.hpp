@@ -120,7 +120,7 @@ return_type_t<T_y, T_dof, T_loc, T_scale> student_t_lcdf(const T_y& y,
 
         grad_reg_inc_beta(g1, g2, 0.5 * nu_dbl, (T_partials_return)0.5, 1.0 - r,
                           digammaNu_vec[n], digammaHalf,
-                          digammaNuPlusHalf_vec[n], betaNuHalf);
+                          digammaNuPlusHalf_vec[n], betaNuHalf, z);
 
         ops_partials.edge2_.partials_[n]
             += zJacobian * (d_ibeta * (r / t) * (r / t) + 0.5 * g1) / Pn;
@@ -136,8 +136,9 @@ return_type_t<T_y, T_dof, T_loc, T_scale> student_t_lcdf(const T_y& y,
       }
 
     } else {
-      T_partials_return z
-          = 1.0 - inc_beta((T_partials_return)0.5, 0.5 * nu_dbl, r);
+      const T_partials_return inc_beta_r
+          = inc_beta((T_partials_return)0.5, 0.5 * nu_dbl, r);
+      T_partials_return z = 1.0 - inc_beta_r;
       zJacobian *= -1;
 
       const T_partials_return Pn = t > 0 ? 1.0 - 0.5 * z : 0.5 * z;
@@ -158,7 +159,7 @@ return_type_t<T_y, T_dof, T_loc, T_scale> student_t_lcdf(const T_y& y,
 
         grad_reg_inc_beta(g1, g2, (T_partials_return)0.5, 0.5 * nu_dbl, r,
                           digammaHalf, digammaNu_vec[n],
-                          digammaNuPlusHalf_vec[n], betaNuHalf);
+                          digammaNuPlusHalf_vec[n], betaNuHalf, inc_beta_r);
 
         ops_partials.edge2_.partials_[n]
             += zJacobian * (-d_ibeta * (r / t) * (r / t) + 0.5 * g2) / Pn;
@@ -49,10 +49,14 @@
 #include <stan/math/rev/core/precomp_vvv_vari.hpp>
 #include <stan/math/rev/core/precomputed_gradients.hpp>
 #include <stan/math/rev/core/print_stack.hpp>
+#include <stan/math/rev/core/profiling.hpp>
 #include <stan/math/rev/core/recover_memory.hpp>
 #include <stan/math/rev/core/recover_memory_nested.hpp>
+#include <stan/math/rev/core/scratch_rev_autodiff.hpp>
 #include <stan/math/rev/core/set_zero_all_adjoints.hpp>
 #include <stan/math/rev/core/set_zero_all_adjoints_nested.hpp>
+#include <stan/math/rev/core/set_zero_nochain_adjoints.hpp>
+#include <stan/math/rev/core/simplify_tape.hpp>
 #include <stan/math/rev/core/start_nested.hpp>
 #include <stan/math/rev/core/std_complex.hpp>
 #include <stan/math/rev/core/std_isinf.hpp>
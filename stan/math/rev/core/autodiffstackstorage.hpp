@@ -2,6 +2,7 @@
 #define STAN_MATH_REV_CORE_AUTODIFFSTACKSTORAGE_HPP
 
 #include <stan/math/memory/stack_alloc.hpp>
+#include <memory>
 #include <vector>
 
 namespace stan {
@@ -110,6 +111,9 @@ struct AutodiffStackSingleton {
     std::vector<size_t> nested_var_stack_sizes_;
     std::vector<size_t> nested_var_nochain_stack_sizes_;
     std::vector<size_t> nested_var_alloc_stack_starts_;
+
+    // storage used by scratch_rev_autodiff scopes opened on this storage
+    std::unique_ptr<AutodiffStackStorage> scratch_;
   };
 
   explicit AutodiffStackSingleton(AutodiffStackSingleton_t const &) = delete;
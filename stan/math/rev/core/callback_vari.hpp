@@ -1,6 +1,7 @@
 #ifndef STAN_MATH_REV_CORE_CALLBACK_VARI_HPP
 #define STAN_MATH_REV_CORE_CALLBACK_VARI_HPP
 
+#include <stan/math/rev/core/profiling.hpp>
 #include <stan/math/rev/core/vari.hpp>
 #include <utility>
 
@@ -14,7 +15,9 @@ struct callback_vari : public vari_value<T> {
 
   explicit callback_vari(T&& value, F&& rev_functor)
       : vari_value<T>(std::move(value)),
-        rev_functor_(std::forward<F>(rev_functor)) {}
+        rev_functor_(std::forward<F>(rev_functor)) {
+    auto_profile_node("callback_vari", this, sizeof(*this));
+  }
 
   inline void chain() final { rev_functor_(*this); }
 };
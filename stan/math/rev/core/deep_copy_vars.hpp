@@ -81,6 +81,20 @@ inline auto deep_copy_vars(EigT&& arg) {
       .eval();
 }
 
+/**
+ * Copy the value of a var with an Eigen value type, which may be a view of
+ * another var, to a new vari with its own adjoint
+ *
+ * @tparam T An Eigen type
+ * @param arg A var with an Eigen value type
+ * @return A new var with a plain Eigen value type
+ */
+template <typename T, require_eigen_t<T>* = nullptr>
+inline auto deep_copy_vars(const var_value<T>& arg) {
+  using plain_t = plain_type_t<T>;
+  return var_value<plain_t>(new vari_value<plain_t>(arg.val(), false));
+}
+
 }  // namespace math
 }  // namespace stan
 
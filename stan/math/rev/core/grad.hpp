@@ -53,6 +53,39 @@ static void grad(Vari* vi) {
   grad();
 }
 
+/**
+ * Compute the gradient for all variables starting from the
+ * specified root variable implementation like <code>grad(vi)</code>,
+ * resetting the adjoint of each vari on the stack to zero right after
+ * its <code>chain()</code> method has been called.
+ *
+ * <p>Nothing reads or writes the adjoint of a vari once it has been
+ * chained, as <code>vari_base::chain()</code> only uses the adjoints of
+ * the varis created before it, so the only adjoints left non-zero are
+ * those of the varis that are not chained, such as the independent
+ * variables, and of the varis created outside the current nesting.
+ * These can be read and then reset with
+ * <code>set_zero_nochain_adjoints()</code>. Computing a Jacobian row by
+ * row this way avoids a separate pass over the whole stack to reset the
+ * adjoints before each row.
+ *
+ * <p>The adjoints of the stack must be zero before the call.
+ *
+ * @param vi Variable implementation for root of partial
+ * derivative propagation.
+ */
+template <typename Vari>
+static void grad_and_zero_stack(Vari* vi) {
+  vi->init_dependent();
+  auto& stack = ChainableStack::instance_->var_stack_;
+  size_t end = stack.size();
+  size_t beginning = empty_nested() ? 0 : end - nested_size();
+  for (size_t i = end; i-- > beginning;) {
+    stack[i]->chain();
+    stack[i]->set_zero_adjoint();
+  }
+}
+
 }  // namespace math
 }  // namespace stan
 
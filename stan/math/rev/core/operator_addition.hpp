@@ -3,12 +3,52 @@
 
 #include <stan/math/prim/meta.hpp>
 #include <stan/math/rev/core/var.hpp>
-#include <stan/math/rev/core/callback_vari.hpp>
+#include <stan/math/rev/core/vv_vari.hpp>
+#include <stan/math/rev/core/vd_vari.hpp>
 #include <stan/math/prim/fun/constants.hpp>
+#include <cmath>
 
 namespace stan {
 namespace math {
 
+namespace internal {
+class add_vv_vari final : public op_vv_vari {
+ public:
+  add_vv_vari(vari* avi, vari* bvi)
+      : op_vv_vari(avi->val_ + bvi->val_, avi, bvi) {}
+  void chain() {
+    if (unlikely(std::isnan(val_))) {
+      avi_->adj_ = NOT_A_NUMBER;
+      bvi_->adj_ = NOT_A_NUMBER;
+    } else {
+      avi_->adj_ += adj_;
+      bvi_->adj_ += adj_;
+    }
+  }
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    f(avi_, 1.0);
+    f(bvi_, 1.0);
+  }
+};
+
+class add_vd_vari final : public op_vd_vari {
+ public:
+  add_vd_vari(vari* avi, double b) : op_vd_vari(avi->val_ + b, avi, b) {}
+  void chain() {
+    if (unlikely(std::isnan(val_))) {
+      avi_->adj_ = NOT_A_NUMBER;
+    } else {
+      avi_->adj_ += adj_;
+    }
+  }
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    f(avi_, 1.0);
+  }
+};
+}  // namespace internal
+
 /**
  * Addition operator for variables (C++).
  *
@@ -48,16 +88,7 @@ namespace math {
  * @return Variable result of adding two variables.
  */
 inline var operator+(const var& a, const var& b) {
-  return make_callback_vari(a.vi_->val_ + b.vi_->val_,
-                            [avi = a.vi_, bvi = b.vi_](const auto& vi) mutable {
-                              if (unlikely(std::isnan(vi.val_))) {
-                                avi->adj_ = NOT_A_NUMBER;
-                                bvi->adj_ = NOT_A_NUMBER;
-                              } else {
-                                avi->adj_ += vi.adj_;
-                                bvi->adj_ += vi.adj_;
-                              }
-                            });
+  return {new internal::add_vv_vari(a.vi_, b.vi_)};
 }
 
 /**
@@ -77,14 +108,7 @@ inline var operator+(const var& a, Arith b) {
   if (b == 0.0) {
     return a;
   }
-  return make_callback_vari(a.vi_->val_ + b,
-                            [avi = a.vi_, b](const auto& vi) mutable {
-                              if (unlikely(std::isnan(vi.val_))) {
-                                avi->adj_ = NOT_A_NUMBER;
-                              } else {
-                                avi->adj_ += vi.adj_;
-                              }
-                            });
+  return {new internal::add_vd_vari(a.vi_, b)};
 }
 
 /**
@@ -27,6 +27,11 @@ class multiply_vv_vari final : public op_vv_vari {
       bvi_->adj_ += avi_->val_ * adj_;
     }
   }
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    f(avi_, bvi_->val_);
+    f(bvi_, avi_->val_);
+  }
 };
 
 class multiply_vd_vari final : public op_vd_vari {
@@ -39,6 +44,10 @@ class multiply_vd_vari final : public op_vd_vari {
       avi_->adj_ += adj_ * bd_;
     }
   }
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    f(avi_, bd_);
+  }
 };
 }  // namespace internal
 
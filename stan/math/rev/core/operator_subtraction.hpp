@@ -26,6 +26,11 @@ class subtract_vv_vari final : public op_vv_vari {
       bvi_->adj_ -= adj_;
     }
   }
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    f(avi_, 1.0);
+    f(bvi_, -1.0);
+  }
 };
 
 class subtract_vd_vari final : public op_vd_vari {
@@ -38,6 +43,10 @@ class subtract_vd_vari final : public op_vd_vari {
       avi_->adj_ += adj_;
     }
   }
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    f(avi_, 1.0);
+  }
 };
 
 class subtract_dv_vari final : public op_dv_vari {
@@ -50,6 +59,10 @@ class subtract_dv_vari final : public op_dv_vari {
       bvi_->adj_ -= adj_;
     }
   }
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    f(bvi_, -1.0);
+  }
 };
 }  // namespace internal
 
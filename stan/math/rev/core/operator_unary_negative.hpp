@@ -21,6 +21,10 @@ class neg_vari final : public op_v_vari {
       avi_->adj_ -= adj_;
     }
   }
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    f(avi_, -1.0);
+  }
 };
 }  // namespace internal
 
@@ -16,6 +16,10 @@ class precomp_v_vari final : public op_v_vari {
   precomp_v_vari(double val, vari* avi, double da)
       : op_v_vari(val, avi), da_(da) {}
   void chain() { avi_->adj_ += adj_ * da_; }
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    f(avi_, da_);
+  }
 };
 
 }  // namespace math
@@ -20,6 +20,11 @@ class precomp_vv_vari final : public op_vv_vari {
     avi_->adj_ += adj_ * da_;
     bvi_->adj_ += adj_ * db_;
   }
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    f(avi_, da_);
+    f(bvi_, db_);
+  }
 };
 
 }  // namespace math
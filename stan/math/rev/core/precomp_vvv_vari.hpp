@@ -23,6 +23,12 @@ class precomp_vvv_vari final : public op_vvv_vari {
     bvi_->adj_ += adj_ * db_;
     cvi_->adj_ += adj_ * dc_;
   }
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    f(avi_, da_);
+    f(bvi_, db_);
+    f(cvi_, dc_);
+  }
 };
 
 }  // namespace math
@@ -2,6 +2,7 @@
 #define STAN_MATH_REV_CORE_PRECOMPUTED_GRADIENTS_HPP
 
 #include <stan/math/prim/err/check_matching_dims.hpp>
+#include <stan/math/rev/core/profiling.hpp>
 #include <stan/math/rev/core/vari.hpp>
 #include <stan/math/rev/core/var.hpp>
 #include <stan/math/rev/fun/dims.hpp>
@@ -55,6 +56,15 @@ class precomputed_gradients_vari_template : public vari {
          0)...});
   }
 
+  /**
+   * Records this node if automatic profiling is enabled.
+   */
+  inline void profile_node() const {
+    internal::auto_profile_node(
+        "precomputed_gradients_vari", this,
+        sizeof(*this) + size_ * (sizeof(vari*) + sizeof(double)));
+  }
+
  public:
   /**
    * Construct a precomputed vari with the specified value,
@@ -88,6 +98,7 @@ class precomputed_gradients_vari_template : public vari {
               to_arena(std::get<Is>(container_gradients))...);
         })) {
     check_sizes(std::make_index_sequence<N_containers>());
+    profile_node();
   }
 
   /**
@@ -137,6 +148,7 @@ class precomputed_gradients_vari_template : public vari {
       varis_[i] = vars[i].vi_;
     }
     std::copy(gradients.begin(), gradients.end(), gradients_);
+    profile_node();
   }
 
   /**
@@ -155,6 +167,20 @@ class precomputed_gradients_vari_template : public vari {
     });
   }
 
+  /**
+   * Call the specified functor with each of the scalar operands and the
+   * gradient with respect to it. The container operands are not visited.
+   *
+   * @tparam F type of the functor
+   * @param f functor taking a `vari*` and a `double`
+   */
+  template <typename F>
+  inline void for_each_partial(F&& f) const {
+    for (size_t i = 0; i < size_; ++i) {
+      f(varis_[i], gradients_[i]);
+    }
+  }
+
  private:
   /**
    * Implements the chain rule for one non-`std::vector` operand.
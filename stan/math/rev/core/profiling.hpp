@@ -0,0 +1,500 @@
+#ifndef STAN_MATH_REV_CORE_PROFILING_HPP
+#define STAN_MATH_REV_CORE_PROFILING_HPP
+
+#include <stan/math/rev/core/chainablestack.hpp>
+#include <stan/math/rev/core/vari.hpp>
+#include <stan/math/prim/meta/likely.hpp>
+#include <tbb/concurrent_unordered_map.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Profiling data of a named region of code executed on one thread: the
+ * time spent in the forward and reverse passes, the number of passes,
+ * the number of varis created and the number of bytes of the arena used
+ * in the forward passes.
+ *
+ * The reverse pass data is updated atomically, as the varis of a region
+ * can be chained on other threads than the one that created them.
+ */
+class profile_info {
+  bool active_{false};
+  int64_t fwd_time_{0};
+  size_t n_fwd_passes_{0};
+  size_t chain_stack_used_{0};
+  size_t nochain_stack_used_{0};
+  size_t arena_bytes_{0};
+  std::atomic<int64_t> rev_time_{0};
+  std::atomic<size_t> n_rev_passes_{0};
+
+ public:
+  profile_info() = default;
+
+  profile_info(const profile_info& other)
+      : active_(other.active_),
+        fwd_time_(other.fwd_time_),
+        n_fwd_passes_(other.n_fwd_passes_),
+        chain_stack_used_(other.chain_stack_used_),
+        nochain_stack_used_(other.nochain_stack_used_),
+        arena_bytes_(other.arena_bytes_),
+        rev_time_(other.rev_time_.load()),
+        n_rev_passes_(other.n_rev_passes_.load()) {}
+
+  profile_info& operator=(const profile_info&) = delete;
+
+  inline bool is_active() const noexcept { return active_; }
+  inline void set_active(bool active) noexcept { active_ = active; }
+
+  /**
+   * Record a forward pass through the region.
+   *
+   * @param time time spent in nanoseconds
+   * @param chain_stack_used number of varis put on the chaining stack
+   * @param nochain_stack_used number of varis put on the non-chaining stack
+   * @param arena_bytes number of bytes of the arena used
+   */
+  inline void add_fwd_pass(int64_t time, size_t chain_stack_used,
+                           size_t nochain_stack_used, size_t arena_bytes) {
+    fwd_time_ += time;
+    ++n_fwd_passes_;
+    chain_stack_used_ += chain_stack_used;
+    nochain_stack_used_ += nochain_stack_used;
+    arena_bytes_ += arena_bytes;
+  }
+
+  /**
+   * Record a reverse pass through the region.
+   *
+   * @param time time spent in nanoseconds
+   */
+  inline void add_rev_pass(int64_t time) {
+    rev_time_ += time;
+    ++n_rev_passes_;
+  }
+
+  /**
+   * Return the total time spent in the forward passes in seconds.
+   */
+  inline double get_fwd_time() const noexcept { return fwd_time_ * 1e-9; }
+
+  /**
+   * Return the total time spent in the reverse passes in seconds.
+   */
+  inline double get_rev_time() const noexcept { return rev_time_ * 1e-9; }
+
+  inline size_t get_num_fwd_passes() const noexcept { return n_fwd_passes_; }
+  inline size_t get_num_rev_passes() const noexcept { return n_rev_passes_; }
+  inline size_t get_chain_stack_used() const noexcept {
+    return chain_stack_used_;
+  }
+  inline size_t get_nochain_stack_used() const noexcept {
+    return nochain_stack_used_;
+  }
+  inline size_t get_arena_bytes() const noexcept { return arena_bytes_; }
+};
+
+using profile_key = std::pair<std::string, std::thread::id>;
+
+namespace internal {
+struct hash_profile_key {
+  inline size_t operator()(const profile_key& key) const {
+    return std::hash<std::string>()(key.first)
+           ^ std::hash<std::thread::id>()(key.second);
+  }
+};
+}  // namespace internal
+
+/**
+ * Map from the name of a region and the id of the thread that executed
+ * its forward passes to its profiling data. Entries can be added
+ * concurrently from several threads.
+ */
+using profile_map = tbb::concurrent_unordered_map<profile_key, profile_info,
+                                                  internal::hash_profile_key>;
+
+namespace internal {
+
+/**
+ * Return the time of a steady clock in nanoseconds.
+ */
+inline int64_t profile_clock() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/**
+ * Start time of the reverse pass through a region, shared by the two
+ * markers on the autodiff stack around the varis of the region.
+ */
+struct profile_timer {
+  int64_t start_;
+  profile_info* info_;
+};
+
+/**
+ * Marker put on the autodiff stack after the varis of a region, so that
+ * it is chained before them.
+ */
+class profile_start_vari : public vari_base {
+  profile_timer* timer_;
+
+ public:
+  explicit profile_start_vari(profile_timer* timer) : timer_(timer) {}
+  inline void chain() final { timer_->start_ = profile_clock(); }
+  inline void set_zero_adjoint() final {}
+};
+
+/**
+ * Marker put on the autodiff stack before the varis of a region, so that
+ * it is chained after them.
+ */
+class profile_stop_vari : public vari_base {
+  profile_timer* timer_;
+
+ public:
+  explicit profile_stop_vari(profile_timer* timer) : timer_(timer) {}
+  inline void chain() final {
+    timer_->info_->add_rev_pass(profile_clock() - timer_->start_);
+  }
+  inline void set_zero_adjoint() final {}
+};
+
+inline profile_timer* make_profile_timer(profile_info* info) {
+  return new (ChainableStack::instance_->memalloc_.alloc(sizeof(profile_timer)))
+      profile_timer{0, info};
+}
+
+/**
+ * Put markers around the varis of the autodiff stack from the specified
+ * position to the top, so that the time spent chaining them is recorded
+ * in the specified profile.
+ *
+ * @param info profile
+ * @param begin position of the first vari of the region
+ */
+inline void profile_stack_range(profile_info* info, size_t begin) {
+  auto& stack = ChainableStack::instance_->var_stack_;
+  if (begin >= stack.size()) {
+    return;
+  }
+  profile_timer* timer = make_profile_timer(info);
+  stack.insert(stack.begin() + begin, new profile_stop_vari(timer));
+  stack.push_back(new profile_start_vari(timer));
+}
+
+/**
+ * Return the profiles the automatically tagged nodes created on this
+ * thread are recorded in, or a null pointer if automatic tagging is
+ * disabled.
+ */
+inline profile_map*& auto_profile_map() {
+  static STAN_THREADS_DEF profile_map* map = nullptr;
+  return map;
+}
+
+/**
+ * Return the number of open automatically tagged regions on this thread.
+ * Nodes created inside a tagged region are attributed to the region.
+ */
+inline int& auto_profile_depth() {
+  static STAN_THREADS_DEF int depth = 0;
+  return depth;
+}
+
+/**
+ * Record a node on top of the autodiff stack under the specified name.
+ * Its forward time is not known, so only its reverse time, the node and
+ * its size are recorded.
+ *
+ * @param profiles profiles the node is recorded in
+ * @param name name the node is recorded under
+ * @param node node
+ * @param bytes number of bytes of the arena used by the node
+ */
+inline void record_auto_profile_node(profile_map* profiles, const char* name,
+                                     const vari_base* node, size_t bytes) {
+  auto& stack = ChainableStack::instance_->var_stack_;
+  if (auto_profile_depth() > 0 || stack.empty() || stack.back() != node) {
+    return;
+  }
+  profile_info* info
+      = &(*profiles)[profile_key{name, std::this_thread::get_id()}];
+  info->add_fwd_pass(0, 1, 0, bytes);
+  profile_stack_range(info, stack.size() - 1);
+}
+
+/**
+ * Record a node created while automatic tagging is enabled under the
+ * specified name. The node must be on top of the autodiff stack. When
+ * automatic tagging is disabled this only checks a pointer, the rest is
+ * kept out of line in `record_auto_profile_node()`.
+ *
+ * @param name name the node is recorded under
+ * @param node node
+ * @param bytes number of bytes of the arena used by the node
+ */
+inline void auto_profile_node(const char* name, const vari_base* node,
+                              size_t bytes) {
+  profile_map* profiles = auto_profile_map();
+  if (unlikely(profiles != nullptr)) {
+    record_auto_profile_node(profiles, name, node, bytes);
+  }
+}
+
+/**
+ * A class following the RAII idiom to record the forward pass from its
+ * construction to its destruction, and the reverse pass through the
+ * varis put on the autodiff stack in between, under the specified name
+ * if automatic tagging is enabled. Does nothing otherwise.
+ */
+class auto_profile_scope {
+  profile_info* info_{nullptr};
+  size_t chain_begin_;
+  size_t nochain_begin_;
+  size_t bytes_begin_;
+  int64_t start_;
+
+  void start(profile_map* profiles, const char* name) {
+    if (auto_profile_depth() > 0) {
+      return;
+    }
+    info_ = &(*profiles)[profile_key{name, std::this_thread::get_id()}];
+    ++auto_profile_depth();
+    chain_begin_ = ChainableStack::instance_->var_stack_.size();
+    nochain_begin_ = ChainableStack::instance_->var_nochain_stack_.size();
+    bytes_begin_ = ChainableStack::instance_->memalloc_.bytes_used();
+    start_ = profile_clock();
+  }
+
+  void stop() {
+    --auto_profile_depth();
+    info_->add_fwd_pass(
+        profile_clock() - start_,
+        ChainableStack::instance_->var_stack_.size() - chain_begin_,
+        ChainableStack::instance_->var_nochain_stack_.size() - nochain_begin_,
+        ChainableStack::instance_->memalloc_.bytes_used() - bytes_begin_);
+    profile_stack_range(info_, chain_begin_);
+  }
+
+ public:
+  explicit auto_profile_scope(const char* name) {
+    profile_map* profiles = auto_profile_map();
+    if (unlikely(profiles != nullptr)) {
+      start(profiles, name);
+    }
+  }
+
+  ~auto_profile_scope() {
+    if (unlikely(info_ != nullptr)) {
+      stop();
+    }
+  }
+
+  auto_profile_scope(const auto_profile_scope&) = delete;
+  auto_profile_scope& operator=(const auto_profile_scope&) = delete;
+};
+}  // namespace internal
+
+/**
+ * A class following the RAII idiom to profile a region of code. Example:
+ *
+ * profile_map profiles;
+ * {
+ *    profile p("likelihood", profiles);
+ *    lp += normal_lpdf(y, mu, sigma);
+ * }
+ * lp.grad();
+ * write_profile_csv(std::cout, profiles);
+ *
+ * The profile of the region records the time spent from the construction
+ * to the destruction, the varis and the bytes of the arena allocated in
+ * between, and the time spent chaining these varis in the reverse pass.
+ * The reverse pass is timed by two markers put on the autodiff stack
+ * around the varis of the region. Regions with different names can be
+ * nested; their profiles are inclusive.
+ */
+class profile {
+  profile_info* info_;
+  internal::profile_timer* timer_;
+  size_t chain_begin_;
+  size_t nochain_begin_;
+  size_t bytes_begin_;
+  int64_t start_;
+
+ public:
+  /**
+   * Start a profile.
+   *
+   * @param name name of the region
+   * @param profiles profiles the region is recorded in
+   * @throw std::runtime_error if a region with the same name is already
+   * active on this thread
+   */
+  profile(const std::string& name, profile_map& profiles)
+      : info_(&profiles[profile_key{name, std::this_thread::get_id()}]) {
+    if (info_->is_active()) {
+      throw std::runtime_error("Profile '" + name
+                               + "' is already active on this thread.");
+    }
+    info_->set_active(true);
+    timer_ = internal::make_profile_timer(info_);
+    ChainableStack::instance_->var_stack_.push_back(
+        new internal::profile_stop_vari(timer_));
+    chain_begin_ = ChainableStack::instance_->var_stack_.size();
+    nochain_begin_ = ChainableStack::instance_->var_nochain_stack_.size();
+    bytes_begin_ = ChainableStack::instance_->memalloc_.bytes_used();
+    start_ = internal::profile_clock();
+  }
+
+  ~profile() {
+    info_->add_fwd_pass(
+        internal::profile_clock() - start_,
+        ChainableStack::instance_->var_stack_.size() - chain_begin_,
+        ChainableStack::instance_->var_nochain_stack_.size() - nochain_begin_,
+        ChainableStack::instance_->memalloc_.bytes_used() - bytes_begin_);
+    info_->set_active(false);
+    ChainableStack::instance_->var_stack_.push_back(
+        new internal::profile_start_vari(timer_));
+  }
+
+  profile(const profile&) = delete;
+  profile& operator=(const profile&) = delete;
+  void* operator new(std::size_t) = delete;
+};
+
+/**
+ * A class following the RAII idiom to enable automatic tagging on the
+ * current thread. While it is alive, the nodes created by
+ * `operands_and_partials::build()` and the constructors of
+ * `callback_vari` and `precomputed_gradients_vari` are recorded in the
+ * specified profiles under the names `operands_and_partials`,
+ * `callback_vari` and `precomputed_gradients_vari`. Nodes created by
+ * `build()` are only recorded under `operands_and_partials`.
+ *
+ * When automatic tagging is disabled these functions only check a thread
+ * local pointer.
+ */
+class auto_profile {
+  profile_map* previous_;
+
+ public:
+  explicit auto_profile(profile_map& profiles)
+      : previous_(internal::auto_profile_map()) {
+    internal::auto_profile_map() = &profiles;
+  }
+
+  ~auto_profile() { internal::auto_profile_map() = previous_; }
+
+  auto_profile(const auto_profile&) = delete;
+  auto_profile& operator=(const auto_profile&) = delete;
+  void* operator new(std::size_t) = delete;
+};
+
+namespace internal {
+/**
+ * Return the entries of the profiles sorted by name and thread id.
+ *
+ * @param profiles profiles
+ */
+inline std::vector<const profile_map::value_type*> sorted_profiles(
+    const profile_map& profiles) {
+  std::vector<const profile_map::value_type*> entries;
+  for (const auto& entry : profiles) {
+    entries.push_back(&entry);
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const auto* a, const auto* b) { return a->first < b->first; });
+  return entries;
+}
+
+/**
+ * Write the specified string to the stream, escaping quotes by doubling
+ * them or by a backslash.
+ *
+ * @param out output stream
+ * @param str string
+ * @param json whether to escape for JSON instead of CSV
+ */
+inline void write_profile_name(std::ostream& out, const std::string& str,
+                               bool json) {
+  out << '"';
+  for (char c : str) {
+    if (c == '"') {
+      out << (json ? "\\\"" : "\"\"");
+    } else if (json && c == '\\') {
+      out << "\\\\";
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+}  // namespace internal
+
+/**
+ * Write the specified profiles to the stream as CSV, with a header line
+ * and one line per region and thread. Times are in seconds.
+ *
+ * @param out output stream
+ * @param profiles profiles
+ */
+inline void write_profile_csv(std::ostream& out, const profile_map& profiles) {
+  out << "name,thread_id,forward_time,reverse_time,forward_passes,"
+         "reverse_passes,chain_stack,no_chain_stack,arena_bytes\n";
+  for (const auto* entry : internal::sorted_profiles(profiles)) {
+    const profile_info& info = entry->second;
+    internal::write_profile_name(out, entry->first.first, false);
+    out << "," << entry->first.second << "," << info.get_fwd_time() << ","
+        << info.get_rev_time() << "," << info.get_num_fwd_passes() << ","
+        << info.get_num_rev_passes() << "," << info.get_chain_stack_used()
+        << "," << info.get_nochain_stack_used() << ","
+        << info.get_arena_bytes() << "\n";
+  }
+}
+
+/**
+ * Write the specified profiles to the stream as a JSON array with one
+ * object per region and thread. Times are in seconds.
+ *
+ * @param out output stream
+ * @param profiles profiles
+ */
+inline void write_profile_json(std::ostream& out,
+                               const profile_map& profiles) {
+  out << "[";
+  bool first = true;
+  for (const auto* entry : internal::sorted_profiles(profiles)) {
+    const profile_info& info = entry->second;
+    out << (first ? "\n" : ",\n") << "  {\"name\": ";
+    internal::write_profile_name(out, entry->first.first, true);
+    out << ", \"thread_id\": \"" << entry->first.second
+        << "\", \"forward_time\": " << info.get_fwd_time()
+        << ", \"reverse_time\": " << info.get_rev_time()
+        << ", \"forward_passes\": " << info.get_num_fwd_passes()
+        << ", \"reverse_passes\": " << info.get_num_rev_passes()
+        << ", \"chain_stack\": " << info.get_chain_stack_used()
+        << ", \"no_chain_stack\": " << info.get_nochain_stack_used()
+        << ", \"arena_bytes\": " << info.get_arena_bytes() << "}";
+    first = false;
+  }
+  out << (first ? "]\n" : "\n]\n");
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
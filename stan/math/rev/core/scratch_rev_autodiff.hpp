@@ -0,0 +1,83 @@
+#ifndef STAN_MATH_REV_CORE_SCRATCH_REV_AUTODIFF_HPP
+#define STAN_MATH_REV_CORE_SCRATCH_REV_AUTODIFF_HPP
+
+#include <stan/math/rev/core/chainable_alloc.hpp>
+#include <stan/math/rev/core/chainablestack.hpp>
+#include <stan/math/rev/core/set_zero_all_adjoints.hpp>
+#include <stan/math/rev/core/vari.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * A class following the RAII idiom to run autodiff on a scratch stack.
+ * This is a cheaper alternative to <code>nested_rev_autodiff</code> for
+ * small functions whose gradients are computed many times, such as the
+ * integrands of <code>integrate_1d()</code> or the right hand sides of
+ * ODEs. Example:
+ *
+ * var a; // allocated normally
+ * {
+ *    scratch_rev_autodiff scratch; // Switches to the scratch stack
+ *
+ *    var x = 2.0; // allocated on the scratch stack
+ *    var fx = f(x);
+ *    fx.grad(); // only chains the scratch stack
+ *
+ *    // The scratch stack is reset at the end of scope where scratch
+ *    // was declared, including exceptions, returns, etc.
+ * }
+ *
+ * While the scope is open, <code>ChainableStack::instance_</code> points
+ * to a separate autodiff stack owned by the stack that was active when
+ * the scope was opened. It is allocated the first time it is used and
+ * then reused, so opening a scope only swaps a pointer and closing it
+ * resets the stack and its arena in constant time, instead of recording
+ * and restoring the nested positions of every stack. New varis start
+ * with zero adjoints, so no zeroing pass is needed before the first
+ * gradient.
+ *
+ * Vars created before the scope can be used inside it, but vars created
+ * inside the scope must not be used after it is closed. Scopes can be
+ * nested; each level uses its own scratch stack.
+ */
+class scratch_rev_autodiff {
+  ChainableStack::AutodiffStackStorage* outer_;
+
+ public:
+  scratch_rev_autodiff() : outer_(ChainableStack::instance_) {
+    if (!outer_->scratch_) {
+      outer_->scratch_.reset(new ChainableStack::AutodiffStackStorage());
+    }
+    ChainableStack::instance_ = outer_->scratch_.get();
+  }
+
+  ~scratch_rev_autodiff() {
+    auto* scratch = ChainableStack::instance_;
+    scratch->var_stack_.clear();
+    scratch->var_nochain_stack_.clear();
+    for (auto* x : scratch->var_alloc_stack_) {
+      delete x;
+    }
+    scratch->var_alloc_stack_.clear();
+    scratch->nested_var_stack_sizes_.clear();
+    scratch->nested_var_nochain_stack_sizes_.clear();
+    scratch->nested_var_alloc_stack_starts_.clear();
+    scratch->memalloc_.recover_all();
+    ChainableStack::instance_ = outer_;
+  }
+
+  // Prevent undesirable operations
+  scratch_rev_autodiff(const scratch_rev_autodiff&) = delete;
+  scratch_rev_autodiff& operator=(const scratch_rev_autodiff&) = delete;
+  void* operator new(std::size_t) = delete;
+
+  /**
+   * Reset all adjoint values in the scratch stack to zero.
+   **/
+  inline void set_zero_all_adjoints() { stan::math::set_zero_all_adjoints(); }
+};
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,35 @@
+#ifndef STAN_MATH_REV_CORE_SET_ZERO_NOCHAIN_ADJOINTS_HPP
+#define STAN_MATH_REV_CORE_SET_ZERO_NOCHAIN_ADJOINTS_HPP
+
+#include <stan/math/rev/core/vari.hpp>
+#include <stan/math/rev/core/chainablestack.hpp>
+#include <stan/math/rev/core/empty_nested.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Reset the adjoint values of the varis that are not chained, the ones
+ * created with <code>stacked = false</code> such as the independent
+ * variables, to zero. Only the top nested portion of the stack is reset
+ * when nested autodiff is in progress.
+ *
+ * After <code>grad_and_zero_stack()</code> these are the only adjoints of
+ * the current scope that can be non-zero, so this is cheaper than
+ * <code>set_zero_all_adjoints()</code> between the gradients of the
+ * outputs of a function.
+ */
+static void set_zero_nochain_adjoints() {
+  auto& stack = ChainableStack::instance_->var_nochain_stack_;
+  const size_t start
+      = empty_nested()
+            ? 0
+            : ChainableStack::instance_->nested_var_nochain_stack_sizes_.back();
+  for (size_t i = start; i < stack.size(); ++i) {
+    stack[i]->set_zero_adjoint();
+  }
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,302 @@
+#ifndef STAN_MATH_REV_CORE_SIMPLIFY_TAPE_HPP
+#define STAN_MATH_REV_CORE_SIMPLIFY_TAPE_HPP
+
+#include <stan/math/rev/core/chainablestack.hpp>
+#include <stan/math/rev/core/operator_addition.hpp>
+#include <stan/math/rev/core/operator_multiplication.hpp>
+#include <stan/math/rev/core/operator_subtraction.hpp>
+#include <stan/math/rev/core/operator_unary_negative.hpp>
+#include <stan/math/rev/core/precomp_v_vari.hpp>
+#include <stan/math/rev/core/precomp_vv_vari.hpp>
+#include <stan/math/rev/core/precomp_vvv_vari.hpp>
+#include <stan/math/rev/core/precomputed_gradients.hpp>
+#include <stan/math/rev/core/var.hpp>
+#include <stan/math/rev/core/vari.hpp>
+#include <cmath>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Maximum number of operands of a node built by folding linear nodes.
+ * Bounding it keeps the pass linear in the size of the tape for long
+ * chains such as running sums.
+ */
+constexpr size_t SIMPLIFY_TAPE_MAX_TERMS = 16;
+
+using linear_terms_t = std::vector<std::pair<vari*, double>>;
+
+/**
+ * A node of the tape whose value is a linear function of its operands
+ * in the reverse pass, with the position of the node on the stack, the
+ * range of its operands and partials in the terms of the pass and the
+ * state of the simplification.
+ */
+struct linear_tape_node {
+  vari* vi_ = nullptr;
+  size_t pos_ = 0;
+  size_t begin_ = 0;
+  size_t size_ = 0;
+  size_t uses_ = 0;
+  bool relevant_ = false;
+  bool folded_ = false;
+  bool changed_ = false;
+};
+
+/**
+ * Node that replaces a linear node whose operands were folded into it.
+ * It propagates the adjoint of the original vari, which is still used by
+ * the vars and nodes that refer to it, to the operands of the folded
+ * nodes with the products of their partials.
+ */
+class linear_fold_vari final : public vari_base {
+  vari* vi_;
+  size_t size_;
+  vari** varis_;
+  double* partials_;
+
+ public:
+  linear_fold_vari(vari* vi, const std::pair<vari*, double>* terms,
+                   size_t size)
+      : vi_(vi),
+        size_(size),
+        varis_(ChainableStack::instance_->memalloc_.alloc_array<vari*>(size)),
+        partials_(
+            ChainableStack::instance_->memalloc_.alloc_array<double>(size)) {
+    for (size_t i = 0; i < size_; ++i) {
+      varis_[i] = terms[i].first;
+      partials_[i] = terms[i].second;
+    }
+  }
+
+  void chain() final {
+    const double adj = vi_->adj_;
+    for (size_t i = 0; i < size_; ++i) {
+      varis_[i]->adj_ += adj * partials_[i];
+    }
+  }
+
+  void set_zero_adjoint() final { vi_->adj_ = 0.0; }
+};
+
+/**
+ * Append the operands and partials of the node to the terms if it is of
+ * the specified type.
+ *
+ * @tparam T type of linear node
+ * @param node node of the tape
+ * @param[out] terms operands and partials
+ * @return vari of the node or `nullptr` if it is of another type
+ */
+template <typename T>
+inline vari* collect_linear_terms(vari_base* node, linear_terms_t& terms) {
+  // derived classes could override chain(), so the type must match exactly
+  if (typeid(*node) != typeid(T)) {
+    return nullptr;
+  }
+  T* x = static_cast<T*>(node);
+  x->for_each_partial([&](vari* operand, double partial) {
+    terms.emplace_back(operand, partial);
+  });
+  return x;
+}
+
+/**
+ * Append the operands and partials of the node to the terms if it is of
+ * one of the specified types.
+ *
+ * @tparam T first type of linear node
+ * @tparam T2 second type of linear node
+ * @tparam Ts other types of linear nodes
+ * @param node node of the tape
+ * @param[out] terms operands and partials
+ * @return vari of the node or `nullptr` if it is of another type
+ */
+template <typename T, typename T2, typename... Ts>
+inline vari* collect_linear_terms(vari_base* node, linear_terms_t& terms) {
+  vari* vi = collect_linear_terms<T>(node, terms);
+  return vi ? vi : collect_linear_terms<T2, Ts...>(node, terms);
+}
+
+/**
+ * Return the vari of the node and append its operands and partials to
+ * the terms if it is a linear node of a known type. Nodes with NaN values
+ * or partials are not returned, as their `chain()` methods propagate NaN
+ * differently.
+ *
+ * @param node node of the tape
+ * @param[in, out] terms operands and partials
+ * @return vari of the node or `nullptr` if it is not a linear node
+ */
+inline vari* linear_terms(vari_base* node, linear_terms_t& terms) {
+  const size_t begin = terms.size();
+  vari* vi = collect_linear_terms<
+      add_vv_vari, add_vd_vari, subtract_vv_vari, subtract_vd_vari,
+      subtract_dv_vari, multiply_vv_vari, multiply_vd_vari, neg_vari,
+      precomp_v_vari, precomp_vv_vari, precomp_vvv_vari,
+      precomputed_gradients_vari>(node, terms);
+  if (vi == nullptr) {
+    return nullptr;
+  }
+  bool is_nan = std::isnan(vi->val_);
+  for (size_t i = begin; i < terms.size(); ++i) {
+    is_nan = is_nan || std::isnan(terms[i].first->val_)
+             || std::isnan(terms[i].second);
+  }
+  if (is_nan) {
+    terms.resize(begin);
+    return nullptr;
+  }
+  return vi;
+}
+}  // namespace internal
+
+/**
+ * Simplify the autodiff tape of the current nested scope before the
+ * reverse pass for the specified dependent variable.
+ *
+ * The pass only rewrites the nodes whose partials are known: additions,
+ * subtractions, multiplications and negations of vars, the precomputed
+ * vari types and the scalar `precomputed_gradients_vari` nodes built by
+ * `operands_and_partials`. Any other node may use the vars created before
+ * it, so only the linear nodes created after the last node of another
+ * type are rewritten. Among those:
+ *
+ * - nodes that `y` does not depend on are removed from the stack;
+ * - a node used by a single other linear node is folded into it, which
+ *   then propagates its adjoint to the operands of both with composite
+ *   partials. Chains of such nodes, like running sums or linear
+ *   predictors, are folded into nodes of up to 16 operands, so the
+ *   reverse pass makes fewer virtual calls and adjoint updates.
+ *
+ * The gradient of `y` with respect to the independent variables is
+ * unchanged, but the adjoints of the removed and folded nodes are no
+ * longer computed. The pass must be called after all the vars that `y`
+ * depends on have been created and before `grad()`, and no vars that
+ * use the intermediate results may be created afterwards.
+ *
+ * The pass itself costs about as much as a few dozen reverse passes over
+ * the same tape, so it pays off when the gradient of the same tape is
+ * computed many times, with `set_zero_all_adjoints()` in between.
+ *
+ * @param y dependent variable
+ */
+inline void simplify_tape(const var& y) {
+  using internal::linear_tape_node;
+  auto& stack = ChainableStack::instance_->var_stack_;
+  const auto& nested_sizes = ChainableStack::instance_->nested_var_stack_sizes_;
+  const size_t start = nested_sizes.empty() ? 0 : nested_sizes.back();
+  const size_t end = stack.size();
+
+  std::vector<linear_tape_node> nodes;
+  std::unordered_map<const vari*, size_t> index;
+  internal::linear_terms_t terms;
+  nodes.reserve(end - start);
+  index.reserve(end - start);
+  terms.reserve(2 * (end - start));
+  // one past the position of the last node that is not linear
+  size_t first_simplified = start;
+  for (size_t i = start; i < end; ++i) {
+    linear_tape_node node;
+    node.begin_ = terms.size();
+    node.vi_ = internal::linear_terms(stack[i], terms);
+    if (node.vi_ == nullptr) {
+      first_simplified = i + 1;
+      continue;
+    }
+    node.pos_ = i;
+    node.size_ = terms.size() - node.begin_;
+    index.emplace(node.vi_, nodes.size());
+    nodes.push_back(node);
+  }
+
+  // Mark the nodes y depends on, counting the uses of each node by the
+  // other relevant ones and saving the index of the operands that are
+  // linear nodes. Consumers come after their operands on the stack.
+  const size_t not_linear = nodes.size();
+  std::vector<size_t> operands(terms.size(), not_linear);
+  auto root = index.find(y.vi_);
+  if (root != index.end()) {
+    nodes[root->second].relevant_ = true;
+  }
+  for (size_t n = nodes.size(); n-- > 0;) {
+    auto& node = nodes[n];
+    node.relevant_ = node.relevant_ || node.pos_ < first_simplified;
+    if (!node.relevant_) {
+      continue;
+    }
+    for (size_t k = node.begin_; k < node.begin_ + node.size_; ++k) {
+      auto operand = index.find(terms[k].first);
+      if (operand != index.end()) {
+        operands[k] = operand->second;
+        nodes[operand->second].relevant_ = true;
+        ++nodes[operand->second].uses_;
+      }
+    }
+  }
+
+  // Fold the operands used only once into their consumers, appending the
+  // new terms of the consumers at the end of the terms.
+  for (auto& node : nodes) {
+    if (!node.relevant_ || node.pos_ < first_simplified) {
+      continue;
+    }
+    const size_t begin = terms.size();
+    for (size_t k = 0; k < node.size_; ++k) {
+      const auto term = terms[node.begin_ + k];
+      const size_t operand = operands[node.begin_ + k];
+      if (operand != not_linear) {
+        auto& x = nodes[operand];
+        const size_t num_terms
+            = terms.size() - begin + x.size_ + node.size_ - k - 1;
+        if (x.pos_ >= first_simplified && x.uses_ == 1 && x.vi_ != y.vi_
+            && num_terms <= internal::SIMPLIFY_TAPE_MAX_TERMS) {
+          for (size_t j = x.begin_; j < x.begin_ + x.size_; ++j) {
+            const auto x_term = terms[j];
+            terms.emplace_back(x_term.first, term.second * x_term.second);
+            operands.push_back(operands[j]);
+          }
+          x.folded_ = true;
+          node.changed_ = true;
+          continue;
+        }
+      }
+      terms.push_back(term);
+      operands.push_back(operand);
+    }
+    if (node.changed_) {
+      node.begin_ = begin;
+      node.size_ = terms.size() - begin;
+    } else {
+      terms.resize(begin);
+      operands.resize(begin);
+    }
+  }
+
+  size_t next = start;
+  size_t n = 0;
+  for (size_t i = start; i < end; ++i) {
+    vari_base* node = stack[i];
+    if (n < nodes.size() && nodes[n].pos_ == i) {
+      const auto& linear = nodes[n++];
+      if (!linear.relevant_ || linear.folded_) {
+        continue;
+      }
+      if (linear.changed_) {
+        node = new internal::linear_fold_vari(
+            linear.vi_, terms.data() + linear.begin_, linear.size_);
+      }
+    }
+    stack[next++] = node;
+  }
+  stack.resize(next);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -33,6 +33,12 @@ class vari_base {
   /**
    * Apply the chain rule to this variable based on the variables
    * on which it depends.
+   *
+   * The adjoints that this method reads and writes, other than those
+   * this variable owns, must belong to variables created before it,
+   * whose `chain()` methods are called after this one. The reverse pass
+   * of `grad_and_zero_stack()` relies on this to reset the adjoint of
+   * each variable right after calling its `chain()` method.
    */
   virtual void chain() = 0;
   virtual void set_zero_adjoint() = 0;
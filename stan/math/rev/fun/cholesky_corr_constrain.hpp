@@ -0,0 +1,172 @@
+#ifndef STAN_MATH_REV_FUN_CHOLESKY_CORR_CONSTRAIN_HPP
+#define STAN_MATH_REV_FUN_CHOLESKY_CORR_CONSTRAIN_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/core/callback_vari.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
+#include <stan/math/rev/core/arena_matrix.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <cmath>
+#include <utility>
+
+namespace stan {
+namespace math {
+
+namespace internal {
+/**
+ * Return the Cholesky factor of a correlation matrix built from canonical
+ * partial correlations on the unconstrained scale, as a single node on the
+ * autodiff stack.
+ *
+ * Row `i` of the factor is filled left to right: `L(i, j) = z * w(i, j)`
+ * where `z = tanh(y)` is the partial correlation and
+ * `w(i, j) = sqrt(1 - sum(L(i, 0:j-1)^2))`, with `L(i, i) = w(i, i)`. The
+ * `w` are kept in the arena so the reverse pass is a single sweep over each
+ * row.
+ *
+ * @tparam T type of the vector of unconstrained values
+ * @tparam F type of the functor mapping a `(row, column)` pair of the factor
+ * to the position of its partial correlation in `y`
+ * @param y vector of unconstrained values
+ * @param K number of rows and columns of the factor
+ * @param position functor returning the index in `y` of element `(i, j)`
+ * @return Cholesky factor of a correlation matrix
+ */
+template <typename T, typename F, require_rev_col_vector_t<T>* = nullptr>
+inline auto cholesky_corr_L(const T& y, int K, const F& position) {
+  using ret_type = promote_var_matrix_t<Eigen::MatrixXd, T>;
+  using std::sqrt;
+
+  if (K == 0) {
+    return ret_type(Eigen::MatrixXd(0, 0));
+  }
+
+  arena_t<T> arena_y = y;
+  arena_t<Eigen::VectorXd> z = arena_y.val().array().tanh();
+  arena_t<Eigen::MatrixXd> w = Eigen::MatrixXd::Zero(K, K);
+  Eigen::MatrixXd L_val = Eigen::MatrixXd::Zero(K, K);
+  w.coeffRef(0, 0) = 1.0;
+  L_val.coeffRef(0, 0) = 1.0;
+  for (int i = 1; i < K; ++i) {
+    double sum_sqs = 0.0;
+    for (int j = 0; j < i; ++j) {
+      w.coeffRef(i, j) = sqrt(1.0 - sum_sqs);
+      L_val.coeffRef(i, j) = z.coeff(position(i, j)) * w.coeff(i, j);
+      sum_sqs += L_val.coeff(i, j) * L_val.coeff(i, j);
+    }
+    w.coeffRef(i, i) = sqrt(1.0 - sum_sqs);
+    L_val.coeffRef(i, i) = w.coeff(i, i);
+  }
+
+  arena_t<ret_type> L = L_val;
+
+  reverse_pass_callback([arena_y, z, w, L, K, position]() mutable {
+    Eigen::VectorXd z_adj = Eigen::VectorXd::Zero(z.size());
+    for (int i = 1; i < K; ++i) {
+      // adjoint of the running sum of squares, accumulated right to left
+      double sum_sqs_adj = -0.5 * L.adj().coeff(i, i) / w.coeff(i, i);
+      for (int j = i - 1; j >= 0; --j) {
+        const int pos = position(i, j);
+        const double L_ij_adj
+            = L.adj().coeff(i, j) + 2.0 * L.val().coeff(i, j) * sum_sqs_adj;
+        z_adj.coeffRef(pos) += L_ij_adj * w.coeff(i, j);
+        if (j > 0) {
+          sum_sqs_adj -= 0.5 * L_ij_adj * z.coeff(pos) / w.coeff(i, j);
+        }
+      }
+    }
+    arena_y.adj().array() += z_adj.array() * (1.0 - z.array().square());
+  });
+
+  return ret_type(L);
+}
+
+/**
+ * Increment the log density with the log absolute Jacobian determinant of a
+ * map from unconstrained values to canonical partial correlations that is a
+ * weighted sum `sum(weight * log1m(tanh(y)^2))`. Only a single node is added
+ * to the autodiff stack for the increment.
+ *
+ * @tparam T type of the vector of unconstrained values
+ * @param y vector of unconstrained values
+ * @param weight weight of the term for each element of `y`
+ * @param[in,out] lp log density accumulator
+ */
+template <typename T, require_rev_col_vector_t<T>* = nullptr>
+inline void corr_jacobian_lp(const T& y, const Eigen::VectorXd& weight,
+                             var& lp) {
+  if (y.size() == 0) {
+    return;
+  }
+  arena_t<T> arena_y = y;
+  Eigen::ArrayXd z = arena_y.val().array().tanh();
+  double lp_val = (weight.array() * (1.0 - z.square()).log()).sum();
+  arena_t<Eigen::VectorXd> lp_grad = -2.0 * weight.array() * z;
+  lp += var(make_callback_vari(std::move(lp_val),
+                               [arena_y, lp_grad](auto& vi) mutable {
+                                 arena_y.adj() += vi.adj_ * lp_grad;
+                               }));
+}
+}  // namespace internal
+
+/**
+ * Return the Cholesky factor of the correlation matrix of the specified
+ * dimensionality read from the specified vector of unconstrained values.
+ *
+ * The factor is computed in a single node on the autodiff stack rather than
+ * with scalar operations on its elements.
+ *
+ * @tparam T type of the vector of unconstrained values
+ * @param y vector of `K choose 2` unconstrained values
+ * @param K number of rows and columns of the factor
+ * @return Cholesky factor of a correlation matrix
+ * @throw std::invalid_argument if the size of `y` is not `K choose 2`
+ */
+template <typename T, require_rev_col_vector_t<T>* = nullptr>
+inline auto cholesky_corr_constrain(const T& y, int K) {
+  int k_choose_2 = (K * (K - 1)) / 2;
+  check_size_match("cholesky_corr_constrain", "y.size()", y.size(),
+                   "k_choose_2", k_choose_2);
+  return internal::cholesky_corr_L(
+      y, K, [](int i, int j) { return (i * (i - 1)) / 2 + j; });
+}
+
+/**
+ * Return the Cholesky factor of the correlation matrix of the specified
+ * dimensionality read from the specified vector of unconstrained values and
+ * increment the specified log density with the log absolute Jacobian
+ * determinant of the transform.
+ *
+ * Element `(i, j)` of the factor enters the Jacobian through
+ * `tanh` and through the `i - j - 1` square roots that follow it on its row,
+ * so the log Jacobian is `sum((1 + (i - j - 1) / 2) * log1m(tanh(y)^2))`.
+ *
+ * @tparam T type of the vector of unconstrained values
+ * @param y vector of `K choose 2` unconstrained values
+ * @param K number of rows and columns of the factor
+ * @param[in,out] lp log density accumulator
+ * @return Cholesky factor of a correlation matrix
+ * @throw std::invalid_argument if the size of `y` is not `K choose 2`
+ */
+template <typename T, require_rev_col_vector_t<T>* = nullptr>
+inline auto cholesky_corr_constrain(const T& y, int K, scalar_type_t<T>& lp) {
+  int k_choose_2 = (K * (K - 1)) / 2;
+  check_size_match("cholesky_corr_constrain", "y.size()", y.size(),
+                   "k_choose_2", k_choose_2);
+  Eigen::VectorXd weight(k_choose_2);
+  int k = 0;
+  for (int i = 1; i < K; ++i) {
+    for (int j = 0; j < i; ++j) {
+      weight.coeffRef(k++) = 1.0 + 0.5 * (i - j - 1);
+    }
+  }
+  arena_t<T> arena_y = y;
+  internal::corr_jacobian_lp(arena_y, weight, lp);
+  return cholesky_corr_constrain(arena_y, K);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -5,6 +5,7 @@
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
 #include <stan/math/prim/fun/cholesky_decompose.hpp>
+#include <stan/math/prim/fun/parallel_cholesky.hpp>
 #include <stan/math/rev/fun/value_of_rec.hpp>
 #include <stan/math/rev/fun/value_of.hpp>
 #include <stan/math/rev/core.hpp>
@@ -12,6 +13,7 @@
 #include <stan/math/prim/err/check_pos_definite.hpp>
 #include <stan/math/prim/err/check_square.hpp>
 #include <stan/math/prim/err/check_symmetric.hpp>
+#include <stan/math/prim/err/throw_domain_error.hpp>
 
 #ifdef STAN_OPENCL
 #include <stan/math/opencl/opencl.hpp>
@@ -79,10 +81,15 @@ inline auto unblocked_cholesky_lambda(T1& L_A, T2& L, T3& A) {
  *
  * Iain Murray: Differentiation of the Cholesky decomposition, 2016.
  *
+ * The block size is given by `cholesky_block_size()`. For matrices with
+ * at least `opts.parallel_size` rows the triangular solve and the
+ * products updating the off-diagonal blocks are split across TBB tasks
+ * by rows or columns.
  */
 template <typename T1, typename T2, typename T3>
-inline auto cholesky_lambda(T1& L_A, T2& L, T3& A) {
-  return [L_A, L, A]() mutable {
+inline auto cholesky_lambda(T1& L_A, T2& L, T3& A,
+                            const cholesky_tuning& opts) {
+  return [L_A, L, A, opts]() mutable {
     using Block_ = Eigen::Block<Eigen::MatrixXd>;
     using Eigen::Lower;
     using Eigen::StrictlyUpper;
@@ -90,8 +97,8 @@ inline auto cholesky_lambda(T1& L_A, T2& L, T3& A) {
     Eigen::MatrixXd L_adj(L.rows(), L.cols());
     L_adj.template triangularView<Eigen::Lower>() = L.adj();
     const int M_ = L_A.rows();
-    int block_size_ = std::max(M_ / 8, 8);
-    block_size_ = std::min(block_size_, 128);
+    const int block_size_ = cholesky_block_size(M_, opts);
+    const bool parallel = M_ >= opts.parallel_size;
     for (int k = M_; k > 0; k -= block_size_) {
       int j = std::max(0, k - block_size_);
       auto R = L_A.block(j, 0, k - j, j);
@@ -104,10 +111,15 @@ inline auto cholesky_lambda(T1& L_A, T2& L, T3& A) {
       auto C_adj = L_adj.block(k, j, M_ - k, k - j);
       D.transposeInPlace();
       if (C_adj.size() > 0) {
-        C_adj = D.template triangularView<Upper>()
-                    .solve(C_adj.transpose())
-                    .transpose();
-        B_adj.noalias() -= C_adj * R;
+        internal::parallel_for_ranges(
+            M_ - k, parallel, opts.grain_size,
+            [&](Eigen::Index start, Eigen::Index size) {
+              auto C_adj_rows = C_adj.middleRows(start, size);
+              D.template triangularView<Upper>()
+                  .transpose()
+                  .template solveInPlace<Eigen::OnTheRight>(C_adj_rows);
+              B_adj.middleRows(start, size).noalias() -= C_adj_rows * R;
+            });
         D_adj.noalias() -= C_adj.transpose() * C;
       }
       D_adj = (D * D_adj.template triangularView<Lower>()).eval();
@@ -115,8 +127,15 @@ inline auto cholesky_lambda(T1& L_A, T2& L, T3& A) {
           = D_adj.adjoint().template triangularView<StrictlyUpper>();
       D.template triangularView<Upper>().solveInPlace(D_adj);
       D.template triangularView<Upper>().solveInPlace(D_adj.transpose());
-      R_adj.noalias() -= C_adj.transpose() * B;
-      R_adj.noalias() -= D_adj.template selfadjointView<Lower>() * R;
+      internal::parallel_for_ranges(
+          j, parallel, opts.grain_size,
+          [&](Eigen::Index start, Eigen::Index size) {
+            auto R_adj_cols = R_adj.middleCols(start, size);
+            R_adj_cols.noalias()
+                -= C_adj.transpose() * B.middleCols(start, size);
+            R_adj_cols.noalias() -= D_adj.template selfadjointView<Lower>()
+                                    * R.middleCols(start, size);
+          });
       D_adj.diagonal() *= 0.5;
     }
     A.adj().template triangularView<Eigen::Lower>() = L_adj;
@@ -205,10 +224,14 @@ inline auto opencl_cholesky_lambda(AMat& arena_A, LVari& vari_L) {
  * Note chainable stack varis are created below in Matrix<var, -1, -1>
  *
  * @param A Matrix
+ * @param opts tuning parameters of the blocked algorithms used for large
+ * matrices, see `cholesky_tuning`
  * @return L cholesky factor of A
  */
 template <typename EigMat, require_eigen_vt<is_var, EigMat>* = nullptr>
-inline auto cholesky_decompose(const EigMat& A) {
+inline auto cholesky_decompose(const EigMat& A,
+                               const cholesky_tuning& opts
+                               = cholesky_tuning()) {
   check_square("cholesky_decompose", "A", A);
   arena_t<EigMat> arena_A = A;
   arena_t<Eigen::Matrix<double, -1, -1>> L_A(arena_A.val());
@@ -216,8 +239,15 @@ inline auto cholesky_decompose(const EigMat& A) {
   L_A = cholesky_decompose(L_A);
 #else
   check_symmetric("cholesky_decompose", "A", A);
-  Eigen::LLT<Eigen::Ref<Eigen::MatrixXd>, Eigen::Lower> L_factor(L_A);
-  check_pos_definite("cholesky_decompose", "m", L_factor);
+  if (L_A.rows() >= opts.parallel_size) {
+    if (!internal::cholesky_blocked_in_place(L_A, opts)) {
+      throw_domain_error("cholesky_decompose", "Matrix",
+                         " is not positive definite", "m");
+    }
+  } else {
+    Eigen::LLT<Eigen::Ref<Eigen::MatrixXd>, Eigen::Lower> L_factor(L_A);
+    check_pos_definite("cholesky_decompose", "m", L_factor);
+  }
 #endif
   L_A.template triangularView<Eigen::StrictlyUpper>().setZero();
   // looping gradient calcs faster for small matrices compared to
@@ -247,11 +277,11 @@ inline auto cholesky_decompose(const EigMat& A) {
       reverse_pass_callback(internal::opencl_cholesky_lambda(arena_A, vari_L));
     } else {
       internal::initialize_return(L, L_A, dummy);
-      reverse_pass_callback(internal::cholesky_lambda(L_A, L, arena_A));
+      reverse_pass_callback(internal::cholesky_lambda(L_A, L, arena_A, opts));
     }
 #else
     internal::initialize_return(L, L_A, dummy);
-    reverse_pass_callback(internal::cholesky_lambda(L_A, L, arena_A));
+    reverse_pass_callback(internal::cholesky_lambda(L_A, L, arena_A, opts));
 #endif
   }
   return plain_type_t<EigMat>(L);
@@ -266,20 +296,85 @@ inline auto cholesky_decompose(const EigMat& A) {
  * Note chainable stack varis are created below in Matrix<var, -1, -1>
  * @tparam T A `var_value` holding an inner eigen type.
  * @param A A square positive definite matrix with no nan values.
+ * @param opts tuning parameters of the blocked algorithms used for large
+ * matrices, see `cholesky_tuning`
  * @return L Cholesky factor of A
  */
 template <typename T, require_var_matrix_t<T>* = nullptr>
-inline auto cholesky_decompose(const T& A) {
+inline auto cholesky_decompose(const T& A,
+                               const cholesky_tuning& opts
+                               = cholesky_tuning()) {
   check_symmetric("cholesky_decompose", "A", A.val());
-  T L = cholesky_decompose(A.val());
+  T L = cholesky_decompose(A.val(), opts);
   if (A.rows() <= 35) {
     reverse_pass_callback(internal::unblocked_cholesky_lambda(L.val(), L, A));
   } else {
-    reverse_pass_callback(internal::cholesky_lambda(L.val(), L, A));
+    reverse_pass_callback(internal::cholesky_lambda(L.val(), L, A, opts));
   }
   return L;
 }
 
+/**
+ * Reverse mode specialization of the Cholesky decomposition of a batch of
+ * square, symmetric matrices of the same size.
+ *
+ * The matrices are factored together with `internal::batch_cholesky()`
+ * and the adjoints of all of them are propagated by a single reverse pass
+ * callback, so the cost per matrix is a few arena allocations shared by
+ * the whole batch rather than a vari and its allocations per matrix.
+ *
+ * @tparam EigMat type of the matrices
+ * @param A batch of symmetric matrices
+ * @return Cholesky factors of the matrices
+ * @throw std::invalid_argument if the matrices are not square or do not
+ *   all have the same size
+ * @throw std::domain_error if a matrix is not symmetric, contains a NaN
+ *   or is not positive definite
+ */
+template <typename EigMat, require_eigen_vt<is_var, EigMat>* = nullptr>
+inline std::vector<
+    Eigen::Matrix<var, EigMat::RowsAtCompileTime, EigMat::ColsAtCompileTime>>
+cholesky_decompose(const std::vector<EigMat>& A) {
+  using ret_t = Eigen::Matrix<var, EigMat::RowsAtCompileTime,
+                              EigMat::ColsAtCompileTime>;
+  if (A.empty()) {
+    return {};
+  }
+  internal::check_batch_sizes("cholesky_decompose", "A", A);
+  for (size_t k = 0; k < A.size(); ++k) {
+    check_square("cholesky_decompose", "A", A[k]);
+    check_not_nan("cholesky_decompose", "A", A[k]);
+    check_symmetric("cholesky_decompose", "A", A[k]);
+  }
+  const Eigen::Index n = A[0].rows();
+  arena_t<Eigen::Matrix<var, -1, -1>> arena_A = internal::to_batch(A);
+  arena_t<Eigen::MatrixXd> L_val(arena_A.rows(), arena_A.cols());
+  const Eigen::Index failed
+      = internal::batch_cholesky(arena_A.val().eval(), n, L_val);
+  if (failed >= 0) {
+    throw_domain_error("cholesky_decompose", "Matrix", failed + 1, "number ",
+                       " is not positive definite.");
+  }
+  // the strictly upper triangles share a single constant vari
+  vari* dummy = new vari(0.0, false);
+  arena_t<Eigen::Matrix<var, -1, -1>> L(L_val.rows(), L_val.cols());
+  for (Eigen::Index j = 0; j < n; ++j) {
+    for (Eigen::Index i = 0; i < n; ++i) {
+      for (Eigen::Index b = 0; b < L.rows(); ++b) {
+        L.coeffRef(b, i + j * n).vi_
+            = i < j ? dummy : new vari(L_val.coeff(b, i + j * n), false);
+      }
+    }
+  }
+  reverse_pass_callback([arena_A, L_val, L, n]() mutable {
+    Eigen::MatrixXd A_adj
+        = Eigen::MatrixXd::Zero(arena_A.rows(), arena_A.cols());
+    internal::batch_cholesky_adjoint(L_val, L.adj().eval(), n, A_adj);
+    arena_A.adj() += A_adj;
+  });
+  return internal::from_batch<ret_t>(L, n, n);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,117 @@
+#ifndef STAN_MATH_REV_FUN_CHOLESKY_FACTOR_CONSTRAIN_HPP
+#define STAN_MATH_REV_FUN_CHOLESKY_FACTOR_CONSTRAIN_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/core/callback_vari.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
+#include <stan/math/rev/core/arena_matrix.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <cmath>
+#include <utility>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the Cholesky factor of the specified size read from the
+ * specified vector.  A total of (N choose 2) + N + (M - N) * N
+ * elements are required to read an M by N Cholesky factor.
+ *
+ * The factor is a single node on the autodiff stack; the reverse pass
+ * copies the adjoints of the factor back to the vector, scaling those
+ * of the diagonal by the exponentiated values.
+ *
+ * @tparam T type of the vector of unconstrained values
+ * @param x Vector of unconstrained values
+ * @param M number of rows
+ * @param N number of columns
+ * @return Cholesky factor
+ */
+template <typename T, require_rev_col_vector_t<T>* = nullptr>
+inline auto cholesky_factor_constrain(const T& x, int M, int N) {
+  using ret_type = promote_var_matrix_t<Eigen::MatrixXd, T>;
+  using std::exp;
+  check_greater_or_equal("cholesky_factor_constrain",
+                         "num rows (must be greater or equal to num cols)", M,
+                         N);
+  check_size_match("cholesky_factor_constrain", "x.size()", x.size(),
+                   "((N * (N + 1)) / 2 + (M - N) * N)",
+                   ((N * (N + 1)) / 2 + (M - N) * N));
+  arena_t<T> arena_x = x;
+  const Eigen::VectorXd x_val = arena_x.val();
+  Eigen::MatrixXd y_val = Eigen::MatrixXd::Zero(M, N);
+  int pos = 0;
+  for (int m = 0; m < N; ++m) {
+    y_val.row(m).head(m) = x_val.segment(pos, m);
+    pos += m;
+    y_val.coeffRef(m, m) = exp(x_val.coeff(pos++));
+  }
+  for (int m = N; m < M; ++m) {
+    y_val.row(m) = x_val.segment(pos, N);
+    pos += N;
+  }
+
+  arena_t<ret_type> y = y_val;
+
+  reverse_pass_callback([arena_x, y, M, N]() mutable {
+    int pos = 0;
+    for (int m = 0; m < N; ++m) {
+      for (int n = 0; n < m; ++n) {
+        arena_x.adj().coeffRef(pos++) += y.adj().coeff(m, n);
+      }
+      arena_x.adj().coeffRef(pos++)
+          += y.adj().coeff(m, m) * y.val().coeff(m, m);
+    }
+    for (int m = N; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        arena_x.adj().coeffRef(pos++) += y.adj().coeff(m, n);
+      }
+    }
+  });
+
+  return ret_type(y);
+}
+
+/**
+ * Return the Cholesky factor of the specified size read from the
+ * specified vector and increment the specified log probability
+ * reference with the log Jacobian adjustment of the transform, the sum
+ * of the unconstrained values on the diagonal.  The increment is a
+ * single node on the autodiff stack.
+ *
+ * @tparam T type of the vector of unconstrained values
+ * @param x Vector of unconstrained values
+ * @param M number of rows
+ * @param N number of columns
+ * @param lp Log probability that is incremented with the log Jacobian
+ * @return Cholesky factor
+ */
+template <typename T, require_rev_col_vector_t<T>* = nullptr>
+inline auto cholesky_factor_constrain(const T& x, int M, int N,
+                                      scalar_type_t<T>& lp) {
+  check_size_match("cholesky_factor_constrain", "x.size()", x.size(),
+                   "((N * (N + 1)) / 2 + (M - N) * N)",
+                   ((N * (N + 1)) / 2 + (M - N) * N));
+  arena_t<T> arena_x = x;
+  double lp_val = 0;
+  int pos = 0;
+  for (int n = 0; n < N; ++n) {
+    pos += n;
+    lp_val += arena_x.val().coeff(pos++);
+  }
+  lp += var(make_callback_vari(std::move(lp_val),
+                               [arena_x, N](auto& vi) mutable {
+                                 int pos = 0;
+                                 for (int n = 0; n < N; ++n) {
+                                   pos += n;
+                                   arena_x.adj().coeffRef(pos++) += vi.adj_;
+                                 }
+                               }));
+  return cholesky_factor_constrain(arena_x, M, N);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -0,0 +1,79 @@
+#ifndef STAN_MATH_REV_FUN_CORR_MATRIX_CONSTRAIN_HPP
+#define STAN_MATH_REV_FUN_CORR_MATRIX_CONSTRAIN_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/cholesky_corr_constrain.hpp>
+#include <stan/math/rev/fun/multiply_lower_tri_self_transpose.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the correlation matrix of the specified dimensionality
+ * derived from the specified vector of unconstrained values.  The
+ * input vector must be of length \f${k \choose 2} =
+ * \frac{k(k-1)}{2}\f$.  The values in the input vector represent
+ * unconstrained (partial) correlations among the dimensions, read
+ * column-wise as in <code>read_corr_L</code>.
+ *
+ * The Cholesky factor and its product with its transpose are each a
+ * single node on the autodiff stack.
+ *
+ * @tparam T type of the vector of unconstrained values
+ * @param x Vector of unconstrained partial correlations.
+ * @param k Dimensionality of returned correlation matrix.
+ * @throw std::invalid_argument if the size of x is not k choose 2
+ */
+template <typename T, require_rev_col_vector_t<T>* = nullptr>
+inline auto corr_matrix_constrain(const T& x, Eigen::Index k) {
+  Eigen::Index k_choose_2 = (k * (k - 1)) / 2;
+  check_size_match("corr_matrix_constrain", "x.size()", x.size(), "k_choose_2",
+                   k_choose_2);
+  const int K = k;
+  auto position
+      = [K](int i, int j) { return (j * (2 * K - j - 1)) / 2 + i - j - 1; };
+  return multiply_lower_tri_self_transpose(
+      internal::cholesky_corr_L(x, K, position));
+}
+
+/**
+ * Return the correlation matrix of the specified dimensionality
+ * derived from the specified vector of unconstrained values and
+ * increment the specified log probability reference with the log
+ * absolute Jacobian determinant of the transform.
+ *
+ * The partial correlation in column `j` enters the Jacobian through
+ * `tanh` and through the transform of partial correlations to
+ * correlations of the LKJ paper, so the log Jacobian is
+ * `sum((1 + (k - j - 2) / 2) * log1m(tanh(x)^2))`.
+ *
+ * @tparam T type of the vector of unconstrained values
+ * @param x Vector of unconstrained partial correlations.
+ * @param k Dimensionality of returned correlation matrix.
+ * @param lp Log probability reference to increment.
+ * @throw std::invalid_argument if the size of x is not k choose 2
+ */
+template <typename T, require_rev_col_vector_t<T>* = nullptr>
+inline auto corr_matrix_constrain(const T& x, Eigen::Index k,
+                                  scalar_type_t<T>& lp) {
+  Eigen::Index k_choose_2 = (k * (k - 1)) / 2;
+  check_size_match("corr_matrix_constrain", "x.size()", x.size(), "k_choose_2",
+                   k_choose_2);
+  Eigen::VectorXd weight(k_choose_2);
+  Eigen::Index pos = 0;
+  for (Eigen::Index j = 0; j < k - 1; ++j) {
+    for (Eigen::Index i = j + 1; i < k; ++i) {
+      weight.coeffRef(pos++) = 1.0 + 0.5 * (k - j - 2);
+    }
+  }
+  arena_t<T> arena_x = x;
+  internal::corr_jacobian_lp(arena_x, weight, lp);
+  return corr_matrix_constrain(arena_x, k);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
@@ -6,6 +6,7 @@
 #include <stan/math/prim/fun/isinf.hpp>
 #include <stan/math/prim/fun/isfinite.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/fun/abs.hpp>
 #include <stan/math/rev/fun/cosh.hpp>
@@ -63,6 +64,17 @@ inline std::complex<var> cos(const std::complex<var>& z) {
   return stan::math::internal::complex_cos(z);
 }
 
+/**
+ * Derivative of `cos()` for its vectorized reverse mode over Eigen
+ * matrices of `var`.
+ */
+template <>
+struct apply_scalar_unary_partial<cos_fun> {
+  static inline double partial(double x, double /* cos_x */) {
+    return -std::sin(x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
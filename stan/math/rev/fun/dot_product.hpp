@@ -67,6 +67,50 @@ inline var dot_product(const T1& v1, const T2& v2) {
   }
 }
 
+/**
+ * Returns the dot product of two vectors, at least one of which is a
+ * `var_value` with an inner Eigen vector type.
+ *
+ * @tparam T1 type of the first vector
+ * @tparam T2 type of the second vector
+ *
+ * @param[in] v1 First vector.
+ * @param[in] v2 Second vector.
+ * @return Dot product of the vectors.
+ * @throw std::domain_error if sizes of v1 and v2 do not match.
+ */
+template <typename T1, typename T2, require_all_matrix_t<T1, T2>* = nullptr,
+          require_any_var_matrix_t<T1, T2>* = nullptr>
+inline var dot_product(const T1& v1, const T2& v2) {
+  check_matching_sizes("dot_product", "v1", v1, "v2", v2);
+  if (!is_constant<T1>::value && !is_constant<T2>::value) {
+    arena_t<promote_scalar_t<var, T1>> arena_v1 = v1;
+    arena_t<promote_scalar_t<var, T2>> arena_v2 = v2;
+    var res(arena_v1.val().dot(arena_v2.val()));
+    reverse_pass_callback([arena_v1, arena_v2, res]() mutable {
+      arena_v1.adj() += res.adj() * arena_v2.val();
+      arena_v2.adj() += res.adj() * arena_v1.val();
+    });
+    return res;
+  } else if (!is_constant<T2>::value) {
+    arena_t<promote_scalar_t<double, T1>> arena_v1 = value_of(v1);
+    arena_t<promote_scalar_t<var, T2>> arena_v2 = v2;
+    var res(arena_v1.dot(arena_v2.val()));
+    reverse_pass_callback([arena_v1, arena_v2, res]() mutable {
+      arena_v2.adj() += res.adj() * arena_v1;
+    });
+    return res;
+  } else {
+    arena_t<promote_scalar_t<var, T1>> arena_v1 = v1;
+    arena_t<promote_scalar_t<double, T2>> arena_v2 = value_of(v2);
+    var res(arena_v1.val().dot(arena_v2));
+    reverse_pass_callback([arena_v1, arena_v2, res]() mutable {
+      arena_v1.adj() += res.adj() * arena_v2;
+    });
+    return res;
+  }
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
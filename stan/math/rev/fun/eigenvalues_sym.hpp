@@ -3,91 +3,62 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
-#include <stan/math/rev/fun/value_of_rec.hpp>
+#include <stan/math/rev/core/arena_matrix.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
 #include <stan/math/rev/fun/typedefs.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/spectral_decomposition.hpp>
 #include <stan/math/prim/err/check_symmetric.hpp>
 #include <stan/math/prim/err/check_nonzero_size.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
-#include <stan/math/prim/fun/value_of_rec.hpp>
 
 namespace stan {
 namespace math {
 
-namespace internal {
-class eigenvalues_vari : public vari {
- public:
-  int M_;  // A.rows() = A.cols()
-  double *A_;
-  double *w_;  // eigenvalues
-  double *v_;  // eigenvectors
-  vari **vari_ref_A_;
-  vari **vari_ref_w_;
-  vari **vari_ref_v_;
-
-  explicit eigenvalues_vari(const Eigen::Matrix<var, -1, -1> &A)
-      : vari(0.0),
-        M_(A.rows()),
-        A_(ChainableStack::instance_->memalloc_.alloc_array<double>(
-            A.rows() * A.cols())),
-        w_(ChainableStack::instance_->memalloc_.alloc_array<double>(A.rows())),
-        v_(ChainableStack::instance_->memalloc_.alloc_array<double>(
-            A.rows() * A.cols())),
-        vari_ref_A_(ChainableStack::instance_->memalloc_.alloc_array<vari *>(
-            A.rows() * A.cols())),
-        vari_ref_w_(ChainableStack::instance_->memalloc_.alloc_array<vari *>(
-            A.rows())) {
-    using Eigen::Map;
-
-    Map<matrix_d> Ad(A_, M_, M_);
-    Map<matrix_d> wd(w_, M_, 1);
-    Map<matrix_d> vd(v_, M_, M_);
-    Ad = A.val();
-    Eigen::SelfAdjointEigenSolver<matrix_d> solver(Ad);
-    wd = solver.eigenvalues();
-    vd = solver.eigenvectors();
-
-    Map<matrix_vi>(vari_ref_A_, M_, M_) = A.vi();
-    Map<vector_vi>(vari_ref_w_, M_)
-        = wd.unaryExpr([](double x) { return new vari(x, false); });
-  }
-
-  /**
-   * Reverse mode differentiation algorithm reference:
-   *
-   * Mike Giles. An extended collection of matrix derivative results for
-   * forward and reverse mode AD.  Jan. 2008.
-   *
-   * Section 3.1 Eigenvalues and eigenvectors.
-   */
-  virtual void chain() {
-    using Eigen::Map;
-
-    matrix_d adj_w = Map<matrix_vi>(vari_ref_w_, M_, 1).adj();
-    Map<matrix_d> v(v_, M_, M_);
-
-    matrix_d adjA = v * adj_w.asDiagonal() * v.transpose();
-
-    Map<matrix_vi>(vari_ref_A_, M_, M_).adj() += adjA;
-  }
-};
-}  // namespace internal
-
 /**
  * Return the eigenvalues of the specified symmetric matrix.
  * <p>See <code>eigen_decompose()</code> for more information.
+ *
+ * The eigenvectors needed for the adjoints are kept in arena memory and
+ * a single callback propagates the adjoints of all eigenvalues. Large
+ * matrices are decomposed with a divide and conquer algorithm and the
+ * products of the adjoint are computed in parallel.
+ *
+ * Reverse mode differentiation algorithm reference:
+ *
+ * Mike Giles. An extended collection of matrix derivative results for
+ * forward and reverse mode AD.  Jan. 2008.
+ *
+ * Section 3.1 Eigenvalues and eigenvectors.
+ *
+ * @tparam T type of the matrix, either an Eigen matrix of vars or a
+ * `var_value` with an inner Eigen matrix
  * @param m Specified matrix.
+ * @param opts tuning parameters of the decompositions and products used
+ * for large matrices, see `spectral_tuning`
  * @return Eigenvalues of matrix.
  */
-inline vector_v eigenvalues_sym(const matrix_v &m) {
-  matrix_d m_eval(value_of_rec(m));
-  check_nonzero_size("eigenvalues_sym", "m", m_eval);
-  check_symmetric("eigenvalues_sym", "m", m_eval);
-  vector_v res(m.rows());
-  internal::eigenvalues_vari *baseVari = new internal::eigenvalues_vari(m);
-  res.vi()
-      = Eigen::Map<vector_vi>(baseVari->vari_ref_w_, res.rows(), res.cols());
-  return res;
+template <typename T, require_rev_matrix_t<T>* = nullptr>
+inline auto eigenvalues_sym(const T& m,
+                            const spectral_tuning& opts = spectral_tuning()) {
+  using ret_type = promote_var_matrix_t<Eigen::VectorXd, T>;
+  arena_t<T> arena_m = m;
+  check_nonzero_size("eigenvalues_sym", "m", arena_m);
+  check_symmetric("eigenvalues_sym", "m", arena_m.val());
+
+  Eigen::VectorXd eigenvals;
+  Eigen::MatrixXd eigenvecs_val;
+  internal::eigendecompose_sym(arena_m.val(), eigenvals, eigenvecs_val,
+                               opts);
+  arena_t<ret_type> res = eigenvals;
+  arena_t<Eigen::MatrixXd> eigenvecs = eigenvecs_val;
+
+  reverse_pass_callback([arena_m, res, eigenvecs, opts]() mutable {
+    arena_m.adj() += internal::spectral_multiply(
+        eigenvecs * res.adj().asDiagonal(), eigenvecs.transpose(), opts);
+  });
+
+  return ret_type(res);
 }
 
 }  // namespace math
@@ -3,6 +3,8 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
 #include <stan/math/prim/fun/cos.hpp>
 #include <stan/math/prim/fun/exp.hpp>
 #include <stan/math/rev/fun/is_inf.hpp>
@@ -57,6 +59,35 @@ inline std::complex<var> exp(const std::complex<var>& z) {
   return internal::complex_exp(z);
 }
 
+/**
+ * Return the elementwise exponential of the specified `var_value`
+ * matrix.
+ *
+ * @tparam T a `var_value` with an inner Eigen type
+ * @param x matrix
+ * @return Elementwise exponential of the matrix.
+ */
+template <typename T, require_var_matrix_t<T>* = nullptr>
+inline auto exp(const T& x) {
+  using ret_type = promote_var_matrix_t<value_type_t<T>, T>;
+  ret_type res(x.val().array().exp().matrix());
+  reverse_pass_callback([x, res]() mutable {
+    x.adj().array() += res.adj().array() * res.val().array();
+  });
+  return res;
+}
+
+/**
+ * Derivative of `exp()` for its vectorized reverse mode over Eigen
+ * matrices of `var`. The derivative of the exponential is its value.
+ */
+template <>
+struct apply_scalar_unary_partial<exp_fun> {
+  static inline double partial(double /* x */, double exp_x) {
+    return exp_x;
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
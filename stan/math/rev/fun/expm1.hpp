@@ -3,6 +3,7 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
 #include <stan/math/prim/fun/expm1.hpp>
 
 namespace stan {
@@ -45,6 +46,17 @@ class expm1_vari : public op_v_vari {
  */
 inline var expm1(const var& a) { return var(new internal::expm1_vari(a.vi_)); }
 
+/**
+ * Derivative of `expm1()` for its vectorized reverse mode over Eigen
+ * matrices of `var`. The derivative is one more than the value.
+ */
+template <>
+struct apply_scalar_unary_partial<expm1_fun> {
+  static inline double partial(double /* x */, double expm1_x) {
+    return expm1_x + 1;
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -22,7 +22,8 @@ namespace math {
 
 /**
  * Gradient of the incomplete beta function beta(a, b, z) with
- * respect to the first two arguments.
+ * respect to the first two arguments, given the precomputed value of
+ * beta(a, b) * inc_beta(a, b, z).
  *
  * Uses the equivalence to a hypergeometric function. See
  * http://dlmf.nist.gov/8.17#ii
@@ -32,20 +33,38 @@ namespace math {
  * @param[in] a a
  * @param[in] b b
  * @param[in] z z
+ * @param[in] beta_inc_beta the value of beta(a, b) * inc_beta(a, b, z)
  */
 inline void grad_inc_beta(var& g1, var& g2, const var& a, const var& b,
-                          const var& z) {
+                          const var& z, const var& beta_inc_beta) {
   var c1 = log(z);
   var c2 = log1m(z);
-  var c3 = beta(a, b) * inc_beta(a, b, z);
   var C = exp(a * c1 + b * c2) / a;
   var dF1 = 0;
   var dF2 = 0;
   if (value_of(value_of(C))) {
     grad_2F1(dF1, dF2, a + b, var(1.0), a + 1, z);
   }
-  g1 = (c1 - 1.0 / a) * c3 + C * (dF1 + dF2);
-  g2 = c2 * c3 + C * dF1;
+  g1 = (c1 - 1.0 / a) * beta_inc_beta + C * (dF1 + dF2);
+  g2 = c2 * beta_inc_beta + C * dF1;
+}
+
+/**
+ * Gradient of the incomplete beta function beta(a, b, z) with
+ * respect to the first two arguments.
+ *
+ * Uses the equivalence to a hypergeometric function. See
+ * http://dlmf.nist.gov/8.17#ii
+ *
+ * @param[out] g1 d/da
+ * @param[out] g2 d/db
+ * @param[in] a a
+ * @param[in] b b
+ * @param[in] z z
+ */
+inline void grad_inc_beta(var& g1, var& g2, const var& a, const var& b,
+                          const var& z) {
+  grad_inc_beta(g1, g2, a, b, z, beta(a, b) * inc_beta(a, b, z));
 }
 
 }  // namespace math
@@ -24,7 +24,7 @@ class inc_beta_vvv_vari : public op_vvv_vari {
     const double beta_ab = beta(avi_->val_, bvi_->val_);
     grad_reg_inc_beta(d_a, d_b, avi_->val_, bvi_->val_, cvi_->val_,
                       digamma(avi_->val_), digamma(bvi_->val_),
-                      digamma(avi_->val_ + bvi_->val_), beta_ab);
+                      digamma(avi_->val_ + bvi_->val_), beta_ab, val_);
 
     avi_->adj_ += adj_ * d_a;
     bvi_->adj_ += adj_ * d_b;
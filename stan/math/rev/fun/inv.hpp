@@ -3,6 +3,7 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
 #include <stan/math/prim/fun/inv.hpp>
 
 namespace stan {
@@ -37,6 +38,17 @@ class inv_vari : public op_v_vari {
  */
 inline var inv(const var& a) { return var(new internal::inv_vari(a.vi_)); }
 
+/**
+ * Derivative of `inv()` for its vectorized reverse mode over Eigen
+ * matrices of `var`.
+ */
+template <>
+struct apply_scalar_unary_partial<inv_fun> {
+  static inline double partial(double x, double /* inv_x */) {
+    return -1 / (x * x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -3,6 +3,8 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
 #include <stan/math/prim/fun/inv_logit.hpp>
 
 namespace stan {
@@ -33,6 +35,36 @@ inline var inv_logit(const var& a) {
   return var(new internal::inv_logit_vari(a.vi_));
 }
 
+/**
+ * Return the elementwise inverse logit of the specified `var_value`
+ * matrix.
+ *
+ * @tparam T a `var_value` with an inner Eigen type
+ * @param x matrix
+ * @return Elementwise inverse logit of the matrix.
+ */
+template <typename T, require_var_matrix_t<T>* = nullptr>
+inline auto inv_logit(const T& x) {
+  using ret_type = promote_var_matrix_t<value_type_t<T>, T>;
+  ret_type res(inv_logit(x.val()));
+  reverse_pass_callback([x, res]() mutable {
+    x.adj().array()
+        += res.adj().array() * res.val().array() * (1.0 - res.val().array());
+  });
+  return res;
+}
+
+/**
+ * Derivative of `inv_logit()` for its vectorized reverse mode over Eigen
+ * matrices of `var`. The derivative is computed from the value.
+ */
+template <>
+struct apply_scalar_unary_partial<inv_logit_fun> {
+  static inline double partial(double /* x */, double inv_logit_x) {
+    return inv_logit_x * (1 - inv_logit_x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
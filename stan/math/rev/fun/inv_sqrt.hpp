@@ -3,6 +3,7 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
 #include <stan/math/prim/fun/inv_sqrt.hpp>
 #include <cmath>
 
@@ -42,6 +43,17 @@ inline var inv_sqrt(const var& a) {
   return var(new internal::inv_sqrt_vari(a.vi_));
 }
 
+/**
+ * Derivative of `inv_sqrt()` for its vectorized reverse mode over Eigen
+ * matrices of `var`.
+ */
+template <>
+struct apply_scalar_unary_partial<inv_sqrt_fun> {
+  static inline double partial(double x, double /* inv_sqrt_x */) {
+    return -0.5 / (x * std::sqrt(x));
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
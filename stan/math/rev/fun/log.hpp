@@ -4,6 +4,8 @@
 #include <stan/math/prim/fun/log.hpp>
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
 #include <stan/math/rev/fun/abs.hpp>
 #include <stan/math/rev/fun/arg.hpp>
 #include <stan/math/rev/fun/atan2.hpp>
@@ -64,6 +66,35 @@ inline std::complex<var> log(const std::complex<var>& z) {
   return internal::complex_log(z);
 }
 
+/**
+ * Return the elementwise natural logarithm of the specified `var_value`
+ * matrix.
+ *
+ * @tparam T a `var_value` with an inner Eigen type
+ * @param x matrix
+ * @return Elementwise natural logarithm of the matrix.
+ */
+template <typename T, require_var_matrix_t<T>* = nullptr>
+inline auto log(const T& x) {
+  using ret_type = promote_var_matrix_t<value_type_t<T>, T>;
+  ret_type res(x.val().array().log().matrix());
+  reverse_pass_callback([x, res]() mutable {
+    x.adj().array() += res.adj().array() / x.val().array();
+  });
+  return res;
+}
+
+/**
+ * Derivative of `log()` for its vectorized reverse mode over Eigen
+ * matrices of `var`.
+ */
+template <>
+struct apply_scalar_unary_partial<log_fun> {
+  static inline double partial(double x, double /* log_x */) {
+    return 1 / x;
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
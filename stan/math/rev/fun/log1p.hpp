@@ -3,6 +3,7 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
 #include <stan/math/prim/fun/log1p.hpp>
 
 namespace stan {
@@ -28,6 +29,17 @@ class log1p_vari : public op_v_vari {
  */
 inline var log1p(const var& a) { return var(new internal::log1p_vari(a.vi_)); }
 
+/**
+ * Derivative of `log1p()` for its vectorized reverse mode over Eigen
+ * matrices of `var`.
+ */
+template <>
+struct apply_scalar_unary_partial<log1p_fun> {
+  static inline double partial(double x, double /* log1p_x */) {
+    return 1 / (1 + x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
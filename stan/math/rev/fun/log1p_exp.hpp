@@ -3,6 +3,8 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
 #include <stan/math/prim/fun/inv_logit.hpp>
 #include <stan/math/prim/fun/log1p_exp.hpp>
 
@@ -25,6 +27,35 @@ inline var log1p_exp(const var& a) {
   return var(new internal::log1p_exp_v_vari(a.vi_));
 }
 
+/**
+ * Return the elementwise log of 1 plus the exponential of the specified
+ * `var_value` matrix.
+ *
+ * @tparam T a `var_value` with an inner Eigen type
+ * @param x matrix
+ * @return Elementwise log of 1 plus the exponential of the matrix.
+ */
+template <typename T, require_var_matrix_t<T>* = nullptr>
+inline auto log1p_exp(const T& x) {
+  using ret_type = promote_var_matrix_t<value_type_t<T>, T>;
+  ret_type res(log1p_exp(x.val()));
+  reverse_pass_callback([x, res]() mutable {
+    x.adj().array() += res.adj().array() * inv_logit(x.val()).array();
+  });
+  return res;
+}
+
+/**
+ * Derivative of `log1p_exp()` for its vectorized reverse mode over Eigen
+ * matrices of `var`. The derivative is the inverse logit of the argument.
+ */
+template <>
+struct apply_scalar_unary_partial<log1p_exp_fun> {
+  static inline double partial(double x, double /* log1p_exp_x */) {
+    return inv_logit(x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
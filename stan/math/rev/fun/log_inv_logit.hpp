@@ -3,6 +3,7 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
 #include <stan/math/rev/core/precomp_v_vari.hpp>
 #include <stan/math/prim/fun/inv_logit.hpp>
 #include <stan/math/prim/fun/log_inv_logit.hpp>
@@ -22,6 +23,18 @@ inline var log_inv_logit(const var& u) {
       new precomp_v_vari(log_inv_logit(u.val()), u.vi_, inv_logit(-u.val())));
 }
 
+/**
+ * Derivative of `log_inv_logit()` for its vectorized reverse mode over Eigen
+ * matrices of `var`. The derivative is the inverse logit of the negated
+ * argument.
+ */
+template <>
+struct apply_scalar_unary_partial<log_inv_logit_fun> {
+  static inline double partial(double x, double /* log_inv_logit_x */) {
+    return inv_logit(-x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
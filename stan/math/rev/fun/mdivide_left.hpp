@@ -4,53 +4,102 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/core/arena_matrix.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
 #include <stan/math/rev/fun/typedefs.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
-#include <vector>
+#include <stan/math/prim/fun/value_of.hpp>
 
 namespace stan {
 namespace math {
 
-template <typename T1, typename T2, require_all_eigen_t<T1, T2>* = nullptr,
-          require_any_vt_var<T1, T2>* = nullptr>
+namespace internal {
+/**
+ * Return the solution of `A^T * x = b` given the partial pivoting LU
+ * factorization `P * A = L * U`, with `L` and `U` packed in one matrix.
+ *
+ * @tparam EigMat1 type of the packed LU factors
+ * @tparam EigVec type of the indices of the row permutation
+ * @tparam EigMat2 type of the right-hand side
+ * @param lu packed LU factors, `L` with unit diagonal below and `U` on and
+ * above the diagonal
+ * @param perm indices of the row permutation `P`
+ * @param b right-hand side
+ * @return solution of the system
+ */
+template <typename EigMat1, typename EigVec, typename EigMat2>
+inline Eigen::Matrix<double, Eigen::Dynamic, EigMat2::ColsAtCompileTime>
+lu_transpose_solve(const EigMat1& lu, const EigVec& perm, const EigMat2& b) {
+  Eigen::Matrix<double, Eigen::Dynamic, EigMat2::ColsAtCompileTime> x
+      = lu.template triangularView<Eigen::Upper>().transpose().solve(b);
+  lu.template triangularView<Eigen::UnitLower>().transpose().solveInPlace(x);
+  return Eigen::PermutationMatrix<Eigen::Dynamic>(perm).transpose() * x;
+}
+}  // namespace internal
+
+/**
+ * Returns the solution of the system Ax=B.
+ *
+ * The partial pivoting LU factorization of `A` is kept in arena memory
+ * and reused by the single callback that propagates the adjoints of the
+ * solution, so the reverse pass only needs triangular solves.
+ *
+ * @tparam T1 type of the first matrix, either an Eigen matrix or a
+ * `var_value` with an inner Eigen matrix
+ * @tparam T2 type of the right-hand side matrix or vector, either an Eigen
+ * type or a `var_value` with an inner Eigen type
+ * @param A Matrix.
+ * @param B Right hand side matrix or vector.
+ * @return x = A^-1 B, solution of the linear system.
+ * @throws std::invalid_argument if A is not square or the rows of B don't
+ * match the size of A.
+ */
+template <typename T1, typename T2, require_all_matrix_t<T1, T2>* = nullptr,
+          require_any_rev_matrix_t<T1, T2>* = nullptr>
 inline auto mdivide_left(const T1& A, const T2& B) {
-  using ret_type = plain_type_t<decltype(A * B)>;
+  using ret_val_type
+      = Eigen::Matrix<double, T1::RowsAtCompileTime, T2::ColsAtCompileTime>;
+  using ret_type = promote_var_matrix_t<ret_val_type, T1, T2>;
 
   check_square("mdivide_left", "A", A);
   check_multiplicable("mdivide_left", "A", A, "B", B);
 
   if (A.size() == 0) {
-    return ret_type(0, B.cols());
+    return ret_type(ret_val_type(0, B.cols()));
   }
+
+  Eigen::PartialPivLU<Eigen::MatrixXd> lu(value_of(A));
+  arena_t<Eigen::MatrixXd> arena_lu = lu.matrixLU();
+  arena_t<Eigen::VectorXi> arena_perm = lu.permutationP().indices();
+
   if (!is_constant<T1>::value && !is_constant<T2>::value) {
     arena_t<promote_scalar_t<var, T1>> arena_A = A;
     arena_t<promote_scalar_t<var, T2>> arena_B = B;
-    arena_t<promote_scalar_t<double, T1>> arena_A_val = arena_A.val();
-    arena_t<ret_type> res = arena_A_val.householderQr().solve(arena_B.val());
-    reverse_pass_callback([arena_A, arena_B, arena_A_val, res]() mutable {
-      promote_scalar_t<double, T2> adjB
-          = arena_A_val.transpose().householderQr().solve(res.adj());
+    arena_t<ret_type> res = lu.solve(arena_B.val().eval());
+    reverse_pass_callback([arena_A, arena_B, arena_lu, arena_perm,
+                           res]() mutable {
+      auto adjB = internal::lu_transpose_solve(arena_lu, arena_perm, res.adj());
       arena_A.adj() -= adjB * res.val_op().transpose();
       arena_B.adj() += adjB;
     });
-
     return ret_type(res);
   } else if (!is_constant<T2>::value) {
     arena_t<promote_scalar_t<var, T2>> arena_B = B;
-    arena_t<promote_scalar_t<double, T1>> arena_A_val = value_of(A);
-    arena_t<ret_type> res = arena_A_val.householderQr().solve(arena_B.val());
-    reverse_pass_callback([arena_B, arena_A_val, res]() mutable {
-      arena_B.adj() += arena_A_val.transpose().householderQr().solve(res.adj());
+    arena_t<ret_type> res = lu.solve(arena_B.val().eval());
+    reverse_pass_callback([arena_B, arena_lu, arena_perm, res]() mutable {
+      arena_B.adj()
+          += internal::lu_transpose_solve(arena_lu, arena_perm, res.adj());
     });
     return ret_type(res);
   } else {
     arena_t<promote_scalar_t<var, T1>> arena_A = A;
-    arena_t<ret_type> res = arena_A.val().householderQr().solve(value_of(B));
-    reverse_pass_callback([arena_A, res]() mutable {
+    arena_t<ret_type> res = lu.solve(value_of(B));
+    reverse_pass_callback([arena_A, arena_lu, arena_perm, res]() mutable {
       arena_A.adj()
-          -= arena_A.val().transpose().householderQr().solve(res.adj())
+          -= internal::lu_transpose_solve(arena_lu, arena_perm, res.adj())
              * res.val_op().transpose();
     });
     return ret_type(res);
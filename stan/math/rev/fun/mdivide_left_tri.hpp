@@ -6,6 +6,7 @@
 #include <stan/math/rev/fun/typedefs.hpp>
 #include <stan/math/prim/err.hpp>
 #include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/parallel_cholesky.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
 #ifdef STAN_OPENCL
 #include <stan/math/opencl/opencl.hpp>
@@ -78,7 +79,7 @@ class mdivide_left_tri_vv_vari : public vari {
       c_map = from_matrix_cl(C_cl);
     } else {
 #endif
-      c_map = a_map.template triangularView<TriView>().solve(c_map);
+      internal::tri_solve_in_place<TriView>(a_map, c_map);
 #ifdef STAN_OPENCL
     }
 #endif
@@ -103,10 +104,9 @@ class mdivide_left_tri_vv_vari : public vari {
       adjB = from_matrix_cl(adjB_cl);
     } else {
 #endif
-      adjB = Map<matrix_d>(A_, M_, M_)
-                 .template triangularView<TriView>()
-                 .transpose()
-                 .solve(Map<matrix_vi>(variRefC_, M_, N_).adj());
+      adjB = Map<matrix_vi>(variRefC_, M_, N_).adj();
+      internal::tri_solve_in_place<TriView, true>(Map<matrix_d>(A_, M_, M_),
+                                                  adjB);
       adjA = -adjB * Map<matrix_d>(C_, M_, N_).transpose();
 #ifdef STAN_OPENCL
     }
@@ -172,9 +172,7 @@ class mdivide_left_tri_dv_vari : public vari {
       c_map = from_matrix_cl(C_cl);
     } else {
 #endif
-      c_map = Map<matrix_d>(A_, M_, M_)
-                  .template triangularView<TriView>()
-                  .solve(c_map);
+      internal::tri_solve_in_place<TriView>(Map<matrix_d>(A_, M_, M_), c_map);
 #ifdef STAN_OPENCL
     }
 #endif
@@ -193,11 +191,10 @@ class mdivide_left_tri_dv_vari : public vari {
       Map<matrix_vi>(variRefB_, M_, N_).adj() += from_matrix_cl(res_cl);
     } else {
 #endif
-      Map<matrix_vi>(variRefB_, M_, N_).adj()
-          += Map<matrix_d>(A_, M_, M_)
-                 .template triangularView<TriView>()
-                 .transpose()
-                 .solve(Map<matrix_vi>(variRefC_, M_, N_).adj());
+      matrix_d adjB = Map<matrix_vi>(variRefC_, M_, N_).adj();
+      internal::tri_solve_in_place<TriView, true>(Map<matrix_d>(A_, M_, M_),
+                                                  adjB);
+      Map<matrix_vi>(variRefB_, M_, N_).adj() += adjB;
 #ifdef STAN_OPENCL
     }
 #endif
@@ -259,7 +256,8 @@ class mdivide_left_tri_vd_vari : public vari {
       Cd = from_matrix_cl(B_cl);
     } else {
 #endif
-      Cd = Ad.template triangularView<TriView>().solve(B);
+      Cd = B;
+      internal::tri_solve_in_place<TriView>(Ad, Cd);
 #ifdef STAN_OPENCL
     }
 #endif
@@ -285,11 +283,9 @@ class mdivide_left_tri_vd_vari : public vari {
     } else {
 #endif
       adjA.noalias()
-          = -Map<Matrix<double, R1, C1> >(A_, M_, M_)
-                 .template triangularView<TriView>()
-                 .transpose()
-                 .solve(adjC
-                        * Map<Matrix<double, R1, C2> >(C_, M_, N_).transpose());
+          = -adjC * Map<Matrix<double, R1, C2> >(C_, M_, N_).transpose();
+      internal::tri_solve_in_place<TriView, true>(
+          Map<Matrix<double, R1, C1> >(A_, M_, M_), adjA);
 #ifdef STAN_OPENCL
     }
 #endif
@@ -0,0 +1,87 @@
+#ifndef STAN_MATH_REV_FUN_MDIVIDE_LEFT_TRI_LOW_HPP
+#define STAN_MATH_REV_FUN_MDIVIDE_LEFT_TRI_LOW_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/batched_matrix_ops.hpp>
+#include <stan/math/prim/fun/mdivide_left_tri_low.hpp>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the results of left dividing a batch of dividends by a batch of
+ * lower triangular divisors, `A[k]^-1 * b[k]`, at least one of which
+ * holds vars.
+ *
+ * The systems are solved with `internal::batch_tri_low_solve()` and the
+ * adjoints of all of them are propagated by a single reverse pass
+ * callback.
+ *
+ * @tparam T1 type of the divisor matrices
+ * @tparam T2 type of the dividend matrices or vectors
+ * @param A batch of divisors, lower triangular square matrices
+ * @param b batch of dividends
+ * @return batch of left divisions
+ * @throws std::invalid_argument if the batches have different sizes, the
+ *   matrices of a batch differ in size, the divisors are not square or
+ *   the dividends do not have as many rows as the divisors have columns
+ */
+template <typename T1, typename T2, require_all_eigen_t<T1, T2>* = nullptr,
+          require_any_vt_var<T1, T2>* = nullptr>
+inline std::vector<
+    Eigen::Matrix<var, T1::RowsAtCompileTime, T2::ColsAtCompileTime>>
+mdivide_left_tri_low(const std::vector<T1>& A, const std::vector<T2>& b) {
+  using ret_t
+      = Eigen::Matrix<var, T1::RowsAtCompileTime, T2::ColsAtCompileTime>;
+  using batch_var_t = Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>;
+  static const char* function = "mdivide_left_tri_low";
+  check_size_match(function, "size of A", A.size(), "size of b", b.size());
+  if (A.empty()) {
+    return {};
+  }
+  internal::check_batch_sizes(function, "A", A);
+  internal::check_batch_sizes(function, "b", b);
+  check_square(function, "A", A[0]);
+  check_multiplicable(function, "A", A[0], "b", b[0]);
+  const Eigen::Index n = A[0].rows();
+  const Eigen::Index q = b[0].cols();
+  arena_t<promote_scalar_t<value_type_t<T1>, batch_var_t>> arena_A
+      = internal::to_batch(A);
+  arena_t<promote_scalar_t<value_type_t<T2>, batch_var_t>> arena_b
+      = internal::to_batch(b);
+  arena_t<Eigen::MatrixXd> arena_A_val = value_of(arena_A);
+  arena_t<Eigen::MatrixXd> res_val(A.size(), n * q);
+  internal::batch_tri_low_solve(arena_A_val, value_of(arena_b).eval(), n, q,
+                                res_val);
+  arena_t<batch_var_t> res = res_val;
+  reverse_pass_callback(
+      [arena_A, arena_b, arena_A_val, res_val, res, n, q]() mutable {
+        Eigen::MatrixXd A_adj;
+        Eigen::MatrixXd b_adj;
+        if (!is_constant<T1>::value) {
+          A_adj = Eigen::MatrixXd::Zero(arena_A.rows(), arena_A.cols());
+        }
+        if (!is_constant<T2>::value) {
+          b_adj = Eigen::MatrixXd::Zero(arena_b.rows(), arena_b.cols());
+        }
+        internal::batch_tri_low_solve_adjoint(arena_A_val, res_val,
+                                              res.adj().eval(), n, q, A_adj,
+                                              b_adj);
+        if (!is_constant<T1>::value) {
+          forward_as<arena_t<batch_var_t>>(arena_A).adj() += A_adj;
+        }
+        if (!is_constant<T2>::value) {
+          forward_as<arena_t<batch_var_t>>(arena_b).adj() += b_adj;
+        }
+      });
+  return internal::from_batch<ret_t>(res, n, q);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
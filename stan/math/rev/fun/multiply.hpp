@@ -6,6 +6,7 @@
 #include <stan/math/rev/fun/typedefs.hpp>
 #include <stan/math/prim.hpp>
 #include <type_traits>
+#include <vector>
 
 namespace stan {
 namespace math {
@@ -184,6 +185,73 @@ inline auto multiply(const T1& A, const T2& B) {
   return multiply(B, A);
 }
 
+/**
+ * Return the products of two batches of matrices, `A[k] * B[k]`, at
+ * least one of which holds vars.
+ *
+ * The products are computed with `internal::batch_multiply()` and the
+ * adjoints of all of them are propagated by a single reverse pass
+ * callback.
+ *
+ * @tparam T1 type of the left matrices
+ * @tparam T2 type of the right matrices
+ * @param A batch of left matrices
+ * @param B batch of right matrices
+ * @return batch of products
+ * @throw std::invalid_argument if the batches have different sizes, the
+ *   matrices of a batch differ in size or the matrices are not
+ *   multiplicable
+ */
+template <typename T1, typename T2, require_all_eigen_t<T1, T2>* = nullptr,
+          require_any_vt_var<T1, T2>* = nullptr>
+inline std::vector<
+    Eigen::Matrix<var, T1::RowsAtCompileTime, T2::ColsAtCompileTime>>
+multiply(const std::vector<T1>& A, const std::vector<T2>& B) {
+  using ret_t
+      = Eigen::Matrix<var, T1::RowsAtCompileTime, T2::ColsAtCompileTime>;
+  using batch_var_t = Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>;
+  check_size_match("multiply", "size of A", A.size(), "size of B", B.size());
+  if (A.empty()) {
+    return {};
+  }
+  internal::check_batch_sizes("multiply", "A", A);
+  internal::check_batch_sizes("multiply", "B", B);
+  check_multiplicable("multiply", "A", A[0], "B", B[0]);
+  const Eigen::Index m = A[0].rows();
+  const Eigen::Index p = A[0].cols();
+  const Eigen::Index q = B[0].cols();
+  arena_t<promote_scalar_t<value_type_t<T1>, batch_var_t>> arena_A
+      = internal::to_batch(A);
+  arena_t<promote_scalar_t<value_type_t<T2>, batch_var_t>> arena_B
+      = internal::to_batch(B);
+  arena_t<Eigen::MatrixXd> arena_A_val = value_of(arena_A);
+  arena_t<Eigen::MatrixXd> arena_B_val = value_of(arena_B);
+  Eigen::MatrixXd res_val(A.size(), m * q);
+  internal::batch_multiply(arena_A_val, arena_B_val, m, p, q, res_val);
+  arena_t<batch_var_t> res = res_val;
+  reverse_pass_callback(
+      [arena_A, arena_B, arena_A_val, arena_B_val, res, m, p, q]() mutable {
+        Eigen::MatrixXd A_adj;
+        Eigen::MatrixXd B_adj;
+        if (!is_constant<T1>::value) {
+          A_adj = Eigen::MatrixXd::Zero(arena_A.rows(), arena_A.cols());
+        }
+        if (!is_constant<T2>::value) {
+          B_adj = Eigen::MatrixXd::Zero(arena_B.rows(), arena_B.cols());
+        }
+        internal::batch_multiply_adjoint(arena_A_val, arena_B_val,
+                                         res.adj().eval(), m, p, q, A_adj,
+                                         B_adj);
+        if (!is_constant<T1>::value) {
+          forward_as<arena_t<batch_var_t>>(arena_A).adj() += A_adj;
+        }
+        if (!is_constant<T2>::value) {
+          forward_as<arena_t<batch_var_t>>(arena_B).adj() += B_adj;
+        }
+      });
+  return internal::from_batch<ret_t>(res, m, q);
+}
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,193 @@
+#ifndef STAN_MATH_REV_FUN_SCALE_MATRIX_EXP_MULTIPLY_HPP
+#define STAN_MATH_REV_FUN_SCALE_MATRIX_EXP_MULTIPLY_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/matrix_exp.hpp>
+#include <stan/math/prim/fun/scale_matrix_exp_multiply.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the products of exp(At) and B for each of the specified times
+ * t, where A is a NxN matrix and B is a NxCb matrix, and at least one of
+ * the times, A and B holds vars.
+ *
+ * <p>The times are sorted and the products are computed by stepping from
+ * one time to the next, `exp(A t_i) B = exp(A h_i) exp(A t_{i-1}) B` with
+ * `h_i = t_i - t_{i-1}`. Steps of equal length, as on a regular time
+ * grid, share a single propagator `exp(A h)`.
+ *
+ * <p>A single reverse pass callback propagates the adjoints of all
+ * products. The adjoint state `lambda_i = adj(Y_i) + exp(A^T h_{i+1})
+ * lambda_{i+1}` is swept backwards through the same steps. The adjoint
+ * of A is the sum over the steps of the Frechet derivative of the
+ * exponential, `h L(A^T h, lambda_i Y_{i-1}^T)`. As the Frechet derivative
+ * is linear in its direction, all steps of the same length are summed
+ * first and need only one evaluation, which takes the exponential of a
+ * 2N x 2N block triangular matrix. None of the terms of the exponential
+ * are taped.
+ *
+ * @tparam Tt type of the times
+ * @tparam EigMat1 type of the first matrix
+ * @tparam EigMat2 type of the second matrix
+ * @param[in] ts non-negative times
+ * @param[in] A Matrix
+ * @param[in] B Matrix
+ * @return exponential of At multiplied by B, for each t in ts
+ * @throw std::domain_error if a time is negative or not finite
+ */
+template <typename Tt, typename EigMat1, typename EigMat2,
+          require_all_eigen_t<EigMat1, EigMat2>* = nullptr,
+          require_any_st_var<Tt, EigMat1, EigMat2>* = nullptr,
+          require_all_not_st_fvar<Tt, EigMat1, EigMat2>* = nullptr>
+inline std::vector<
+    Eigen::Matrix<var, Eigen::Dynamic, EigMat2::ColsAtCompileTime>>
+scale_matrix_exp_multiply(const std::vector<Tt>& ts, const EigMat1& A,
+                          const EigMat2& B) {
+  using ret_t = Eigen::Matrix<var, Eigen::Dynamic, EigMat2::ColsAtCompileTime>;
+  using Eigen::Index;
+  using Eigen::MatrixXd;
+  static const char* function = "scale_matrix_exp_multiply";
+  check_square(function, "input matrix", A);
+  check_multiplicable(function, "A", A, "B", B);
+  check_nonnegative(function, "times", ts);
+  check_finite(function, "times", ts);
+  const size_t K = ts.size();
+  if (A.size() == 0) {
+    return std::vector<ret_t>(K, ret_t(0, B.cols()));
+  }
+  if (K == 0) {
+    return {};
+  }
+
+  const Index N = A.rows();
+  const Index C = B.cols();
+  arena_t<promote_scalar_t<value_type_t<EigMat1>, MatrixXd>> arena_A = A;
+  arena_t<promote_scalar_t<value_type_t<EigMat2>, MatrixXd>> arena_B = B;
+  arena_t<std::vector<Tt>> arena_ts(ts.begin(), ts.end());
+  arena_t<MatrixXd> A_val = value_of(arena_A);
+  arena_t<MatrixXd> B_val = value_of(arena_B);
+
+  // visit the times in increasing order and group equal steps
+  arena_t<std::vector<int>> order(K);
+  std::vector<double> t_val(K);
+  for (size_t i = 0; i < K; ++i) {
+    order[i] = i;
+    t_val[i] = value_of(ts[i]);
+  }
+  std::stable_sort(order.begin(), order.end(), [&t_val](int i, int j) {
+    return t_val[i] < t_val[j];
+  });
+  const double step_tol = 8 * std::numeric_limits<double>::epsilon()
+                          * t_val[order[K - 1]];
+  std::vector<double> steps(K);
+  for (size_t k = 0; k < K; ++k) {
+    steps[k] = t_val[order[k]] - (k == 0 ? 0.0 : t_val[order[k - 1]]);
+  }
+  std::vector<double> sorted_steps = steps;
+  std::sort(sorted_steps.begin(), sorted_steps.end());
+  arena_t<std::vector<double>> step_lengths;
+  for (double h : sorted_steps) {
+    if (step_lengths.empty() || h - step_lengths.back() > step_tol) {
+      step_lengths.push_back(h);
+    }
+  }
+  arena_t<std::vector<int>> step_index(K);
+  for (size_t k = 0; k < K; ++k) {
+    step_index[k] = std::upper_bound(step_lengths.begin(), step_lengths.end(),
+                                     steps[k])
+                    - step_lengths.begin() - 1;
+  }
+  arena_t<std::vector<MatrixXd>> propagators(step_lengths.size());
+  for (size_t d = 0; d < step_lengths.size(); ++d) {
+    propagators[d] = matrix_exp((step_lengths[d] * A_val).eval());
+  }
+
+  // values in order of increasing time, one block of C columns per time
+  arena_t<MatrixXd> Y_val(N, C * K);
+  Y_val.leftCols(C) = propagators[step_index[0]] * B_val;
+  for (size_t k = 1; k < K; ++k) {
+    Y_val.middleCols(k * C, C)
+        = propagators[step_index[k]] * Y_val.middleCols((k - 1) * C, C);
+  }
+  arena_t<Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>> res = Y_val;
+
+  reverse_pass_callback([arena_A, arena_B, arena_ts, A_val, B_val, order,
+                         step_lengths, step_index, propagators, Y_val, res, N,
+                         C, K]() mutable {
+    const MatrixXd Y_adj = res.adj();
+    if (!is_constant<Tt>::value) {
+      const MatrixXd AY = A_val * Y_val;
+      for (size_t k = 0; k < K; ++k) {
+        forward_as<var>(arena_ts[order[k]]).adj()
+            += Y_adj.middleCols(k * C, C)
+                   .cwiseProduct(AY.middleCols(k * C, C))
+                   .sum();
+      }
+    }
+    if (is_constant<EigMat1>::value && is_constant<EigMat2>::value) {
+      return;
+    }
+    // sweep the adjoint state backwards, summing the directions of the
+    // Frechet derivatives of equal steps
+    std::vector<MatrixXd> directions;
+    if (!is_constant<EigMat1>::value) {
+      directions.assign(step_lengths.size(), MatrixXd::Zero(N, N));
+    }
+    MatrixXd lambda = Y_adj.middleCols((K - 1) * C, C);
+    for (size_t k = K; k-- > 0;) {
+      if (k + 1 < K) {
+        lambda = Y_adj.middleCols(k * C, C)
+                 + propagators[step_index[k + 1]].transpose() * lambda;
+      }
+      if (!is_constant<EigMat1>::value) {
+        if (k == 0) {
+          directions[step_index[k]].noalias() += lambda * B_val.transpose();
+        } else {
+          directions[step_index[k]].noalias()
+              += lambda * Y_val.middleCols((k - 1) * C, C).transpose();
+        }
+      }
+    }
+    if (!is_constant<EigMat2>::value) {
+      forward_as<arena_t<promote_scalar_t<var, MatrixXd>>>(arena_B).adj()
+          += propagators[step_index[0]].transpose() * lambda;
+    }
+    if (!is_constant<EigMat1>::value) {
+      MatrixXd A_adj = MatrixXd::Zero(N, N);
+      MatrixXd block = MatrixXd::Zero(2 * N, 2 * N);
+      for (size_t d = 0; d < step_lengths.size(); ++d) {
+        const double h = step_lengths[d];
+        if (h == 0) {
+          continue;
+        }
+        block.topLeftCorner(N, N) = h * A_val.transpose();
+        block.bottomRightCorner(N, N) = h * A_val.transpose();
+        block.topRightCorner(N, N) = h * directions[d];
+        A_adj += matrix_exp(block).topRightCorner(N, N);
+      }
+      forward_as<arena_t<promote_scalar_t<var, MatrixXd>>>(arena_A).adj()
+          += A_adj;
+    }
+  });
+
+  std::vector<ret_t> out(K);
+  for (size_t k = 0; k < K; ++k) {
+    out[order[k]] = res.middleCols(k * C, C);
+  }
+  return out;
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
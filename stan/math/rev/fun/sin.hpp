@@ -6,6 +6,7 @@
 #include <stan/math/prim/fun/isinf.hpp>
 #include <stan/math/prim/fun/sin.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/fun/is_inf.hpp>
 #include <stan/math/rev/fun/cosh.hpp>
@@ -63,6 +64,17 @@ inline std::complex<var> sin(const std::complex<var>& z) {
   return stan::math::internal::complex_sin(z);
 }
 
+/**
+ * Derivative of `sin()` for its vectorized reverse mode over Eigen
+ * matrices of `var`.
+ */
+template <>
+struct apply_scalar_unary_partial<sin_fun> {
+  static inline double partial(double x, double /* sin_x */) {
+    return std::cos(x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,66 @@
+#ifndef STAN_MATH_REV_FUN_SINGULAR_VALUES_HPP
+#define STAN_MATH_REV_FUN_SINGULAR_VALUES_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/core/arena_matrix.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
+#include <stan/math/rev/fun/typedefs.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/singular_values.hpp>
+#include <stan/math/prim/fun/spectral_decomposition.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the singular values of the specified matrix in decreasing
+ * order.
+ * <p>See <code>svd()</code> for more information.
+ *
+ * The singular vectors needed for the adjoints are kept in arena memory
+ * and a single callback propagates the adjoints of all singular values,
+ * `adj(m) += U * diag(adj(D)) * V^T`. Large matrices are decomposed with
+ * a divide and conquer algorithm and the products of the adjoint are
+ * computed in parallel.
+ *
+ * Reverse mode differentiation algorithm reference:
+ *
+ * Mike Giles. An extended collection of matrix derivative results for
+ * forward and reverse mode AD.  Jan. 2008.
+ *
+ * Section 3.2.3 Singular value decomposition.
+ *
+ * @tparam T type of the matrix
+ * @param m Specified matrix.
+ * @param opts tuning parameters of the decompositions and products used
+ * for large matrices, see `spectral_tuning`
+ * @return Singular values of the matrix.
+ */
+template <typename T, require_eigen_matrix_dynamic_vt<is_var, T>* = nullptr>
+inline Eigen::Matrix<var, Eigen::Dynamic, 1> singular_values(
+    const T& m, const spectral_tuning& opts = spectral_tuning()) {
+  if (m.size() == 0) {
+    return {};
+  }
+  arena_t<T> arena_m = m;
+
+  Eigen::VectorXd D;
+  Eigen::MatrixXd U_val;
+  Eigen::MatrixXd V_val;
+  internal::singular_value_decompose(arena_m.val(), D, U_val, V_val, opts);
+  arena_t<Eigen::Matrix<var, Eigen::Dynamic, 1>> res = D;
+  arena_t<Eigen::MatrixXd> U = U_val;
+  arena_t<Eigen::MatrixXd> V = V_val;
+
+  reverse_pass_callback([arena_m, res, U, V, opts]() mutable {
+    arena_m.adj() += internal::spectral_multiply(U * res.adj().asDiagonal(),
+                                                 V.transpose(), opts);
+  });
+
+  return res;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
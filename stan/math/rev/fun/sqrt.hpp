@@ -4,6 +4,7 @@
 #include <stan/math/prim/fun/sqrt.hpp>
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
 #include <stan/math/rev/fun/atan2.hpp>
 #include <stan/math/rev/fun/cos.hpp>
 #include <stan/math/rev/fun/hypot.hpp>
@@ -61,6 +62,17 @@ inline std::complex<var> sqrt(const std::complex<var>& z) {
   return internal::complex_sqrt(z);
 }
 
+/**
+ * Derivative of `sqrt()` for its vectorized reverse mode over Eigen
+ * matrices of `var`.
+ */
+template <>
+struct apply_scalar_unary_partial<sqrt_fun> {
+  static inline double partial(double /* x */, double sqrt_x) {
+    return 1 / (2 * sqrt_x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
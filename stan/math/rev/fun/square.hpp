@@ -3,6 +3,9 @@
 
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
+#include <stan/math/prim/fun/square.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
 
 namespace stan {
 namespace math {
@@ -44,6 +47,34 @@ inline var square(const var& x) {
   return var(new internal::square_vari(x.vi_));
 }
 
+/**
+ * Return the elementwise square of the specified `var_value` matrix.
+ *
+ * @tparam T a `var_value` with an inner Eigen type
+ * @param x matrix
+ * @return Elementwise square of the matrix.
+ */
+template <typename T, require_var_matrix_t<T>* = nullptr>
+inline auto square(const T& x) {
+  using ret_type = promote_var_matrix_t<value_type_t<T>, T>;
+  ret_type res(x.val().array().square().matrix());
+  reverse_pass_callback([x, res]() mutable {
+    x.adj().array() += 2.0 * res.adj().array() * x.val().array();
+  });
+  return res;
+}
+
+/**
+ * Derivative of `square()` for its vectorized reverse mode over Eigen
+ * matrices of `var`.
+ */
+template <>
+struct apply_scalar_unary_partial<square_fun> {
+  static inline double partial(double x, double /* square_x */) {
+    return 2 * x;
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,134 @@
+#ifndef STAN_MATH_REV_FUN_SUBTRACT_HPP
+#define STAN_MATH_REV_FUN_SUBTRACT_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/fun/value_of.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/subtract.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Return the difference of the specified matrices, at least one of which
+ * is a `var_value` with an inner Eigen type.
+ *
+ * @tparam Mat1 type of the first matrix
+ * @tparam Mat2 type of the second matrix
+ *
+ * @param a First matrix.
+ * @param b Second matrix.
+ * @return Difference of the matrices.
+ * @throw std::invalid_argument if the dimensions do not match.
+ */
+template <typename Mat1, typename Mat2,
+          require_all_matrix_t<Mat1, Mat2>* = nullptr,
+          require_any_var_matrix_t<Mat1, Mat2>* = nullptr>
+inline auto subtract(const Mat1& a, const Mat2& b) {
+  check_matching_dims("subtract", "a", a, "b", b);
+  using inner_ret_type = decltype(value_of(a) - value_of(b));
+  using ret_type = promote_var_matrix_t<inner_ret_type, Mat1, Mat2>;
+  if (!is_constant<Mat1>::value && !is_constant<Mat2>::value) {
+    arena_t<promote_scalar_t<var, Mat1>> arena_a = a;
+    arena_t<promote_scalar_t<var, Mat2>> arena_b = b;
+    ret_type ret(arena_a.val() - arena_b.val());
+    reverse_pass_callback([ret, arena_a, arena_b]() mutable {
+      arena_a.adj() += ret.adj();
+      arena_b.adj() -= ret.adj();
+    });
+    return ret;
+  } else if (!is_constant<Mat1>::value) {
+    arena_t<promote_scalar_t<var, Mat1>> arena_a = a;
+    ret_type ret(arena_a.val() - value_of(b));
+    reverse_pass_callback(
+        [ret, arena_a]() mutable { arena_a.adj() += ret.adj(); });
+    return ret;
+  } else {
+    arena_t<promote_scalar_t<var, Mat2>> arena_b = b;
+    ret_type ret(value_of(a) - arena_b.val());
+    reverse_pass_callback(
+        [ret, arena_b]() mutable { arena_b.adj() -= ret.adj(); });
+    return ret;
+  }
+}
+
+/**
+ * Return the difference of the specified scalar and each element of the
+ * specified `var_value` matrix.
+ *
+ * @tparam Scal type of the scalar
+ * @tparam VarMat a `var_value` with an inner Eigen type
+ *
+ * @param a Scalar.
+ * @param b Matrix.
+ * @return The scalar minus each element of the matrix.
+ */
+template <typename Scal, typename VarMat,
+          require_stan_scalar_t<Scal>* = nullptr,
+          require_var_matrix_t<VarMat>* = nullptr>
+inline auto subtract(const Scal& a, const VarMat& b) {
+  using ret_type = promote_var_matrix_t<value_type_t<VarMat>, VarMat>;
+  ret_type ret((value_of(a) - b.val().array()).matrix());
+  if (!is_constant<Scal>::value) {
+    var arena_a = a;
+    reverse_pass_callback([ret, arena_a, b]() mutable {
+      arena_a.adj() += ret.adj().sum();
+      b.adj() -= ret.adj();
+    });
+  } else {
+    reverse_pass_callback([ret, b]() mutable { b.adj() -= ret.adj(); });
+  }
+  return ret;
+}
+
+/**
+ * Return the difference of each element of the specified `var_value`
+ * matrix and the specified scalar.
+ *
+ * @tparam VarMat a `var_value` with an inner Eigen type
+ * @tparam Scal type of the scalar
+ *
+ * @param a Matrix.
+ * @param b Scalar.
+ * @return Each element of the matrix minus the scalar.
+ */
+template <typename VarMat, typename Scal,
+          require_var_matrix_t<VarMat>* = nullptr,
+          require_stan_scalar_t<Scal>* = nullptr>
+inline auto subtract(const VarMat& a, const Scal& b) {
+  using ret_type = promote_var_matrix_t<value_type_t<VarMat>, VarMat>;
+  ret_type ret((a.val().array() - value_of(b)).matrix());
+  if (!is_constant<Scal>::value) {
+    var arena_b = b;
+    reverse_pass_callback([ret, a, arena_b]() mutable {
+      a.adj() += ret.adj();
+      arena_b.adj() -= ret.adj().sum();
+    });
+  } else {
+    reverse_pass_callback([ret, a]() mutable { a.adj() += ret.adj(); });
+  }
+  return ret;
+}
+
+/**
+ * Subtraction operator for `var_value` matrices, see `subtract()`.
+ *
+ * @tparam T1 type of the first argument
+ * @tparam T2 type of the second argument
+ *
+ * @param a First argument.
+ * @param b Second argument.
+ * @return Difference of the arguments.
+ */
+template <typename T1, typename T2,
+          require_any_var_matrix_t<T1, T2>* = nullptr>
+inline auto operator-(const T1& a, const T2& b) {
+  return subtract(a, b);
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
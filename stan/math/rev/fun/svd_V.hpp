@@ -0,0 +1,87 @@
+#ifndef STAN_MATH_REV_FUN_SVD_V_HPP
+#define STAN_MATH_REV_FUN_SVD_V_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/rev/core/arena_matrix.hpp>
+#include <stan/math/rev/functor/reverse_pass_callback.hpp>
+#include <stan/math/rev/fun/typedefs.hpp>
+#include <stan/math/prim/err.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/spectral_decomposition.hpp>
+#include <stan/math/prim/fun/svd_V.hpp>
+
+namespace stan {
+namespace math {
+
+/**
+ * Given input matrix m, return the matrix V where `m = U * D * V^T` is
+ * the thin singular value decomposition of m, with the singular values
+ * in D in decreasing order.
+ *
+ * The singular values and vectors needed for the adjoints are kept in
+ * arena memory and a single callback propagates the adjoints of all
+ * elements of V. Large matrices are decomposed with a divide and conquer
+ * algorithm and the products of the adjoint are computed in parallel.
+ * The adjoint is not defined if m has repeated or zero singular values.
+ *
+ * Reverse mode differentiation algorithm reference:
+ *
+ * James Townsend. Differentiating the Singular Value Decomposition.
+ * Aug. 2016.
+ *
+ * @tparam T type of the matrix
+ * @param m MxN input matrix
+ * @param opts tuning parameters of the decompositions and products used
+ * for large matrices, see `spectral_tuning`
+ * @return V, a NxK matrix with K = min(M, N)
+ */
+template <typename T, require_eigen_matrix_dynamic_vt<is_var, T>* = nullptr>
+inline Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic> svd_V(
+    const T& m, const spectral_tuning& opts = spectral_tuning()) {
+  check_nonzero_size("svd_V", "m", m);
+  arena_t<T> arena_m = m;
+
+  Eigen::VectorXd D_val;
+  Eigen::MatrixXd U_val;
+  Eigen::MatrixXd V_val;
+  internal::singular_value_decompose(arena_m.val(), D_val, U_val, V_val,
+                                     opts);
+  arena_t<Eigen::VectorXd> D = D_val;
+  arena_t<Eigen::MatrixXd> U = U_val;
+  arena_t<Eigen::MatrixXd> V = V_val;
+  arena_t<Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>> res = V_val;
+
+  reverse_pass_callback([arena_m, res, D, U, V, opts]() mutable {
+    const Eigen::Index K = D.size();
+    Eigen::MatrixXd F(K, K);
+    for (Eigen::Index j = 0; j < K; ++j) {
+      for (Eigen::Index i = 0; i < K; ++i) {
+        F.coeffRef(i, j) = i == j ? 0.0
+                                  : 1.0 / (D.coeff(j) - D.coeff(i))
+                                        - 1.0 / (D.coeff(i) + D.coeff(j));
+      }
+    }
+    const Eigen::MatrixXd V_adj = res.adj();
+    const Eigen::MatrixXd VtV_adj
+        = internal::spectral_multiply(V.transpose(), V_adj, opts);
+    // the component of adj(V) orthogonal to the range of V
+    Eigen::MatrixXd V_adj_perp
+        = V_adj - internal::spectral_multiply(V, VtV_adj, opts);
+    V_adj_perp *= D.cwiseInverse().asDiagonal();
+    arena_m.adj()
+        += 0.5
+               * internal::spectral_multiply(
+                   internal::spectral_multiply(
+                       U, F.cwiseProduct(VtV_adj - VtV_adj.transpose()),
+                       opts),
+                   V.transpose(), opts)
+           + internal::spectral_multiply(U, V_adj_perp.transpose(), opts);
+  });
+
+  return res;
+}
+
+}  // namespace math
+}  // namespace stan
+#endif
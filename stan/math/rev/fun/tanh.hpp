@@ -4,6 +4,7 @@
 #include <stan/math/prim/fun/tanh.hpp>
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core.hpp>
+#include <stan/math/rev/functor/apply_scalar_unary.hpp>
 #include <stan/math/rev/fun/exp.hpp>
 #include <cmath>
 #include <complex>
@@ -61,6 +62,19 @@ inline std::complex<var> tanh(const std::complex<var>& z) {
   return stan::math::internal::complex_tanh(z);
 }
 
+/**
+ * Derivative of `tanh()` for its vectorized reverse mode over Eigen
+ * matrices of `var`. It is computed from the hyperbolic cosine, as in
+ * the scalar version.
+ */
+template <>
+struct apply_scalar_unary_partial<tanh_fun> {
+  static inline double partial(double x, double /* tanh_x */) {
+    const double cosh_x = std::cosh(x);
+    return 1 / (cosh_x * cosh_x);
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -1,8 +1,14 @@
 #ifndef STAN_MATH_REV_FUNCTOR_APPLY_SCALAR_UNARY_HPP
 #define STAN_MATH_REV_FUNCTOR_APPLY_SCALAR_UNARY_HPP
 
-#include <stan/math/prim/functor/apply_scalar_unary.hpp>
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core/chainablestack.hpp>
 #include <stan/math/rev/core/var.hpp>
+#include <stan/math/rev/core/vari.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/to_ref.hpp>
+#include <stan/math/prim/functor/apply_scalar_unary.hpp>
+#include <new>
 
 namespace stan {
 namespace math {
@@ -31,6 +37,109 @@ struct apply_scalar_unary<F, var> {
   static inline return_t apply(const var& x) { return F::fun(x); }
 };
 
+namespace internal {
+/**
+ * Node propagating the adjoints of the elementwise application of a
+ * unary function. It stores the operands, the results and the
+ * derivatives of the results with respect to the operands in arrays on
+ * the arena. The results are not on the autodiff stack, so their
+ * adjoints are only propagated by this node.
+ */
+class apply_scalar_unary_vari : public vari_base {
+ public:
+  const size_t size_;
+  vari** operands_;
+  vari* results_;
+  double* partials_;
+
+  /**
+   * Construct the node and put it on the autodiff stack. The results
+   * must be constructed in place with <code>set_result()</code>.
+   *
+   * @param size number of operands
+   */
+  explicit apply_scalar_unary_vari(size_t size)
+      : size_(size),
+        operands_(
+            ChainableStack::instance_->memalloc_.alloc_array<vari*>(size)),
+        results_(ChainableStack::instance_->memalloc_.alloc_array<vari>(size)),
+        partials_(
+            ChainableStack::instance_->memalloc_.alloc_array<double>(size)) {
+    ChainableStack::instance_->var_stack_.push_back(this);
+  }
+
+  /**
+   * Construct the result with the specified index, which is not chained.
+   *
+   * @param i index of the result
+   * @param value value of the result
+   * @return result
+   */
+  inline vari* set_result(size_t i, double value) {
+    return ::new (&results_[i]) vari(value, false);
+  }
+
+  inline void chain() final {
+    for (size_t i = 0; i < size_; ++i) {
+      operands_[i]->adj_ += results_[i].adj_ * partials_[i];
+    }
+  }
+
+  inline void set_zero_adjoint() final {}
+};
+}  // namespace internal
+
+/**
+ * Template specialization for vectorized functions applying to
+ * Eigen matrices of `var`, for functions that specialize
+ * <code>apply_scalar_unary_partial</code>. The values and derivatives
+ * are computed with <code>double</code> arguments and the whole matrix
+ * shares one node on the autodiff stack.
+ *
+ * @tparam F Type of function to apply.
+ * @tparam T Type of argument to which function is applied.
+ */
+template <typename F, typename T>
+struct apply_scalar_unary<
+    F, T,
+    require_t<conjunction<is_eigen<T>, is_var<value_type_t<T>>,
+                          internal::has_apply_scalar_unary_partial<F>>>> {
+  /**
+   * Return type for applying the function elementwise to a matrix
+   * expression template of type T.
+   */
+  using return_t = plain_type_t<T>;
+
+  /**
+   * Return the result of applying the function defined by the
+   * template parameter F to the specified matrix argument.
+   *
+   * @param x Matrix to which operation is applied.
+   * @return Componentwise application of the function specified
+   * by F to the specified matrix.
+   */
+  static inline return_t apply(const T& x) {
+    const auto& x_ref = to_ref(x);
+    return_t res(x_ref.rows(), x_ref.cols());
+    if (x_ref.size() == 0) {
+      return res;
+    }
+    auto* node = new internal::apply_scalar_unary_vari(x_ref.size());
+    size_t k = 0;
+    for (Eigen::Index j = 0; j < x_ref.cols(); ++j) {
+      for (Eigen::Index i = 0; i < x_ref.rows(); ++i, ++k) {
+        vari* operand = x_ref.coeff(i, j).vi_;
+        const double f_x = F::fun(operand->val_);
+        node->operands_[k] = operand;
+        node->partials_[k]
+            = apply_scalar_unary_partial<F>::partial(operand->val_, f_x);
+        res.coeffRef(i, j) = var(node->set_result(k, f_x));
+      }
+    }
+    return res;
+  }
+};
+
 }  // namespace math
 }  // namespace stan
 #endif
@@ -0,0 +1,209 @@
+#ifndef STAN_MATH_REV_FUNCTOR_CHECKPOINT_HPP
+#define STAN_MATH_REV_FUNCTOR_CHECKPOINT_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/fun/size.hpp>
+#include <stan/math/prim/fun/value_of.hpp>
+#include <stan/math/prim/functor/apply.hpp>
+#include <tuple>
+#include <type_traits>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Holds the functor and the arguments of a checkpointed segment until the
+ * memory of the autodiff stack is recovered, so that the segment can be
+ * recomputed in the reverse pass.
+ *
+ * @tparam F type of the functor
+ * @tparam Args types of the arguments
+ */
+template <typename F, typename... Args>
+struct checkpoint_storage : public chainable_alloc {
+  F f_;
+  std::tuple<std::decay_t<Args>...> args_;
+
+  explicit checkpoint_storage(const F& f, const Args&... args)
+      : f_(f), args_(args...) {}
+
+  /**
+   * Call the functor with copies of the arguments whose vars are new
+   * varis, which do not link back to the varis of the arguments.
+   *
+   * @tparam Tuple type of the tuple the copies are stored in
+   * @param[out] local_args copies of the arguments
+   * @return result of the functor
+   */
+  template <typename Tuple>
+  auto recompute(Tuple& local_args) const {
+    return apply([this](auto&&... args) { return f_(args...); }, local_args);
+  }
+
+  auto copy_args() const {
+    return apply(
+        [](auto&&... args) {
+          return std::tuple<decltype(deep_copy_vars(args))...>(
+              deep_copy_vars(args)...);
+        },
+        args_);
+  }
+};
+
+/**
+ * Node that recomputes a checkpointed segment on a nested autodiff stack
+ * during the reverse pass, and propagates the adjoints of its results to
+ * its arguments.
+ *
+ * @tparam F type of the functor
+ * @tparam Args types of the arguments
+ */
+template <typename F, typename... Args>
+class checkpoint_vari : public vari_base {
+  const checkpoint_storage<F, Args...>* storage_;
+  const size_t num_inputs_;
+  vari** inputs_;
+  const size_t num_outputs_;
+  vari** outputs_;
+
+ public:
+  checkpoint_vari(const checkpoint_storage<F, Args...>* storage,
+                  size_t num_inputs, vari** inputs, size_t num_outputs,
+                  vari** outputs)
+      : storage_(storage),
+        num_inputs_(num_inputs),
+        inputs_(inputs),
+        num_outputs_(num_outputs),
+        outputs_(outputs) {
+    ChainableStack::instance_->var_stack_.push_back(this);
+  }
+
+  inline void chain() final {
+    bool any_adjoint = false;
+    for (size_t i = 0; i < num_outputs_; ++i) {
+      any_adjoint = any_adjoint || outputs_[i]->adj_ != 0.0;
+    }
+    if (!any_adjoint) {
+      return;
+    }
+
+    Eigen::VectorXd input_adjoints = Eigen::VectorXd::Zero(num_inputs_);
+    {
+      nested_rev_autodiff nested;
+      auto local_args = storage_->copy_args();
+      auto result = storage_->recompute(local_args);
+      vari** local_outputs
+          = ChainableStack::instance_->memalloc_.alloc_array<vari*>(
+              num_outputs_);
+      save_varis(local_outputs, result);
+      // the functor may return the same var more than once
+      for (size_t i = 0; i < num_outputs_; ++i) {
+        local_outputs[i]->adj_ += outputs_[i]->adj_;
+      }
+      grad();
+      apply(
+          [&](auto&&... args) {
+            accumulate_adjoints(input_adjoints.data(), args...);
+          },
+          local_args);
+    }
+    for (size_t i = 0; i < num_inputs_; ++i) {
+      inputs_[i]->adj_ += input_adjoints.coeff(i);
+    }
+  }
+
+  inline void set_zero_adjoint() final {}
+};
+
+/**
+ * Return a `var` whose vari is not chained, for the result of a
+ * checkpointed segment.
+ *
+ * @param value value of the result
+ * @param[out] outputs pointer to the vari of the result
+ * @return result
+ */
+inline var checkpoint_output(double value, vari** outputs) {
+  outputs[0] = new vari(value, false);
+  return var(outputs[0]);
+}
+
+/**
+ * Return a matrix of `var` whose varis are not chained, for the result of
+ * a checkpointed segment.
+ *
+ * @tparam EigMat type of the values of the result
+ * @param values values of the result
+ * @param[out] outputs pointers to the varis of the result
+ * @return result
+ */
+template <typename EigMat, require_eigen_t<EigMat>* = nullptr>
+inline auto checkpoint_output(const EigMat& values, vari** outputs) {
+  promote_scalar_t<var, plain_type_t<EigMat>> res(values.rows(),
+                                                  values.cols());
+  for (Eigen::Index i = 0; i < values.size(); ++i) {
+    outputs[i] = new vari(values.coeff(i), false);
+    res.coeffRef(i) = var(outputs[i]);
+  }
+  return res;
+}
+}  // namespace internal
+
+/**
+ * Return the result of calling the specified functor with the specified
+ * arguments, without keeping the autodiff tape of the call in memory.
+ *
+ * The functor is called on a nested autodiff stack, which is recovered
+ * as soon as its value is known. Only the arguments and one node are
+ * kept on the autodiff stack. In the reverse pass the call is recomputed
+ * on a nested stack and its gradient is propagated to the arguments.
+ * This bounds the size of the autodiff stack of long loops or scans by
+ * the size of one checkpointed segment, at the cost of computing each
+ * segment twice.
+ *
+ * The functor must return a `var` or an Eigen matrix of `var` and must
+ * give the same result when called again with the same arguments. It and
+ * the arguments are copied and kept until the memory of the autodiff
+ * stack is recovered.
+ *
+ * @tparam F type of the functor
+ * @tparam Args types of the arguments
+ * @param f functor
+ * @param args arguments of the functor
+ * @return `f(args...)`
+ */
+template <typename F, typename... Args,
+          require_any_st_var<Args...>* = nullptr>
+inline auto checkpoint(const F& f, const Args&... args) {
+  auto* storage = new internal::checkpoint_storage<F, Args...>(f, args...);
+
+  const size_t num_inputs = count_vars(args...);
+  vari** inputs
+      = ChainableStack::instance_->memalloc_.alloc_array<vari*>(num_inputs);
+  save_varis(inputs, args...);
+
+  using result_t = decltype(storage->recompute(
+      std::declval<decltype(storage->copy_args())&>()));
+  plain_type_t<decltype(value_of(std::declval<result_t>()))> values;
+  {
+    nested_rev_autodiff nested;
+    auto local_args = storage->copy_args();
+    values = value_of(storage->recompute(local_args));
+  }
+
+  const size_t num_outputs = stan::math::size(values);
+  vari** outputs
+      = ChainableStack::instance_->memalloc_.alloc_array<vari*>(num_outputs);
+  auto res = internal::checkpoint_output(values, outputs);
+  new internal::checkpoint_vari<F, Args...>(storage, num_inputs, inputs,
+                                            num_outputs, outputs);
+  return res;
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -117,8 +117,8 @@ struct coupled_ode_system_impl<false, F, T_y0, Args...> {
 
     dz_dt.resize(size());
 
-    // Run nested autodiff in this scope
-    nested_rev_autodiff nested;
+    // Run autodiff on the scratch stack in this scope
+    scratch_rev_autodiff scratch;
 
     Eigen::Matrix<var, Eigen::Dynamic, 1> y_vars(N_);
     for (size_t n = 0; n < N_; ++n)
@@ -133,7 +133,7 @@ struct coupled_ode_system_impl<false, F, T_y0, Args...> {
 
     for (size_t i = 0; i < N_; ++i) {
       dz_dt[i] = f_y_t_vars.coeffRef(i).val();
-      f_y_t_vars.coeffRef(i).grad();
+      grad_and_zero_stack(f_y_t_vars.coeffRef(i).vi_);
 
       y_adjoints_ = y_vars.adj();
 
@@ -146,13 +146,14 @@ struct coupled_ode_system_impl<false, F, T_y0, Args...> {
           },
           local_args_tuple_);
 
-      // The vars here do not live on the nested stack so must be zero'd
+      // The vars here do not live on the scratch stack so must be zero'd
       // separately
       apply([&](auto&&... args) { zero_adjoints(args...); }, local_args_tuple_);
 
+      // The adjoints on the scratch stack were zeroed during the sweep.
       // No need to zero adjoints after last sweep
       if (i + 1 < N_) {
-        nested.set_zero_all_adjoints();
+        set_zero_nochain_adjoints();
       }
 
       // Compute the right hand side for the sensitivities with respect to the
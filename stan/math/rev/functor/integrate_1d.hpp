@@ -21,7 +21,8 @@ namespace math {
 
 /**
  * Calculate first derivative of f(x, param, std::ostream&)
- * with respect to the nth parameter. Uses nested reverse mode autodiff
+ * with respect to the nth parameter. Uses reverse mode autodiff on the
+ * scratch stack
  *
  * Gradients that evaluate to NaN are set to zero if the function itself
  * evaluates to zero. If the function is not zero and the gradient evaluates to
@@ -37,8 +38,8 @@ inline double gradient_of_f(const F &f, const double &x, const double &xc,
                             std::ostream *msgs) {
   double gradient = 0.0;
 
-  // Run nested autodiff in this scope
-  nested_rev_autodiff nested;
+  // Run autodiff on the scratch stack in this scope
+  scratch_rev_autodiff scratch;
 
   std::vector<var> theta_var(theta_vals.size());
   for (size_t i = 0; i < theta_vals.size(); i++) {
@@ -16,20 +16,19 @@ void jacobian(const F& f, const Eigen::Matrix<double, Eigen::Dynamic, 1>& x,
               Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>& J) {
   using Eigen::Dynamic;
   using Eigen::Matrix;
-  // Run nested autodiff in this scope
-  nested_rev_autodiff nested;
+  // Run autodiff on the scratch stack in this scope
+  scratch_rev_autodiff scratch;
 
   Matrix<var, Dynamic, 1> x_var(x);
   Matrix<var, Dynamic, 1> fx_var = f(x_var);
   fx.resize(fx_var.size());
   J.resize(x.size(), fx_var.size());
   fx = fx_var.val();
-  grad(fx_var(0).vi_);
-  J.col(0) = x_var.adj();
-  for (int i = 1; i < fx_var.size(); ++i) {
-    nested.set_zero_all_adjoints();
-    grad(fx_var(i).vi_);
+  for (int i = 0; i < fx_var.size(); ++i) {
+    // The sweep leaves only the adjoints of the nochain varis to reset
+    grad_and_zero_stack(fx_var(i).vi_);
     J.col(i) = x_var.adj();
+    set_zero_nochain_adjoints();
   }
   J.transposeInPlace();
 }
@@ -2,6 +2,8 @@
 #define STAN_MATH_REV_FUNCTOR_MAP_RECT_REDUCE_HPP
 
 #include <stan/math/rev/core/var.hpp>
+#include <stan/math/rev/core/grad.hpp>
+#include <stan/math/rev/core/set_zero_nochain_adjoints.hpp>
 #include <stan/math/rev/fun/typedefs.hpp>
 #include <stan/math/rev/fun/to_var.hpp>
 #include <stan/math/prim/fun/typedefs.hpp>
@@ -37,14 +39,14 @@ struct map_rect_reduce<F, var, var> {
 
     for (size_type i = 0; i < size_f; ++i) {
       out(0, i) = fx_v(i).val();
-      nested.set_zero_all_adjoints();
-      fx_v(i).grad();
+      grad_and_zero_stack(fx_v(i).vi_);
       for (size_type j = 0; j < num_shared_params; ++j) {
         out(1 + j, i) = shared_params_v(j).vi_->adj_;
       }
       for (size_type j = 0; j < num_job_specific_params; ++j) {
         out(1 + num_shared_params + j, i) = job_specific_params_v(j).vi_->adj_;
       }
+      set_zero_nochain_adjoints();
     }
     return out;
   }
@@ -73,11 +75,11 @@ struct map_rect_reduce<F, double, var> {
 
     for (size_type i = 0; i < size_f; ++i) {
       out(0, i) = fx_v(i).val();
-      nested.set_zero_all_adjoints();
-      fx_v(i).grad();
+      grad_and_zero_stack(fx_v(i).vi_);
       for (size_type j = 0; j < num_job_specific_params; ++j) {
         out(1 + j, i) = job_specific_params_v(j).vi_->adj_;
       }
+      set_zero_nochain_adjoints();
     }
     return out;
   }
@@ -106,11 +108,11 @@ struct map_rect_reduce<F, var, double> {
 
     for (size_type i = 0; i < size_f; ++i) {
       out(0, i) = fx_v(i).val();
-      nested.set_zero_all_adjoints();
-      fx_v(i).grad();
+      grad_and_zero_stack(fx_v(i).vi_);
       for (size_type j = 0; j < num_shared_params; ++j) {
         out(1 + j, i) = shared_params_v(j).vi_->adj_;
       }
+      set_zero_nochain_adjoints();
     }
 
     return out;
@@ -4,6 +4,7 @@
 #include <stan/math/rev/meta.hpp>
 #include <stan/math/rev/core/chainablestack.hpp>
 #include <stan/math/rev/core/precomputed_gradients.hpp>
+#include <stan/math/rev/core/profiling.hpp>
 #include <stan/math/rev/core/var.hpp>
 #include <stan/math/rev/core/vari.hpp>
 #include <stan/math/rev/fun/typedefs.hpp>
@@ -115,6 +116,7 @@ class operands_and_partials<Op1, Op2, Op3, Op4, Op5, var> {
    * @return the node to be stored in the expression graph for autodiff
    */
   var build(double value) {
+    internal::auto_profile_scope profile_scope("operands_and_partials");
     size_t edges_size = edge1_.size() + edge2_.size() + edge3_.size()
                         + edge4_.size() + edge5_.size();
     vari** varis
@@ -301,10 +303,11 @@ class ops_partials_edge<double, std::vector<Eigen::Matrix<var, R, C>>> {
     }
   }
   int size() {
-    if (unlikely(this->operands_.size() == 0)) {
-      return 0;
+    int total = 0;
+    for (size_t i = 0; i < this->operands_.size(); ++i) {
+      total += this->operands_[i].size();
     }
-    return this->operands_.size() * this->operands_[0].size();
+    return total;
   }
   std::tuple<> container_operands() { return std::tuple<>(); }
   std::tuple<> container_partials() { return std::tuple<>(); }
@@ -0,0 +1,305 @@
+#ifndef STAN_MATH_REV_FUNCTOR_PARALLEL_REGION_HPP
+#define STAN_MATH_REV_FUNCTOR_PARALLEL_REGION_HPP
+
+#include <stan/math/rev/meta.hpp>
+#include <stan/math/rev/core.hpp>
+#include <stan/math/prim/fun/Eigen.hpp>
+#include <stan/math/prim/functor/apply.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <algorithm>
+#include <initializer_list>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+namespace stan {
+namespace math {
+namespace internal {
+
+/**
+ * Call the specified functor with a pointer to the adjoint of each
+ * scalar of the argument, which may be a `var`, a `var` with an Eigen
+ * value type or a view of one, or an Eigen matrix or `std::vector` of
+ * those. Arithmetic arguments have no adjoints.
+ *
+ * @tparam F type of the functor
+ * @tparam T type of the argument
+ * @param f functor
+ * @param x argument
+ */
+template <typename F, typename T, require_st_arithmetic<T>* = nullptr>
+inline void for_each_adjoint(F&& f, const T& x) {}
+
+template <typename F>
+inline void for_each_adjoint(F&& f, const var& x) {
+  f(&x.vi_->adj_);
+}
+
+template <typename F, typename T, require_eigen_t<T>* = nullptr>
+inline void for_each_adjoint(F&& f, const var_value<T>& x) {
+  for (Eigen::Index j = 0; j < x.vi_->adj_.cols(); ++j) {
+    for (Eigen::Index i = 0; i < x.vi_->adj_.rows(); ++i) {
+      f(&x.vi_->adj_.coeffRef(i, j));
+    }
+  }
+}
+
+template <typename F, typename EigT, require_eigen_vt<is_var, EigT>* = nullptr>
+inline void for_each_adjoint(F&& f, const EigT& x) {
+  for (Eigen::Index i = 0; i < x.size(); ++i) {
+    for_each_adjoint(f, x.coeff(i));
+  }
+}
+
+template <typename F, typename Vec, require_std_vector_t<Vec>* = nullptr,
+          require_not_st_arithmetic<Vec>* = nullptr>
+inline void for_each_adjoint(F&& f, const Vec& x) {
+  for (const auto& x_i : x) {
+    for_each_adjoint(f, x_i);
+  }
+}
+
+/**
+ * Return a pointer to the adjoint of each scalar of the arguments, in an
+ * array allocated on the arena.
+ *
+ * @tparam Args types of the arguments
+ * @param[out] size number of adjoints
+ * @param args arguments
+ * @return pointers to the adjoints
+ */
+template <typename... Args>
+inline double** save_adjoints(size_t& size, const Args&... args) {
+  size = 0;
+  auto count = [&](double*) { ++size; };
+  static_cast<void>(
+      std::initializer_list<int>{(for_each_adjoint(count, args), 0)...});
+  double** adjs
+      = ChainableStack::instance_->memalloc_.alloc_array<double*>(size);
+  double** dest = adjs;
+  auto save = [&](double* adj) { *dest++ = adj; };
+  static_cast<void>(
+      std::initializer_list<int>{(for_each_adjoint(save, args), 0)...});
+  return adjs;
+}
+
+/**
+ * The autodiff tape of one call of `parallel_region()`. The tape only
+ * writes to the adjoints of its own varis and of the local copies of the
+ * arguments, so the tapes of independent regions can be chained
+ * concurrently.
+ */
+struct parallel_region_tape {
+  vari_base** stack_;
+  size_t stack_size_;
+  size_t num_inputs_;
+  double** inputs_;
+  double** local_inputs_;
+
+  /**
+   * Chain the varis of the tape, from the last one to the first one.
+   */
+  inline void chain() const {
+    for (size_t i = stack_size_; i-- > 0;) {
+      stack_[i]->chain();
+    }
+  }
+
+  /**
+   * Add the adjoints of the local copies of the arguments to the
+   * adjoints of the arguments.
+   */
+  inline void accumulate_adjoints() const {
+    for (size_t i = 0; i < num_inputs_; ++i) {
+      *inputs_[i] += *local_inputs_[i];
+    }
+  }
+
+  inline void set_zero_adjoint() const {
+    for (size_t i = 0; i < stack_size_; ++i) {
+      stack_[i]->set_zero_adjoint();
+    }
+  }
+
+  /**
+   * Return true if the adjoint of one of the arguments of the region is
+   * in the specified set. Views of a `var` with an Eigen value type share
+   * its adjoints, so this also finds the arguments that are views of the
+   * results of other regions.
+   *
+   * @param adjs set of adjoints
+   */
+  inline bool depends_on(const std::unordered_set<const double*>& adjs) const {
+    return std::any_of(inputs_, inputs_ + num_inputs_,
+                       [&](const double* x) { return adjs.count(x) > 0; });
+  }
+};
+
+/**
+ * Regions of a `parallel_region_vari` and the adjoints of their results.
+ */
+struct parallel_region_group : public chainable_alloc {
+  std::vector<parallel_region_tape> regions_;
+  std::unordered_set<const double*> outputs_;
+};
+
+/**
+ * Node for consecutive calls of `parallel_region()` that do not depend on
+ * each other's results. Its `chain()` chains the tapes of the regions
+ * concurrently with TBB when `STAN_THREADS` is defined, as the regions
+ * share the autodiff stack of the thread otherwise, then adds the
+ * adjoints of their local copies of the arguments to the arguments one
+ * region after the other, so that arguments shared by several regions
+ * are updated without races and in a deterministic order.
+ */
+class parallel_region_vari : public vari_base {
+  parallel_region_group* group_;
+
+ public:
+  parallel_region_vari() : group_(new parallel_region_group()) {
+    ChainableStack::instance_->var_stack_.push_back(this);
+  }
+
+  /**
+   * Return true if the specified region uses the result of one of the
+   * regions of this node.
+   *
+   * @param region tape of the region
+   */
+  inline bool is_dependency_of(const parallel_region_tape& region) const {
+    return region.depends_on(group_->outputs_);
+  }
+
+  /**
+   * Add a region to this node.
+   *
+   * @param region tape of the region
+   * @param num_outputs number of adjoints of the result of the region
+   * @param outputs adjoints of the result of the region
+   */
+  inline void append(const parallel_region_tape& region, size_t num_outputs,
+                     double** outputs) {
+    group_->regions_.push_back(region);
+    group_->outputs_.insert(outputs, outputs + num_outputs);
+  }
+
+  inline void chain() final {
+    const auto& regions = group_->regions_;
+#ifdef STAN_THREADS
+    if (regions.size() == 1) {
+      regions[0].chain();
+    } else {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, regions.size(), 1),
+                        [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i < r.end(); ++i) {
+                            regions[i].chain();
+                          }
+                        });
+    }
+#else
+    for (const auto& region : regions) {
+      region.chain();
+    }
+#endif
+    for (const auto& region : regions) {
+      region.accumulate_adjoints();
+    }
+  }
+
+  inline void set_zero_adjoint() final {
+    for (const auto& region : group_->regions_) {
+      region.set_zero_adjoint();
+    }
+  }
+};
+
+/**
+ * Add the tape of a region to the `parallel_region_vari` on top of the
+ * autodiff stack if the region does not use its results, or to a new
+ * `parallel_region_vari` otherwise. Nodes created outside of the current
+ * nested autodiff scope are never reused. Any var computed from the
+ * results outside of a region pushes a node on the autodiff stack, so
+ * the node on top of the stack is only reused if the arguments are the
+ * results, or views of the results, of its regions or were created
+ * before it.
+ *
+ * @param region tape of the region
+ * @param num_outputs number of adjoints of the result of the region
+ * @param outputs adjoints of the result of the region
+ */
+inline void push_parallel_region(const parallel_region_tape& region,
+                                 size_t num_outputs, double** outputs) {
+  const auto& stack = ChainableStack::instance_->var_stack_;
+  parallel_region_vari* node = nullptr;
+  if (!stack.empty() && (empty_nested() || nested_size() > 0)) {
+    node = dynamic_cast<parallel_region_vari*>(stack.back());
+  }
+  if (node == nullptr || node->is_dependency_of(region)) {
+    node = new parallel_region_vari();
+  }
+  node->append(region, num_outputs, outputs);
+}
+}  // namespace internal
+
+/**
+ * Return the result of calling the specified functor with the specified
+ * arguments, recording its autodiff tape so that it can be chained in
+ * parallel with the tapes of other regions.
+ *
+ * The functor is called with copies of the arguments whose vars are new
+ * varis. The varis it creates are moved from the autodiff stack to the
+ * tape of the region. Consecutive regions that do not use each other's
+ * results, such as independent terms of a log density that are only
+ * summed at the end, share a single node on the autodiff stack, which
+ * chains their tapes concurrently on the TBB worker threads during the
+ * reverse pass and then adds the adjoints of the copies of the arguments
+ * to the arguments.
+ *
+ * The functor must only use vars that are passed as arguments, must not
+ * keep references to the vars it creates, and must return a `var`, a
+ * container of `var`, an Eigen matrix of `var` or a `var` with an Eigen
+ * value type.
+ *
+ * @tparam F type of the functor
+ * @tparam Args types of the arguments
+ * @param f functor
+ * @param args arguments of the functor
+ * @return `f(args...)`
+ */
+template <typename F, typename... Args,
+          require_any_st_var<Args...>* = nullptr>
+inline auto parallel_region(const F& f, const Args&... args) {
+  auto& stack = ChainableStack::instance_->var_stack_;
+  internal::parallel_region_tape region;
+
+  region.inputs_ = internal::save_adjoints(region.num_inputs_, args...);
+
+  std::tuple<decltype(deep_copy_vars(args))...> local_args(
+      deep_copy_vars(args)...);
+  size_t num_local_inputs = 0;
+  region.local_inputs_ = apply(
+      [&](auto&&... args) {
+        return internal::save_adjoints(num_local_inputs, args...);
+      },
+      local_args);
+
+  const size_t start = stack.size();
+  plain_type_t<decltype(apply(f, local_args))> result = apply(f, local_args);
+  region.stack_size_ = stack.size() - start;
+  region.stack_
+      = ChainableStack::instance_->memalloc_.alloc_array<vari_base*>(
+          region.stack_size_);
+  std::copy(stack.begin() + start, stack.end(), region.stack_);
+  stack.resize(start);
+
+  size_t num_outputs = 0;
+  double** outputs = internal::save_adjoints(num_outputs, result);
+  internal::push_parallel_region(region, num_outputs, outputs);
+  return result;
+}
+
+}  // namespace math
+}  // namespace stan
+
+#endif
@@ -8,6 +8,7 @@
 #include <tbb/parallel_reduce.h>
 #include <tbb/blocked_range.h>
 
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -37,6 +38,9 @@ struct reduce_sum_impl<ReduceFunction, require_var_t<ReturnType>, ReturnType,
    * @note see link [here](https://tinyurl.com/vp7xw2t) for requirements.
    */
   struct recursive_reducer {
+    using local_args_tuple_t
+        = std::tuple<decltype(deep_copy_vars(std::declval<Args&>()))...>;
+
     const size_t num_vars_per_term_;
     const size_t num_vars_shared_terms_;  // Number of vars in shared arguments
     double* sliced_partials_;  // Points to adjoints of the partial calculations
@@ -45,6 +49,9 @@ struct reduce_sum_impl<ReduceFunction, require_var_t<ReturnType>, ReturnType,
     std::tuple<Args...> args_tuple_;
     double sum_{0.0};
     Eigen::VectorXd args_adjoints_{0};
+    // Autodiff stack holding the copies of the shared arguments
+    std::unique_ptr<ChainableStack::AutodiffStackStorage> local_stack_;
+    std::unique_ptr<local_args_tuple_t> local_args_tuple_;
 
     template <typename VecT, typename... ArgsT>
     recursive_reducer(size_t num_vars_per_term, size_t num_vars_shared_terms,
@@ -71,6 +78,43 @@ struct reduce_sum_impl<ReduceFunction, require_var_t<ReturnType>, ReturnType,
           msgs_(other.msgs_),
           args_tuple_(other.args_tuple_) {}
 
+    /**
+     * Create the copies of the shared arguments used by every range this
+     *  reducer computes. Their varis are allocated on an autodiff stack owned
+     *  by the reducer, so that they outlive the nested autodiff of each
+     *  range, and their adjoints accumulate over all the ranges until they
+     *  are collected by `collect_args_adjoints()`.
+     */
+    inline void copy_shared_args() {
+      local_stack_ = std::make_unique<ChainableStack::AutodiffStackStorage>();
+      auto* outer_stack = ChainableStack::instance_;
+      ChainableStack::instance_ = local_stack_.get();
+      local_args_tuple_ = apply(
+          [&](auto&&... args) {
+            return std::make_unique<local_args_tuple_t>(
+                deep_copy_vars(args)...);
+          },
+          args_tuple_);
+      ChainableStack::instance_ = outer_stack;
+    }
+
+    /**
+     * Add the adjoints of the copies of the shared arguments to
+     *  args_adjoints_ and release the copies.
+     */
+    inline void collect_args_adjoints() {
+      if (!local_args_tuple_) {
+        return;
+      }
+      apply(
+          [&](auto&&... args) {
+            accumulate_adjoints(args_adjoints_.data(), args...);
+          },
+          *local_args_tuple_);
+      local_args_tuple_.reset();
+      local_stack_.reset();
+    }
+
     /**
      * Compute, using nested autodiff, the value and Jacobian of
      *  `ReduceFunction` called over the range defined by r and accumulate those
@@ -82,6 +126,10 @@ struct reduce_sum_impl<ReduceFunction, require_var_t<ReturnType>, ReturnType,
      * function may be called multiple times per object instantiation (so the
      * sum_ and args_adjoints_ must be accumulated, not just assigned).
      *
+     * The copies of the shared arguments are only made for the first range
+     *  and reused for the following ones, so a range only allocates varis
+     *  for its slice of the sliced argument.
+     *
      * @param r Range over which to compute reduce_sum
      */
     inline void operator()(const tbb::blocked_range<size_t>& r) {
@@ -93,6 +141,10 @@ struct reduce_sum_impl<ReduceFunction, require_var_t<ReturnType>, ReturnType,
         args_adjoints_ = Eigen::VectorXd::Zero(num_vars_shared_terms_);
       }
 
+      if (!local_args_tuple_) {
+        copy_shared_args();
+      }
+
       // Initialize nested autodiff stack
       const nested_rev_autodiff begin_nest;
 
@@ -104,22 +156,13 @@ struct reduce_sum_impl<ReduceFunction, require_var_t<ReturnType>, ReturnType,
         local_sub_slice.emplace_back(deep_copy_vars(vmapped_[i]));
       }
 
-      // Create nested autodiff copies of all shared arguments that do not point
-      //   back to main autodiff stack
-      auto args_tuple_local_copy = apply(
-          [&](auto&&... args) {
-            return std::tuple<decltype(deep_copy_vars(args))...>(
-                deep_copy_vars(args)...);
-          },
-          args_tuple_);
-
       // Perform calculation
       var sub_sum_v = apply(
           [&](auto&&... args) {
             return ReduceFunction()(local_sub_slice, r.begin(), r.end() - 1,
                                     msgs_, args...);
           },
-          args_tuple_local_copy);
+          *local_args_tuple_);
 
       // Compute Jacobian
       sub_sum_v.grad();
@@ -130,14 +173,6 @@ struct reduce_sum_impl<ReduceFunction, require_var_t<ReturnType>, ReturnType,
       // Accumulate adjoints of sliced_arguments
       accumulate_adjoints(sliced_partials_ + r.begin() * num_vars_per_term_,
                           std::move(local_sub_slice));
-
-      // Accumulate adjoints of shared_arguments
-      apply(
-          [&](auto&&... args) {
-            accumulate_adjoints(args_adjoints_.data(),
-                                std::forward<decltype(args)>(args)...);
-          },
-          std::move(args_tuple_local_copy));
     }
 
     /**
@@ -146,7 +181,8 @@ struct reduce_sum_impl<ReduceFunction, require_var_t<ReturnType>, ReturnType,
      *
      * @param rhs Another partial sum
      */
-    inline void join(const recursive_reducer& rhs) {
+    inline void join(recursive_reducer& rhs) {
+      rhs.collect_args_adjoints();
       sum_ += rhs.sum_;
       if (args_adjoints_.size() != 0 && rhs.args_adjoints_.size() != 0) {
         args_adjoints_ += rhs.args_adjoints_;
@@ -234,6 +270,7 @@ struct reduce_sum_impl<ReduceFunction, require_var_t<ReturnType>, ReturnType,
           partitioner);
     }
 
+    worker.collect_args_adjoints();
     for (size_t i = 0; i < num_vars_shared_terms; ++i) {
       partials[num_vars_sliced_terms + i] = worker.args_adjoints_(i);
     }
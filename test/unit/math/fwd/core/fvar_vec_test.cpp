@@ -0,0 +1,92 @@
+#include <stan/math/fwd.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <sstream>
+
+TEST(mathFwdCoreFvarVec, ctor) {
+  using stan::math::fvar_vec;
+  fvar_vec<double, 3> a;
+  EXPECT_FLOAT_EQ(0.0, a.val_);
+  EXPECT_TRUE((a.d_ == 0.0).all());
+
+  fvar_vec<double, 3> b(1.9);
+  EXPECT_FLOAT_EQ(1.9, b.val_);
+  EXPECT_TRUE((b.d_ == 0.0).all());
+
+  fvar_vec<double, 3> c = stan::math::seed_fvar_vec<double, 3>(2.5, 1);
+  EXPECT_FLOAT_EQ(2.5, c.val());
+  EXPECT_FLOAT_EQ(0.0, c.tangent()(0));
+  EXPECT_FLOAT_EQ(1.0, c.tangent()(1));
+  EXPECT_FLOAT_EQ(0.0, c.tangent()(2));
+
+  fvar_vec<double, 3> d = stan::math::seed_fvar_vec<double, 3>(2.5, 3);
+  EXPECT_TRUE((d.d_ == 0.0).all());
+
+  std::stringstream ss;
+  ss << b;
+  EXPECT_EQ("1.9", ss.str());
+}
+
+TEST(mathFwdCoreFvarVec, arithmetic) {
+  using stan::math::fvar_vec;
+  using stan::math::seed_fvar_vec;
+  fvar_vec<double, 2> x = seed_fvar_vec<double, 2>(1.5, 0);
+  fvar_vec<double, 2> y = seed_fvar_vec<double, 2>(-0.5, 1);
+
+  // f(x, y) = (x * y - 2 * x) / (y + 3) - x
+  fvar_vec<double, 2> f = (x * y - 2.0 * x) / (y + 3.0) - x;
+  EXPECT_FLOAT_EQ((1.5 * -0.5 - 3.0) / 2.5 - 1.5, f.val_);
+  EXPECT_FLOAT_EQ((-0.5 - 2.0) / 2.5 - 1.0, f.d_(0));
+  EXPECT_FLOAT_EQ(1.5 / 2.5 - (1.5 * -0.5 - 3.0) / (2.5 * 2.5), f.d_(1));
+
+  fvar_vec<double, 2> g = 1.0 / -x;
+  EXPECT_FLOAT_EQ(-1 / 1.5, g.val_);
+  EXPECT_FLOAT_EQ(1 / (1.5 * 1.5), g.d_(0));
+  EXPECT_FLOAT_EQ(0.0, g.d_(1));
+
+  fvar_vec<double, 2> h = x;
+  h *= y;
+  h += 1.0;
+  h /= x;
+  h -= y;
+  EXPECT_FLOAT_EQ(1 / 1.5, h.val_);
+  EXPECT_FLOAT_EQ(-1 / (1.5 * 1.5), h.d_(0));
+  EXPECT_FLOAT_EQ(0.0, h.d_(1));
+
+  EXPECT_TRUE(y < x);
+  EXPECT_TRUE(x > 1.0);
+  EXPECT_TRUE(x <= 1.5);
+  EXPECT_TRUE(2.0 >= x);
+  EXPECT_TRUE(x == 1.5);
+  EXPECT_TRUE(x != y);
+}
+
+TEST(mathFwdCoreFvarVec, functionsMatchFvar) {
+  using stan::math::fvar;
+  using stan::math::fvar_vec;
+  using stan::math::seed_fvar_vec;
+  auto f = [](const auto& x, const auto& y) {
+    using std::exp;
+    using std::log;
+    using std::sqrt;
+    using stan::math::expm1;
+    using stan::math::fabs;
+    using stan::math::inv;
+    using stan::math::inv_logit;
+    using stan::math::lgamma;
+    using stan::math::log1p;
+    using stan::math::square;
+    return exp(x) * log(y) + sqrt(y) * sin(x) - cos(y) * tan(x) + tanh(x * y)
+           + log1p(y) * expm1(x) + inv(y) + inv_logit(x) - fabs(x - y)
+           + lgamma(y) + square(x);
+  };
+  double x = 0.7;
+  double y = 2.3;
+  fvar_vec<double, 2> res = f(seed_fvar_vec<double, 2>(x, 0),
+                              seed_fvar_vec<double, 2>(y, 1));
+  fvar<double> res_x = f(fvar<double>(x, 1), fvar<double>(y, 0));
+  fvar<double> res_y = f(fvar<double>(x, 0), fvar<double>(y, 1));
+  EXPECT_FLOAT_EQ(res_x.val_, res.val_);
+  EXPECT_FLOAT_EQ(res_x.d_, res.d_(0));
+  EXPECT_FLOAT_EQ(res_y.d_, res.d_(1));
+}
@@ -119,3 +119,17 @@ TEST(stack_alloc, in_stack_second_block) {
   EXPECT_FALSE(allocator.in_stack(x));
   EXPECT_FALSE(allocator.in_stack(y));
 }
+
+TEST(stack_alloc, bytes_used) {
+  stan::math::stack_alloc allocator;
+  EXPECT_EQ(0, allocator.bytes_used());
+  allocator.alloc(24);
+  EXPECT_EQ(24, allocator.bytes_used());
+  allocator.start_nested();
+  allocator.alloc(1 << 17);
+  EXPECT_EQ((1 << 16) + (1 << 17), allocator.bytes_used());
+  allocator.recover_nested();
+  EXPECT_EQ(24, allocator.bytes_used());
+  allocator.recover_all();
+  EXPECT_EQ(0, allocator.bytes_used());
+}
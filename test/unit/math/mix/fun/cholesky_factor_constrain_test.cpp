@@ -0,0 +1,51 @@
+#include <test/unit/math/test_ad.hpp>
+
+namespace cholesky_factor_constrain_test {
+template <typename T>
+typename Eigen::Matrix<typename stan::scalar_type<T>::type, -1, -1> g1(
+    const T& x, int M, int N) {
+  return stan::math::cholesky_factor_constrain(x, M, N);
+}
+template <typename T>
+typename Eigen::Matrix<typename stan::scalar_type<T>::type, -1, -1> g2(
+    const T& x, int M, int N) {
+  typename stan::scalar_type<T>::type lp = 0;
+  auto a = stan::math::cholesky_factor_constrain(x, M, N, lp);
+  return a;
+}
+template <typename T>
+typename stan::scalar_type<T>::type g3(const T& x, int M, int N) {
+  typename stan::scalar_type<T>::type lp = 0;
+  stan::math::cholesky_factor_constrain(x, M, N, lp);
+  return lp;
+}
+
+template <typename T>
+void expect_cholesky_factor_transform(const T& x, int M, int N) {
+  auto f1 = [M, N](const auto& x) { return g1(x, M, N); };
+  auto f2 = [M, N](const auto& x) { return g2(x, M, N); };
+  auto f3 = [M, N](const auto& x) { return g3(x, M, N); };
+  stan::test::expect_ad(f1, x);
+  stan::test::expect_ad(f2, x);
+  stan::test::expect_ad(f3, x);
+}
+}  // namespace cholesky_factor_constrain_test
+
+TEST(MathMixMatFun, cholesky_factorTransform) {
+  // sizes must be (N choose 2) + N + (M - N) * N
+
+  Eigen::VectorXd v0(0);
+  cholesky_factor_constrain_test::expect_cholesky_factor_transform(v0, 0, 0);
+
+  Eigen::VectorXd v1(1);
+  v1 << -1.7;
+  cholesky_factor_constrain_test::expect_cholesky_factor_transform(v1, 1, 1);
+
+  Eigen::VectorXd v3(3);
+  v3 << -1.7, 2.9, 0.01;
+  cholesky_factor_constrain_test::expect_cholesky_factor_transform(v3, 2, 2);
+
+  Eigen::VectorXd v5(5);
+  v5 << 1, 2, -3, 1.5, 0.2;
+  cholesky_factor_constrain_test::expect_cholesky_factor_transform(v5, 3, 2);
+}
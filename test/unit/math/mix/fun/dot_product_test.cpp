@@ -100,3 +100,24 @@ TEST(mathMixMatFun, dotProduct) {
   };
   test_dot_product(g);  // standard data type args
 }
+
+TEST(MathMixMatFun, dotProduct_varmat) {
+  auto f = [](const auto& x, const auto& y) {
+    return stan::math::dot_product(x, y);
+  };
+  Eigen::VectorXd v0(0);
+  stan::test::expect_ad_matvar(f, v0, v0);
+
+  Eigen::VectorXd v3(3);
+  v3 << 1, 3, -5;
+  Eigen::VectorXd v3b(3);
+  v3b << 4, -2, -1;
+  Eigen::RowVectorXd rv3b = v3b.transpose();
+  stan::test::expect_ad_matvar(f, v3, v3b);
+  stan::test::expect_ad_matvar(f, v3, rv3b);
+  stan::test::expect_ad_matvar(f, rv3b, v3);
+
+  Eigen::VectorXd v2(2);
+  v2 << 1, 2;
+  stan::test::expect_ad_matvar(f, v3, v2);
+}
@@ -39,3 +39,22 @@ TEST(MathMixMatFun, eigenvaluesSym) {
   tols.grad_hessian_grad_hessian_ = relative_tolerance(1e-1, 5e-1);
   stan::test::expect_ad(tols, f, a22);
 }
+
+TEST(MathMixMatFun, eigenvaluesSym_varmat) {
+  auto f = [](const auto& x) { return stan::math::eigenvalues_sym(x); };
+
+  Eigen::MatrixXd a11(1, 1);
+  a11 << 2.3;
+  stan::test::expect_ad_matvar(f, a11);
+
+  Eigen::MatrixXd a33(3, 3);
+  a33 << 1, 2, 3, 2, 5, 7.9, 3, 7.9, 1.08;
+  stan::test::expect_ad_matvar(f, a33);
+
+  // exceptions: empty and asymmetric
+  Eigen::MatrixXd m00(0, 0);
+  stan::test::expect_ad_matvar(f, m00);
+  Eigen::MatrixXd m22(2, 2);
+  m22 << 1, 2, 3, 4;
+  stan::test::expect_ad_matvar(f, m22);
+}
@@ -33,3 +33,25 @@ TEST(MathMixMatFun, eigenvectorsSym) {
   a33 << 1, 2, 3, 2, 5, 7.9, 3, 7.9, 1.08;
   stan::test::expect_ad(tols, f, a33);
 }
+
+TEST(MathMixMatFun, eigenvectorsSym_varmat) {
+  auto f = [](const auto& x) { return stan::math::eigenvectors_sym(x); };
+
+  Eigen::MatrixXd a11(1, 1);
+  a11 << 2;
+  stan::test::expect_ad_matvar(f, a11);
+
+  Eigen::MatrixXd a33(3, 3);
+  a33 << 1, 2, 3, 2, 5, 7.9, 3, 7.9, 1.08;
+  stan::test::expect_ad_matvar(f, a33);
+
+  // exceptions: empty, asymmetric and not square
+  Eigen::MatrixXd m00(0, 0);
+  stan::test::expect_ad_matvar(f, m00);
+  Eigen::MatrixXd m22(2, 2);
+  m22 << 1, 2, 3, 4;
+  stan::test::expect_ad_matvar(f, m22);
+  Eigen::MatrixXd a23(2, 3);
+  a23 << 1, 2, 3, 4, 5, 6;
+  stan::test::expect_ad_matvar(f, a23);
+}
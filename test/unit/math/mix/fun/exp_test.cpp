@@ -10,3 +10,16 @@ TEST(mathMixMatFun, exp) {
                                       10);
   stan::test::expect_complex_common(f);
 }
+
+TEST(mathMixMatFun, exp_varmat) {
+  auto f = [](const auto& x1) { return stan::math::exp(x1); };
+  Eigen::MatrixXd A(2, 3);
+  A << -15.2, -0.5, 0.5, 1, 1.3, 5;
+  stan::test::expect_ad_matvar(f, A);
+  Eigen::VectorXd a = A.row(0).transpose();
+  stan::test::expect_ad_matvar(f, a);
+  Eigen::RowVectorXd b = A.row(1);
+  stan::test::expect_ad_matvar(f, b);
+  Eigen::MatrixXd A0(0, 0);
+  stan::test::expect_ad_matvar(f, A0);
+}
@@ -6,3 +6,16 @@ TEST(mathMixMatFun, log1pExp) {
   stan::test::expect_unary_vectorized(f, -2.6, -2, -1, -0.5, -0.2, 0.5, 1.0,
                                       1.3, 2, 3);
 }
+
+TEST(mathMixMatFun, log1pExp_varmat) {
+  auto f = [](const auto& x1) { return stan::math::log1p_exp(x1); };
+  Eigen::MatrixXd A(2, 3);
+  A << -2.6, -1, -0.2, 0.5, 1.3, 3;
+  stan::test::expect_ad_matvar(f, A);
+  Eigen::VectorXd a = A.row(0).transpose();
+  stan::test::expect_ad_matvar(f, a);
+  Eigen::RowVectorXd b = A.row(1);
+  stan::test::expect_ad_matvar(f, b);
+  Eigen::MatrixXd A0(0, 0);
+  stan::test::expect_ad_matvar(f, A0);
+}
@@ -25,3 +25,16 @@ TEST(mathMixMatFun, log) {
   stan::test::expect_ad(f, std::complex<double>{2.1, -0.0});
   // (negative real and zero imaginary illegal)
 }
+
+TEST(mathMixMatFun, log_varmat) {
+  auto f = [](const auto& x1) { return stan::math::log(x1); };
+  Eigen::MatrixXd A(2, 3);
+  A << 1e-3, 0.5, 1, 1.3, 3.7, 10.2;
+  stan::test::expect_ad_matvar(f, A);
+  Eigen::VectorXd a = A.row(0).transpose();
+  stan::test::expect_ad_matvar(f, a);
+  Eigen::RowVectorXd b = A.row(1);
+  stan::test::expect_ad_matvar(f, b);
+  Eigen::MatrixXd A0(0, 0);
+  stan::test::expect_ad_matvar(f, A0);
+}
@@ -72,3 +72,39 @@ TEST(MathMixMatFun, mdivideLeftSpd) {
 
   stan::math::recover_memory();
 }
+
+TEST(MathMixMatFun, mdivideLeftSpd_varmat) {
+  auto f = [](const auto& x, const auto& y) {
+    return stan::math::mdivide_left_spd(x, y);
+  };
+
+  Eigen::MatrixXd m00(0, 0);
+  Eigen::VectorXd v0(0);
+  stan::test::expect_ad_matvar(f, m00, m00);
+  stan::test::expect_ad_matvar(f, m00, v0);
+
+  Eigen::MatrixXd a(2, 2);
+  a << 2, 3, 3, 7;
+  Eigen::MatrixXd b(2, 2);
+  b << 3, 0, 0, 4;
+  Eigen::MatrixXd c(2, 2);
+  c << 12, 13, 15, 17;
+  Eigen::VectorXd d(2);
+  d << 12, 13;
+  stan::test::expect_ad_matvar(f, a, c);
+  stan::test::expect_ad_matvar(f, b, c);
+  stan::test::expect_ad_matvar(f, a, d);
+
+  Eigen::MatrixXd e(4, 4);
+  e << 4, 1, 0.5, 0.2, 1, 5, 0.3, 0.1, 0.5, 0.3, 6, 0.7, 0.2, 0.1, 0.7, 3;
+  Eigen::VectorXd h(4);
+  h << 1, -2, 0.5, 3;
+  stan::test::expect_ad_matvar(f, e, h);
+
+  // exceptions: not symmetric, not pos def
+  Eigen::MatrixXd m22 = Eigen::MatrixXd::Zero(2, 2);
+  stan::test::expect_ad_matvar(f, c, d);
+  stan::test::expect_ad_matvar(f, m22, d);
+
+  stan::math::recover_memory();
+}
@@ -76,3 +76,38 @@ TEST(MathMixMatFun, mdivideLeft) {
   // exceptions: wrong types
   stan::test::expect_ad(f, m33, rv3);
 }
+
+TEST(MathMixMatFun, mdivideLeft_varmat) {
+  auto f = [](const auto& x, const auto& y) {
+    return stan::math::mdivide_left(x, y);
+  };
+
+  Eigen::MatrixXd m00(0, 0);
+  Eigen::VectorXd v0(0);
+  stan::test::expect_ad_matvar(f, m00, m00);
+  stan::test::expect_ad_matvar(f, m00, v0);
+
+  Eigen::MatrixXd a(2, 2);
+  a << 2, 3, 3, 7;
+  Eigen::MatrixXd c(2, 2);
+  c << 12, 13, 15, 17;
+  Eigen::MatrixXd d(2, 2);
+  d << 2, 3, 5, 7;
+  Eigen::VectorXd g(2);
+  g << 12, 13;
+  stan::test::expect_ad_matvar(f, a, c);
+  stan::test::expect_ad_matvar(f, d, c);
+  stan::test::expect_ad_matvar(f, c, g);
+
+  Eigen::MatrixXd v(5, 5);
+  v << 20, 8, -9, 7, 5, 8, 20, 0, 4, 4, -9, 0, 20, 2, 5, 7, 4, 2, 20, -5, 5, 4,
+      5, -5, 20;
+  Eigen::VectorXd u(5);
+  u << 62, 84, 84, 76, 108;
+  stan::test::expect_ad_matvar(f, v, u);
+
+  // exceptions: wrong sizes
+  Eigen::MatrixXd m33 = Eigen::MatrixXd::Zero(3, 3);
+  Eigen::VectorXd v4 = Eigen::VectorXd::Zero(4);
+  stan::test::expect_ad_matvar(f, m33, v4);
+}
@@ -6,3 +6,16 @@ TEST(mathMixMatFun, square) {
   stan::test::expect_unary_vectorized(f, -2.6, -1.0, -0.5, -0.2, 0.5, 1.3, 3, 5,
                                       1e5);
 }
+
+TEST(mathMixMatFun, square_varmat) {
+  auto f = [](const auto& x1) { return stan::math::square(x1); };
+  Eigen::MatrixXd A(2, 3);
+  A << -2.6, -0.5, -0.2, 0.5, 1.3, 5;
+  stan::test::expect_ad_matvar(f, A);
+  Eigen::VectorXd a = A.row(0).transpose();
+  stan::test::expect_ad_matvar(f, a);
+  Eigen::RowVectorXd b = A.row(1);
+  stan::test::expect_ad_matvar(f, b);
+  Eigen::MatrixXd A0(0, 0);
+  stan::test::expect_ad_matvar(f, A0);
+}
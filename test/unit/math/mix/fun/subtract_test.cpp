@@ -144,3 +144,37 @@ TEST(MathMixMatFun, subtract_throw) {
   m11 << 1;
   stan::test::expect_ad(f, m11, m22);
 }
+
+TEST(MathMixMatFun, subtract_varmat) {
+  auto f = [](const auto& x, const auto& y) {
+    return stan::math::subtract(x, y);
+  };
+  auto f_op = [](const auto& x, const auto& y) { return x - y; };
+  Eigen::MatrixXd m23(2, 3);
+  m23 << 1, 2, 3, 4, 5, 6;
+  Eigen::MatrixXd m23b(2, 3);
+  m23b << -3, 10, 0.5, 2, -1, 7;
+  Eigen::VectorXd v3 = m23.row(0).transpose();
+  Eigen::VectorXd v3b = m23b.row(1).transpose();
+  Eigen::RowVectorXd rv3 = m23.row(1);
+  Eigen::RowVectorXd rv3b = m23b.row(0);
+  Eigen::MatrixXd m00(0, 0);
+  stan::test::expect_ad_matvar(f, m23, m23b);
+  stan::test::expect_ad_matvar(f_op, m23, m23b);
+  stan::test::expect_ad_matvar(f, v3, v3b);
+  stan::test::expect_ad_matvar(f, rv3, rv3b);
+  stan::test::expect_ad_matvar(f, m00, m00);
+  stan::test::expect_ad_matvar(f, m23, v3);
+
+  auto f_scal = [](const auto& x) {
+    stan::math::var s = 2.5;
+    return stan::math::subtract(stan::math::subtract(x, 1.5), s);
+  };
+  auto f_scal_first = [](const auto& x) {
+    stan::math::var s = 2.5;
+    return stan::math::subtract(1.5, stan::math::subtract(s, x));
+  };
+  stan::test::expect_ad_matvar(f_scal, m23);
+  stan::test::expect_ad_matvar(f_scal, v3);
+  stan::test::expect_ad_matvar(f_scal_first, rv3);
+}
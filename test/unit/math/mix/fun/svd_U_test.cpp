@@ -0,0 +1,26 @@
+#include <test/unit/math/test_ad.hpp>
+
+TEST(MathMixMatFun, svd_U) {
+  auto f = [](const auto& x) { return stan::math::svd_U(x); };
+
+  stan::test::ad_tolerances tols;
+  tols.hessian_hessian_ = 1e-2;
+  tols.hessian_fvar_hessian_ = 1e-2;
+
+  Eigen::MatrixXd m00(0, 0);
+  EXPECT_THROW(f(m00), std::invalid_argument);
+
+  Eigen::MatrixXd m11(1, 1);
+  m11 << 1.1;
+  stan::test::expect_ad(tols, f, m11);
+
+  Eigen::MatrixXd m22(2, 2);
+  m22 << 3, -5, 7, 11;
+  stan::test::expect_ad(tols, f, m22);
+
+  Eigen::MatrixXd m23(2, 3);
+  m23 << 3, 5, -7, -11, 13, -17;
+  Eigen::MatrixXd m32 = m23.transpose();
+  stan::test::expect_ad(tols, f, m23);
+  stan::test::expect_ad(tols, f, m32);
+}
@@ -1,6 +1,7 @@
 #include <stan/math/mix.hpp>
 #include <gtest/gtest.h>
 #include <test/unit/math/rev/fun/util.hpp>
+#include <test/unit/util.hpp>
 #include <iostream>
 #include <stdexcept>
 #include <vector>
@@ -278,3 +279,39 @@ TEST(MixFunctor, GradientHessian) {
                         poly_grad_hess_agrad[i](j, k));
       }
 }
+
+// fun3: R^5 --> R^3 with cross terms between all arguments
+struct fun3 {
+  template <typename T>
+  inline Matrix<T, Dynamic, 1> operator()(
+      const Matrix<T, Dynamic, 1>& x) const {
+    using std::exp;
+    using std::log;
+    using std::sin;
+    Matrix<T, Dynamic, 1> z(3);
+    z << exp(x(0) * x(1)) + x(2) * x(3) * x(4),
+        log(x(1) + 2.0) * sin(x(4)) - x(0) / x(3), x(0) * x(1) * x(2) * x(3);
+    return z;
+  }
+};
+
+TEST(MixFunctor, jacobianVectorMode) {
+  fun3 f;
+  Matrix<double, Dynamic, 1> x(5);
+  x << 0.3, -0.7, 1.2, 2.1, 0.4;
+  Matrix<double, Dynamic, 1> fx;
+  Matrix<double, Dynamic, Dynamic> J;
+  stan::math::jacobian(f, x, fx, J);
+
+  Matrix<double, Dynamic, 1> fx2;
+  Matrix<double, Dynamic, Dynamic> J2;
+  stan::math::jacobian<2>(f, x, fx2, J2);
+  EXPECT_MATRIX_FLOAT_EQ(fx, fx2);
+  EXPECT_MATRIX_FLOAT_EQ(J, J2);
+
+  Matrix<double, Dynamic, 1> fx8;
+  Matrix<double, Dynamic, Dynamic> J8;
+  stan::math::jacobian<8>(f, x, fx8, J8);
+  EXPECT_MATRIX_FLOAT_EQ(fx, fx8);
+  EXPECT_MATRIX_FLOAT_EQ(J, J8);
+}
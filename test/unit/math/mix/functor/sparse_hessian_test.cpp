@@ -0,0 +1,121 @@
+#include <stan/math/mix.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using Eigen::Dynamic;
+using Eigen::Matrix;
+
+// hierarchical model: x(0) is a shared location, the remaining elements
+// are group effects centered on it
+struct hierarchical_lp {
+  template <typename T>
+  inline T operator()(const Matrix<T, Dynamic, 1>& x) const {
+    T lp = -0.5 * x(0) * x(0);
+    for (int i = 1; i < x.size(); ++i) {
+      lp += stan::math::normal_lpdf(x(i), x(0), 1.5) + x(i) * x(i) * x(i);
+    }
+    return lp;
+  }
+};
+
+// chain: neighbouring elements interact, as in a random walk prior
+struct chain_lp {
+  template <typename T>
+  inline T operator()(const Matrix<T, Dynamic, 1>& x) const {
+    T lp = 0;
+    for (int i = 1; i < x.size(); ++i) {
+      lp -= exp(x(i) - x(i - 1)) + x(i) * x(i - 1) * x(i - 1);
+    }
+    return lp;
+  }
+};
+
+template <typename F>
+void expect_sparse_hessian_matches(const F& f,
+                                   const Matrix<double, Dynamic, 1>& x) {
+  double fx;
+  Matrix<double, Dynamic, 1> grad;
+  Matrix<double, Dynamic, Dynamic> H;
+  stan::math::hessian(f, x, fx, grad, H);
+
+  double fx_sparse;
+  Matrix<double, Dynamic, 1> grad_sparse;
+  Eigen::SparseMatrix<double> H_sparse;
+  stan::math::sparse_hessian(f, x, fx_sparse, grad_sparse, H_sparse);
+  EXPECT_FLOAT_EQ(fx, fx_sparse);
+  EXPECT_MATRIX_NEAR(grad, grad_sparse, 1e-10);
+  EXPECT_MATRIX_NEAR(H, H_sparse.toDense(), 1e-10);
+}
+
+TEST(MixFunctor, sparseHessianHierarchical) {
+  Matrix<double, Dynamic, 1> x(8);
+  x << 0.3, -0.7, 1.2, 2.1, 0.4, -1.1, 0.8, 0.05;
+  expect_sparse_hessian_matches(hierarchical_lp(), x);
+
+  Eigen::SparseMatrix<double> pattern
+      = stan::math::hessian_sparsity_pattern(hierarchical_lp(), x);
+  EXPECT_EQ(8 + 2 * 7, pattern.nonZeros());
+  std::vector<int> color = stan::math::internal::star_coloring(
+      stan::math::internal::hessian_adjacency(pattern));
+  EXPECT_EQ(0, color[0]);
+  for (int i = 1; i < 8; ++i) {
+    EXPECT_EQ(1, color[i]);
+  }
+}
+
+TEST(MixFunctor, sparseHessianChain) {
+  Matrix<double, Dynamic, 1> x(10);
+  x << 0.3, -0.7, 1.2, 2.1, 0.4, -1.1, 0.8, 0.05, -0.3, 0.9;
+  expect_sparse_hessian_matches(chain_lp(), x);
+
+  Eigen::SparseMatrix<double> pattern
+      = stan::math::hessian_sparsity_pattern(chain_lp(), x);
+  std::vector<int> color = stan::math::internal::star_coloring(
+      stan::math::internal::hessian_adjacency(pattern));
+  EXPECT_EQ(2, *std::max_element(color.begin(), color.end()));
+
+  // the pattern is reusable at other arguments
+  Matrix<double, Dynamic, 1> y = x.array() + 0.25;
+  double fx;
+  Matrix<double, Dynamic, 1> grad;
+  Matrix<double, Dynamic, Dynamic> H;
+  stan::math::hessian(chain_lp(), y, fx, grad, H);
+  double fx_sparse;
+  Matrix<double, Dynamic, 1> grad_sparse;
+  Eigen::SparseMatrix<double> H_sparse;
+  stan::math::sparse_hessian(chain_lp(), y, pattern, fx_sparse, grad_sparse,
+                             H_sparse);
+  EXPECT_FLOAT_EQ(fx, fx_sparse);
+  EXPECT_MATRIX_NEAR(H, H_sparse.toDense(), 1e-10);
+}
+
+TEST(MixFunctor, sparseHessianDense) {
+  Matrix<double, Dynamic, 1> x(3);
+  x << 0.3, -0.7, 1.2;
+  Eigen::SparseMatrix<double> pattern
+      = Matrix<double, Dynamic, Dynamic>::Ones(3, 3).sparseView();
+  double fx;
+  Matrix<double, Dynamic, 1> grad;
+  Eigen::SparseMatrix<double> H_sparse;
+  stan::math::sparse_hessian(chain_lp(), x, pattern, fx, grad, H_sparse);
+  Matrix<double, Dynamic, Dynamic> H;
+  stan::math::hessian(chain_lp(), x, fx, grad, H);
+  EXPECT_MATRIX_NEAR(H, H_sparse.toDense(), 1e-10);
+}
+
+TEST(MixFunctor, sparseHessianErrors) {
+  Matrix<double, Dynamic, 1> x(3);
+  x << 0.3, -0.7, 1.2;
+  Eigen::SparseMatrix<double> pattern(2, 2);
+  double fx;
+  Matrix<double, Dynamic, 1> grad;
+  Eigen::SparseMatrix<double> H;
+  EXPECT_THROW(stan::math::sparse_hessian(chain_lp(), x, pattern, fx, grad, H),
+               std::invalid_argument);
+
+  Matrix<double, Dynamic, 1> x0(0);
+  stan::math::sparse_hessian(chain_lp(), x0, fx, grad, H);
+  EXPECT_FLOAT_EQ(0, fx);
+  EXPECT_EQ(0, H.rows());
+}
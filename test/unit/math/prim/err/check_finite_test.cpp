@@ -197,3 +197,18 @@ TEST(ErrorHandlingScalar, CheckFinite_nan) {
 
   EXPECT_THROW(check_finite(function, "x", nan), std::domain_error);
 }
+
+TEST(ErrorHandlingMatrix, CheckFinite_SparseMatrix) {
+  using stan::math::check_finite;
+  const char* function = "check_finite";
+  Eigen::SparseMatrix<double> x(3, 4);
+  x.insert(0, 1) = 1.5;
+  x.insert(2, 3) = -2;
+  EXPECT_NO_THROW(check_finite(function, "x", x));
+
+  x.coeffRef(2, 3) = std::numeric_limits<double>::infinity();
+  EXPECT_THROW(check_finite(function, "x", x), std::domain_error);
+
+  x.coeffRef(2, 3) = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_THROW(check_finite(function, "x", x), std::domain_error);
+}
@@ -0,0 +1,75 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+std::vector<Eigen::MatrixXd> batched_test_spd(int K, int n) {
+  std::vector<Eigen::MatrixXd> As;
+  for (int k = 0; k < K; ++k) {
+    Eigen::MatrixXd X = Eigen::MatrixXd::Random(n, n);
+    As.push_back(X * X.transpose() + n * Eigen::MatrixXd::Identity(n, n));
+  }
+  return As;
+}
+}  // namespace
+
+TEST(MathMatrixPrim, cholesky_decompose_batch) {
+  std::vector<Eigen::MatrixXd> As = batched_test_spd(7, 5);
+  std::vector<Eigen::MatrixXd> Ls = stan::math::cholesky_decompose(As);
+  ASSERT_EQ(7, Ls.size());
+  for (int k = 0; k < 7; ++k) {
+    EXPECT_MATRIX_NEAR(stan::math::cholesky_decompose(As[k]), Ls[k], 1e-12);
+  }
+
+  std::vector<Eigen::Matrix3d> fixed(3, Eigen::Matrix3d::Identity() * 4);
+  std::vector<Eigen::Matrix3d> fixed_L = stan::math::cholesky_decompose(fixed);
+  EXPECT_MATRIX_NEAR(Eigen::Matrix3d::Identity() * 2, fixed_L[2], 1e-12);
+
+  EXPECT_EQ(0, stan::math::cholesky_decompose(std::vector<Eigen::MatrixXd>())
+                   .size());
+  As[3](1, 1) = -1;
+  EXPECT_THROW(stan::math::cholesky_decompose(As), std::domain_error);
+  As[3](1, 1) = 1;
+  As[3](1, 2) = 5;
+  EXPECT_THROW(stan::math::cholesky_decompose(As), std::domain_error);
+  As.push_back(Eigen::MatrixXd::Identity(4, 4));
+  EXPECT_THROW(stan::math::cholesky_decompose(As), std::invalid_argument);
+}
+
+TEST(MathMatrixPrim, multiply_batch) {
+  std::vector<Eigen::MatrixXd> As;
+  std::vector<Eigen::MatrixXd> Bs;
+  for (int k = 0; k < 6; ++k) {
+    As.push_back(Eigen::MatrixXd::Random(3, 4));
+    Bs.push_back(Eigen::MatrixXd::Random(4, 2));
+  }
+  std::vector<Eigen::MatrixXd> Cs = stan::math::multiply(As, Bs);
+  ASSERT_EQ(6, Cs.size());
+  for (int k = 0; k < 6; ++k) {
+    EXPECT_MATRIX_NEAR(As[k] * Bs[k], Cs[k], 1e-12);
+  }
+  Bs.pop_back();
+  EXPECT_THROW(stan::math::multiply(As, Bs), std::invalid_argument);
+  Bs.push_back(Eigen::MatrixXd::Random(3, 2));
+  EXPECT_THROW(stan::math::multiply(As, Bs), std::invalid_argument);
+}
+
+TEST(MathMatrixPrim, mdivide_left_tri_low_batch) {
+  std::vector<Eigen::MatrixXd> Ls = batched_test_spd(5, 4);
+  std::vector<Eigen::VectorXd> bs;
+  for (auto& L : Ls) {
+    L.triangularView<Eigen::StrictlyUpper>().setZero();
+    bs.push_back(Eigen::VectorXd::Random(4));
+  }
+  std::vector<Eigen::VectorXd> xs = stan::math::mdivide_left_tri_low(Ls, bs);
+  ASSERT_EQ(5, xs.size());
+  for (int k = 0; k < 5; ++k) {
+    EXPECT_MATRIX_NEAR(stan::math::mdivide_left_tri_low(Ls[k], bs[k]), xs[k],
+                       1e-12);
+  }
+  Ls.push_back(Eigen::MatrixXd::Identity(3, 3));
+  bs.push_back(Eigen::VectorXd::Random(3));
+  EXPECT_THROW(stan::math::mdivide_left_tri_low(Ls, bs),
+               std::invalid_argument);
+}
@@ -35,3 +35,24 @@ TEST(MathMatrixPrimMat, cholesky_decompose_exception) {
   EXPECT_THROW_MSG(stan::math::cholesky_decompose(m), std::domain_error,
                    "is not symmetric");
 }
+
+TEST(MathMatrixPrimMat, cholesky_decompose_parallel_blocked) {
+  using stan::math::matrix_d;
+  const int N = 100;
+  matrix_d X = matrix_d::Random(N, N);
+  matrix_d A = X * X.transpose() + N * matrix_d::Identity(N, N);
+  matrix_d L_serial = stan::math::cholesky_decompose(A);
+
+  stan::math::cholesky_tuning opts;
+  opts.parallel_size = 16;
+  opts.grain_size = 8;
+  opts.block_size = 11;
+  matrix_d L_parallel = stan::math::cholesky_decompose(A, opts);
+  EXPECT_MATRIX_NEAR(L_serial, L_parallel, 1e-10);
+  EXPECT_MATRIX_NEAR(A, L_parallel * L_parallel.transpose(), 1e-8);
+
+  matrix_d m(20, 20);
+  m.setOnes();
+  EXPECT_THROW_MSG(stan::math::cholesky_decompose(m, opts), std::domain_error,
+                   "Matrix m is not positive definite");
+}
@@ -0,0 +1,31 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <limits>
+
+TEST(MathFunctions, gamma_q_dd) {
+  using stan::math::digamma;
+  using stan::math::gamma_q;
+  using stan::math::gamma_q_dd;
+  using stan::math::grad_reg_inc_gamma;
+  using stan::math::tgamma;
+
+  // series and asymptotic regimes of grad_reg_inc_gamma
+  for (double a : {0.5, 1.1, 2.5, 7.0, 30.0}) {
+    for (double z : {0.2, 1.3, 5.0, 9.0, 40.0}) {
+      double g = tgamma(a);
+      double dig = digamma(a);
+      double d_a = 0;
+      double q = gamma_q_dd(a, z, g, dig, d_a);
+      EXPECT_FLOAT_EQ(gamma_q(a, z), q) << "a = " << a << ", z = " << z;
+      EXPECT_FLOAT_EQ(grad_reg_inc_gamma(a, z, g, dig), d_a)
+          << "a = " << a << ", z = " << z;
+    }
+  }
+}
+
+TEST(MathFunctions, gamma_q_dd_nan) {
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  double d_a = 0;
+  EXPECT_TRUE(std::isnan(stan::math::gamma_q_dd(nan, 1.0, 1.0, 1.0, d_a)));
+  EXPECT_TRUE(std::isnan(d_a));
+}
@@ -0,0 +1,88 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+TEST(MathMatrixPrimMat, glm_design_matrix_split) {
+  Eigen::MatrixXd x(5, 4);
+  x << 1, 0, 2, 0,  //
+      2, 0, 3, 0,   //
+      3, 1, 4, 0,   //
+      4, 0, 5, 0,   //
+      5, 0, 6, 1;
+  stan::math::glm_design_matrix x_prep(x, 0.2);
+  EXPECT_EQ(5, x_prep.rows());
+  EXPECT_EQ(4, x_prep.cols());
+  std::vector<Eigen::Index> dense_cols{0, 2};
+  std::vector<Eigen::Index> sparse_cols{1, 3};
+  EXPECT_EQ(dense_cols, x_prep.dense_cols());
+  EXPECT_EQ(sparse_cols, x_prep.sparse_cols());
+  EXPECT_EQ(2, x_prep.sparse().nonZeros());
+  EXPECT_MATRIX_EQ(x, x_prep.to_dense());
+
+  stan::math::glm_design_matrix x_dense(x, 0.0);
+  EXPECT_EQ(4, x_dense.dense_cols().size());
+  EXPECT_EQ(0, x_dense.sparse_cols().size());
+  EXPECT_MATRIX_EQ(x, x_dense.to_dense());
+
+  stan::math::glm_design_matrix x_sparse(x, 1.0);
+  EXPECT_EQ(0, x_sparse.dense_cols().size());
+  EXPECT_EQ(4, x_sparse.sparse_cols().size());
+  EXPECT_MATRIX_EQ(x, x_sparse.to_dense());
+}
+
+TEST(MathMatrixPrimMat, glm_design_matrix_products) {
+  Eigen::MatrixXd x = Eigen::MatrixXd::Random(20, 6);
+  x.col(1).setZero();
+  x(3, 1) = 1;
+  x.col(4).setZero();
+  x(7, 4) = -2;
+  x(12, 4) = 1;
+  Eigen::VectorXd beta = Eigen::VectorXd::Random(6);
+  Eigen::VectorXd d = Eigen::VectorXd::Random(20);
+  for (double density : {0.0, 0.1, 0.5, 1.0}) {
+    stan::math::glm_design_matrix x_prep(x, density);
+    EXPECT_MATRIX_NEAR(x * beta, x_prep * beta, 1e-12);
+    EXPECT_MATRIX_NEAR(x.transpose() * d, x_prep.transpose() * d, 1e-12);
+    EXPECT_MATRIX_NEAR(d.transpose() * x, d.transpose() * x_prep, 1e-12);
+    EXPECT_MATRIX_NEAR(2.5 * x, (2.5 * x_prep).to_dense(), 1e-12);
+  }
+}
+
+TEST(MathMatrixPrimMat, glm_design_matrix_errors) {
+  Eigen::MatrixXd x = Eigen::MatrixXd::Random(3, 2);
+  EXPECT_THROW(stan::math::glm_design_matrix(x, -0.1), std::domain_error);
+  EXPECT_THROW(stan::math::glm_design_matrix(x, 1.1), std::domain_error);
+  stan::math::glm_design_matrix x_prep(x);
+  Eigen::VectorXd beta(3);
+  EXPECT_THROW(x_prep * beta, std::invalid_argument);
+  EXPECT_THROW(x_prep.transpose() * beta.head(2), std::invalid_argument);
+}
+
+TEST(MathMatrixPrimMat, glm_design_matrix_glm_doubles) {
+  Eigen::MatrixXd x(4, 3);
+  x << 1, 0, -0.5,  //
+      2, 1, 0.3,    //
+      -1, 0, 0.2,   //
+      0.5, 0, 1.5;
+  stan::math::glm_design_matrix x_prep(x, 0.3);
+  Eigen::VectorXd beta(3);
+  beta << 0.3, -1.2, 0.7;
+  double alpha = 0.4;
+  std::vector<int> y_count{1, 0, 3, 2};
+  std::vector<int> y_binary{1, 0, 1, 1};
+  Eigen::VectorXd y_real(4);
+  y_real << 0.5, -0.2, 1.1, 2.0;
+
+  EXPECT_FLOAT_EQ(stan::math::poisson_log_glm_lpmf(y_count, x, alpha, beta),
+                  stan::math::poisson_log_glm_lpmf(y_count, x_prep, alpha, beta));
+  EXPECT_FLOAT_EQ(
+      stan::math::bernoulli_logit_glm_lpmf(y_binary, x, alpha, beta),
+      stan::math::bernoulli_logit_glm_lpmf(y_binary, x_prep, alpha, beta));
+  EXPECT_FLOAT_EQ(
+      stan::math::neg_binomial_2_log_glm_lpmf(y_count, x, alpha, beta, 2.0),
+      stan::math::neg_binomial_2_log_glm_lpmf(y_count, x_prep, alpha, beta,
+                                              2.0));
+  EXPECT_FLOAT_EQ(
+      stan::math::normal_id_glm_lpdf(y_real, x, alpha, beta, 1.3),
+      stan::math::normal_id_glm_lpdf(y_real, x_prep, alpha, beta, 1.3));
+}
@@ -0,0 +1,127 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+std::vector<double> gp_operator_test_inputs(int N) {
+  std::vector<double> x(N);
+  for (int i = 0; i < N; ++i) {
+    x[i] = 0.37 * i - 0.05 * (i % 3);
+  }
+  return x;
+}
+}  // namespace
+
+TEST(MathPrimMat, gp_cov_operator_matches_dense) {
+  using stan::math::add_diag;
+  std::vector<double> x = gp_operator_test_inputs(12);
+  std::vector<Eigen::VectorXd> x_vec(12, Eigen::VectorXd(2));
+  for (int i = 0; i < 12; ++i) {
+    x_vec[i] << x[i], 0.5 * x[(i * 5) % 12];
+  }
+
+  EXPECT_MATRIX_NEAR(stan::math::gp_exp_quad_cov(x, 1.3, 0.7),
+                     stan::math::gp_exp_quad_cov_operator(x, 1.3, 0.7)
+                         .to_dense(),
+                     1e-12);
+  EXPECT_MATRIX_NEAR(stan::math::gp_exp_quad_cov(x_vec, 1.3, 0.7),
+                     stan::math::gp_exp_quad_cov_operator(x_vec, 1.3, 0.7)
+                         .to_dense(),
+                     1e-12);
+  EXPECT_MATRIX_NEAR(stan::math::gp_matern32_cov(x, 0.8, 1.1),
+                     stan::math::gp_matern32_cov_operator(x, 0.8, 1.1)
+                         .to_dense(),
+                     1e-12);
+  EXPECT_MATRIX_NEAR(stan::math::gp_matern52_cov(x_vec, 0.8, 1.1),
+                     stan::math::gp_matern52_cov_operator(x_vec, 0.8, 1.1)
+                         .to_dense(),
+                     1e-12);
+  EXPECT_MATRIX_NEAR(stan::math::gp_periodic_cov(x, 1.2, 0.9, 2.5),
+                     stan::math::gp_periodic_cov_operator(x, 1.2, 0.9, 2.5)
+                         .to_dense(),
+                     1e-12);
+  EXPECT_MATRIX_NEAR(stan::math::gp_dot_prod_cov(x_vec, 0.4),
+                     stan::math::gp_dot_prod_cov_operator(x_vec, 0.4)
+                         .to_dense(),
+                     1e-12);
+
+  auto K = add_diag(stan::math::gp_matern32_cov_operator(x, 0.8, 1.1), 0.3);
+  Eigen::MatrixXd K_dense
+      = add_diag(stan::math::gp_matern32_cov(x, 0.8, 1.1), 0.3);
+  Eigen::MatrixXd V = Eigen::MatrixXd::Random(12, 3);
+  Eigen::VectorXd v = V.col(0);
+  EXPECT_MATRIX_NEAR(K_dense, K.to_dense(), 1e-12);
+  EXPECT_MATRIX_NEAR(K_dense * V, K.multiply(V), 1e-12);
+  EXPECT_MATRIX_NEAR(K_dense * v, K.multiply(v), 1e-12);
+  Eigen::VectorXd K_diag = K_dense.diagonal();
+  EXPECT_MATRIX_NEAR(K_diag, K.diagonal(), 1e-12);
+}
+
+TEST(MathPrimMat, gp_cov_operator_log_determinant) {
+  std::vector<double> x = gp_operator_test_inputs(20);
+  // without correlations the estimate is exact for any probe
+  auto K_diag = stan::math::add_diag(
+      stan::math::gp_exp_quad_cov_operator(x, 1.5, 1e-3), 0.1);
+  K_diag.options().num_probes = 1;
+  EXPECT_NEAR(20 * std::log(2.35), K_diag.log_determinant(), 1e-10);
+
+  auto K = stan::math::add_diag(
+      stan::math::gp_exp_quad_cov_operator(x, 1.0, 0.3), 1.0);
+  K.options().num_probes = 400;
+  Eigen::MatrixXd K_dense = K.to_dense();
+  double log_det = stan::math::log_determinant(K_dense);
+  EXPECT_NEAR(log_det, K.log_determinant(), 0.03 * std::fabs(log_det));
+  EXPECT_FLOAT_EQ(K.log_determinant(), K.log_determinant());
+
+  // the Lanczos quadrature is exact for the Hutchinson estimate once the
+  // number of steps reaches the size of the matrix
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(K_dense);
+  Eigen::MatrixXd log_K = solver.eigenvectors()
+                          * solver.eigenvalues().array().log().matrix()
+                                .asDiagonal()
+                          * solver.eigenvectors().transpose();
+  Eigen::MatrixXd Z = stan::math::internal::rademacher_probes(20, 10, 3);
+  EXPECT_NEAR((Z.transpose() * log_K * Z).diagonal().mean(),
+              stan::math::internal::stochastic_lanczos_log_determinant(K, Z,
+                                                                       20),
+              1e-8);
+}
+
+TEST(MathPrimMat, gp_cov_operator_multi_normal_lpdf) {
+  std::vector<double> x = gp_operator_test_inputs(20);
+  auto K = stan::math::add_diag(
+      stan::math::gp_matern52_cov_operator(x, 1.0, 0.3), 1.0);
+  K.options().num_probes = 400;
+  Eigen::MatrixXd K_dense = K.to_dense();
+  Eigen::VectorXd y = Eigen::VectorXd::Random(20);
+  Eigen::VectorXd mu = Eigen::VectorXd::Constant(20, 0.1);
+
+  double lp_dense = stan::math::multi_normal_lpdf(y, mu, K_dense);
+  EXPECT_NEAR(lp_dense, stan::math::multi_normal_lpdf(y, mu, K),
+              0.02 * std::fabs(lp_dense));
+  EXPECT_FLOAT_EQ(0.0, stan::math::multi_normal_lpdf<true>(y, mu, K));
+}
+
+TEST(MathPrimMat, gp_cov_operator_errors) {
+  std::vector<double> x = gp_operator_test_inputs(10);
+  EXPECT_THROW(stan::math::gp_exp_quad_cov_operator(x, -1.0, 0.5),
+               std::domain_error);
+  EXPECT_THROW(stan::math::gp_periodic_cov_operator(x, 1.0, 0.5, 0.0),
+               std::domain_error);
+  EXPECT_THROW(stan::math::gp_dot_prod_cov_operator(x, -0.1),
+               std::domain_error);
+  auto K = stan::math::gp_exp_quad_cov_operator(x, 1.0, 0.5);
+  EXPECT_THROW(stan::math::add_diag(K, -1.0), std::domain_error);
+  EXPECT_THROW(K.multiply(Eigen::VectorXd::Ones(3)), std::invalid_argument);
+
+  Eigen::VectorXd y = Eigen::VectorXd::Ones(10);
+  Eigen::VectorXd mu = Eigen::VectorXd::Zero(10);
+  auto K_noise = stan::math::add_diag(K, 0.01);
+  K_noise.options().cg_max_iterations = 1;
+  EXPECT_THROW(stan::math::multi_normal_lpdf(y, mu, K_noise),
+               std::domain_error);
+  EXPECT_THROW(stan::math::multi_normal_lpdf(Eigen::VectorXd::Ones(3), mu,
+                                             K_noise),
+               std::invalid_argument);
+}
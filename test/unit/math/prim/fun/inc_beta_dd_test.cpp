@@ -0,0 +1,47 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+TEST(MathFunctions, inc_beta_dd) {
+  using stan::math::digamma;
+  using stan::math::inc_beta;
+  using stan::math::inc_beta_dd;
+  using stan::math::inc_beta_dda;
+  using stan::math::inc_beta_ddb;
+
+  // covers the direct series and the regions evaluated through I_{1-z}(b, a)
+  std::vector<std::pair<double, double>> ab{
+      {1.5, 1.25}, {1.5, 12500.0}, {15000.0, 1.25}};
+  for (const auto& a_b : ab) {
+    double a = a_b.first;
+    double b = a_b.second;
+    for (double z : {0.001, 0.05, 0.6, 0.95, 0.999}) {
+      double digamma_a = digamma(a);
+      double digamma_b = digamma(b);
+      double digamma_ab = digamma(a + b);
+      double d_a = 0;
+      double d_b = 0;
+      double I
+          = inc_beta_dd(a, b, z, digamma_a, digamma_b, digamma_ab, d_a, d_b);
+      EXPECT_FLOAT_EQ(inc_beta(a, b, z), I)
+          << "a = " << a << ", b = " << b << ", z = " << z;
+      EXPECT_NEAR(inc_beta_dda(a, b, z, digamma_a, digamma_ab), d_a, 1e-10)
+          << "a = " << a << ", b = " << b << ", z = " << z;
+      EXPECT_NEAR(inc_beta_ddb(a, b, z, digamma_b, digamma_ab), d_b, 1e-10)
+          << "a = " << a << ", b = " << b << ", z = " << z;
+    }
+  }
+}
+
+TEST(MathFunctions, inc_beta_dd_throw) {
+  using stan::math::digamma;
+  double a = 15000;
+  double b = 12500;
+  double z = 0.95;
+  double d_a = 0;
+  double d_b = 0;
+  EXPECT_THROW(stan::math::inc_beta_dd(a, b, z, digamma(a), digamma(b),
+                                       digamma(a + b), d_a, d_b),
+               std::domain_error);
+}
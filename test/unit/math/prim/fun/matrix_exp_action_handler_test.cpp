@@ -122,3 +122,33 @@ TEST(MathMatrixRevMat, matrix_exp_action_matrix_transpose) {
     }
   }
 }
+
+TEST(MathMatrixRevMat, matrix_exp_action_scaling_steps) {
+  using Eigen::MatrixXd;
+  stan::math::matrix_exp_action_handler handler;
+  std::srand(1999);
+
+  // a long time needs more than one scaling step
+  MatrixXd A = MatrixXd::Random(6, 6);
+  MatrixXd B = MatrixXd::Random(6, 3);
+  const double t = 10.0;
+  MatrixXd res = handler.action(A, B, t);
+  MatrixXd expb = stan::math::matrix_exp(t * A) * B;
+
+  for (int i = 0; i < expb.rows(); ++i) {
+    for (int j = 0; j < expb.cols(); ++j) {
+      EXPECT_NEAR(res(i, j), expb(i, j), 1.e-10 * expb.norm());
+    }
+  }
+
+  std::vector<double> ts{2.0, 0.5, 10.0, 0.5};
+  std::vector<MatrixXd> res_ts = handler.action(A, B, ts);
+  for (size_t k = 0; k < ts.size(); ++k) {
+    MatrixXd expb_t = stan::math::matrix_exp(ts[k] * A) * B;
+    for (int i = 0; i < expb.rows(); ++i) {
+      for (int j = 0; j < expb.cols(); ++j) {
+        EXPECT_NEAR(res_ts[k](i, j), expb_t(i, j), 1.e-10 * expb_t.norm());
+      }
+    }
+  }
+}
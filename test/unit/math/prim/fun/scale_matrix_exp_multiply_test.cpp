@@ -76,3 +76,43 @@ TEST(MathMatrixPrimMat, scale_matrix_exp_multiply_exception) {
     EXPECT_THROW(scale_matrix_exp_multiply(t, A, B), std::invalid_argument);
   }
 }
+
+TEST(MathMatrixPrimMat, scale_matrix_exp_multiply_times) {
+  using stan::math::scale_matrix_exp_multiply;
+  std::srand(1999);
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(6, 6);
+  Eigen::MatrixXd B = Eigen::MatrixXd::Random(6, 3);
+  std::vector<double> ts{0.7, 0.0, 2.5, 0.7, 1.3, 10.0, 0.1};
+
+  std::vector<Eigen::MatrixXd> res = scale_matrix_exp_multiply(ts, A, B);
+  ASSERT_EQ(ts.size(), res.size());
+  for (size_t i = 0; i < ts.size(); ++i) {
+    Eigen::MatrixXd expected = scale_matrix_exp_multiply(ts[i], A, B);
+    EXPECT_MATRIX_NEAR(expected, res[i],
+                       1e-10 * std::max(1.0, expected.norm()));
+  }
+
+  Eigen::VectorXd b = B.col(0);
+  std::vector<Eigen::VectorXd> res_vec = scale_matrix_exp_multiply(ts, A, b);
+  for (size_t i = 0; i < ts.size(); ++i) {
+    EXPECT_MATRIX_NEAR(res[i].col(0), res_vec[i],
+                       1e-10 * std::max(1.0, res[i].norm()));
+  }
+
+  EXPECT_EQ(0, scale_matrix_exp_multiply(std::vector<double>{}, A, B).size());
+}
+
+TEST(MathMatrixPrimMat, scale_matrix_exp_multiply_times_exception) {
+  using stan::math::scale_matrix_exp_multiply;
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(2, 2);
+  Eigen::MatrixXd B = Eigen::MatrixXd::Random(2, 2);
+  std::vector<double> ts{1.0, -0.5};
+  EXPECT_THROW(scale_matrix_exp_multiply(ts, A, B), std::domain_error);
+  ts[1] = stan::math::INFTY;
+  EXPECT_THROW(scale_matrix_exp_multiply(ts, A, B), std::domain_error);
+  ts[1] = stan::math::NOT_A_NUMBER;
+  EXPECT_THROW(scale_matrix_exp_multiply(ts, A, B), std::domain_error);
+  ts[1] = 1.0;
+  Eigen::MatrixXd C = Eigen::MatrixXd::Random(3, 2);
+  EXPECT_THROW(scale_matrix_exp_multiply(ts, A, C), std::invalid_argument);
+}
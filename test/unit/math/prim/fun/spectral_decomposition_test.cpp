@@ -0,0 +1,71 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+// runs the divide and conquer decompositions and the parallel products on
+// small matrices
+stan::math::spectral_tuning small_divide_conquer() {
+  stan::math::spectral_tuning opts;
+  opts.divide_conquer_size = 2;
+  opts.grain_size = 3;
+  return opts;
+}
+}  // namespace
+
+TEST(MathMatrixPrimMat, eigendecompose_sym_divide_conquer) {
+  using Eigen::MatrixXd;
+  using Eigen::VectorXd;
+  std::srand(1999);
+  MatrixXd X = MatrixXd::Random(40, 40);
+  MatrixXd m = X + X.transpose();
+  Eigen::SelfAdjointEigenSolver<MatrixXd> solver(m);
+
+  const stan::math::spectral_tuning opts = small_divide_conquer();
+  VectorXd eigenvalues;
+  MatrixXd eigenvectors;
+  stan::math::internal::eigendecompose_sym(m, eigenvalues, eigenvectors, opts);
+  EXPECT_MATRIX_NEAR(solver.eigenvalues(), eigenvalues, 1e-10);
+  EXPECT_MATRIX_NEAR(MatrixXd::Identity(40, 40),
+                     eigenvectors.transpose() * eigenvectors, 1e-10);
+  EXPECT_MATRIX_NEAR(
+      m, eigenvectors * eigenvalues.asDiagonal() * eigenvectors.transpose(),
+      1e-10);
+
+  // the shift is not needed for the zero matrix
+  stan::math::internal::eigendecompose_sym(MatrixXd::Zero(3, 3), eigenvalues,
+                                           eigenvectors, opts);
+  EXPECT_MATRIX_NEAR(VectorXd::Zero(3), eigenvalues, 1e-16);
+}
+
+TEST(MathMatrixPrimMat, singular_value_decompose_divide_conquer) {
+  using Eigen::MatrixXd;
+  using Eigen::VectorXd;
+  std::srand(1999);
+  MatrixXd m = MatrixXd::Random(30, 45);
+
+  const stan::math::spectral_tuning opts = small_divide_conquer();
+  VectorXd D;
+  MatrixXd U;
+  MatrixXd V;
+  stan::math::internal::singular_value_decompose(m, D, U, V, opts);
+  EXPECT_EQ(30, D.size());
+  EXPECT_MATRIX_NEAR(stan::math::singular_values(m), D, 1e-10);
+  EXPECT_MATRIX_NEAR(m, U * D.asDiagonal() * V.transpose(), 1e-10);
+}
+
+TEST(MathMatrixPrimMat, spectral_multiply_parallel) {
+  using Eigen::MatrixXd;
+  std::srand(1999);
+  MatrixXd A = MatrixXd::Random(20, 15);
+  MatrixXd B = MatrixXd::Random(15, 31);
+
+  const stan::math::spectral_tuning opts = small_divide_conquer();
+  MatrixXd AB = A * B;
+  EXPECT_MATRIX_NEAR(AB, stan::math::internal::spectral_multiply(A, B, opts),
+                     1e-12);
+  EXPECT_MATRIX_NEAR(AB.transpose(),
+                     stan::math::internal::spectral_multiply(
+                         B.transpose(), A.transpose(), opts),
+                     1e-12);
+}
@@ -0,0 +1,25 @@
+#include <stan/math/prim.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+TEST(MathMatrixPrimMat, svd_V) {
+  using stan::math::svd_V;
+
+  stan::math::matrix_d m00(0, 0);
+  EXPECT_THROW(svd_V(m00), std::invalid_argument);
+
+  stan::math::matrix_d m11(1, 1);
+  m11 << 5.0;
+  EXPECT_FLOAT_EQ(1.0, std::fabs(svd_V(m11)(0, 0)));
+
+  stan::math::matrix_d m23(2, 3);
+  m23 << 3, 5, -7, -11, 13, -17;
+  stan::math::matrix_d m32 = m23.transpose();
+  for (const auto& m : {m23, m32}) {
+    stan::math::matrix_d U = stan::math::svd_U(m);
+    stan::math::matrix_d V = stan::math::svd_V(m);
+    stan::math::vector_d D = stan::math::singular_values(m);
+    EXPECT_EQ(2, svd_V(m).cols());
+    EXPECT_MATRIX_NEAR(m, U * D.asDiagonal() * V.transpose(), 1e-10);
+  }
+}
@@ -74,3 +74,16 @@ TEST(ProbDistributionsExponential, chiSquareGoodnessFitTest) {
   // Assert that they match
   assert_matches_quantiles(samples, quantiles, 1e-6);
 }
+
+TEST(ProbDistributionsExponential, vectorized_matches_boost_stream) {
+  boost::random::mt19937 rng;
+  boost::random::mt19937 rng_boost;
+  Eigen::VectorXd beta = Eigen::VectorXd::LinSpaced(100, 0.1, 20.0);
+  std::vector<double> draws = stan::math::exponential_rng(beta, rng);
+  for (int n = 0; n < 100; ++n) {
+    boost::variate_generator<boost::random::mt19937&,
+                             boost::exponential_distribution<> >
+        exp_rng(rng_boost, boost::exponential_distribution<>(beta(n)));
+    EXPECT_FLOAT_EQ(exp_rng(), draws[n]);
+  }
+}
@@ -80,3 +80,27 @@ TEST(ProbDistributionGamma, chiSquareGoodnessFitTest) {
   // Assert that they match
   assert_matches_quantiles(samples, quantiles, 1e-6);
 }
+
+TEST(ProbDistributionGamma, vectorized_matches_boost_stream) {
+  boost::random::mt19937 rng;
+  boost::random::mt19937 rng_boost;
+  Eigen::VectorXd beta = Eigen::VectorXd::LinSpaced(100, 0.1, 20.0);
+  for (double alpha : {0.5, 1.0, 3.5}) {
+    std::vector<double> draws = stan::math::gamma_rng(alpha, beta, rng);
+    for (int n = 0; n < 100; ++n) {
+      boost::variate_generator<boost::random::mt19937&,
+                               boost::gamma_distribution<> >
+          gamma_rng(rng_boost, boost::gamma_distribution<>(alpha, 1 / beta(n)));
+      EXPECT_FLOAT_EQ(gamma_rng(), draws[n]);
+    }
+  }
+
+  Eigen::VectorXd alpha = Eigen::VectorXd::LinSpaced(100, 0.2, 10.0);
+  std::vector<double> draws = stan::math::gamma_rng(alpha, 2.0, rng);
+  for (int n = 0; n < 100; ++n) {
+    boost::variate_generator<boost::random::mt19937&,
+                             boost::gamma_distribution<> >
+        gamma_rng(rng_boost, boost::gamma_distribution<>(alpha(n), 0.5));
+    EXPECT_FLOAT_EQ(gamma_rng(), draws[n]);
+  }
+}
@@ -80,3 +80,18 @@ TEST(ProbDistributionsLogNormalPrim, chiSquareGoodnessFitTest) {
   // Assert that they match
   assert_matches_quantiles(samples, quantiles, 1e-6);
 }
+
+TEST(ProbDistributionsLogNormalPrim, vectorized_matches_boost_stream) {
+  boost::random::mt19937 rng;
+  boost::random::mt19937 rng_boost;
+  Eigen::VectorXd mu = Eigen::VectorXd::LinSpaced(100, -3.0, 4.0);
+  double sigma = 0.7;
+  std::vector<double> draws = stan::math::lognormal_rng(mu, sigma, rng);
+  for (int n = 0; n < 100; ++n) {
+    boost::variate_generator<boost::random::mt19937&,
+                             boost::random::lognormal_distribution<> >
+        lognorm_rng(rng_boost,
+                    boost::random::lognormal_distribution<>(mu(n), sigma));
+    EXPECT_FLOAT_EQ(lognorm_rng(), draws[n]);
+  }
+}
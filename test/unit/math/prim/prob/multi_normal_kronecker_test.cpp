@@ -0,0 +1,55 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(ProbDistributionsMultiNormalKronecker, matches_dense) {
+  std::vector<double> x1{0.0, 0.4, 0.8, 1.2, 1.6};
+  std::vector<double> x2{0.0, 1.0, 2.0, 3.0};
+  std::vector<Eigen::MatrixXd> Ks{stan::math::gp_exp_quad_cov(x1, 1.2, 0.7),
+                                  stan::math::gp_matern52_cov(x2, 1.0, 1.5)};
+  Eigen::MatrixXd K(20, 20);
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      K.block(4 * i, 4 * j, 4, 4) = Ks[0](i, j) * Ks[1];
+    }
+  }
+  Eigen::VectorXd y = Eigen::VectorXd::Random(20);
+  Eigen::VectorXd mu = Eigen::VectorXd::Random(20);
+  EXPECT_NEAR(
+      stan::math::multi_normal_lpdf(y, mu, stan::math::add_diag(K, 0.1)),
+      stan::math::multi_normal_kronecker_lpdf(y, mu, Ks, 0.1), 1e-8);
+  EXPECT_FLOAT_EQ(
+      0.0, stan::math::multi_normal_kronecker_lpdf<true>(y, mu, Ks, 0.1));
+
+  Ks[0] = stan::math::add_diag(Ks[0], 0.2);
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      K.block(4 * i, 4 * j, 4, 4) = Ks[0](i, j) * Ks[1];
+    }
+  }
+  EXPECT_NEAR(stan::math::multi_normal_lpdf(y, mu, K),
+              stan::math::multi_normal_kronecker_lpdf(y, mu, Ks), 1e-8);
+}
+
+TEST(ProbDistributionsMultiNormalKronecker, errors) {
+  Eigen::VectorXd y = Eigen::VectorXd::Zero(6);
+  Eigen::VectorXd mu = Eigen::VectorXd::Zero(6);
+  std::vector<Eigen::MatrixXd> Ks{Eigen::MatrixXd::Identity(2, 2),
+                                  Eigen::MatrixXd::Identity(3, 3)};
+  EXPECT_NO_THROW(stan::math::multi_normal_kronecker_lpdf(y, mu, Ks));
+  EXPECT_THROW(stan::math::multi_normal_kronecker_lpdf(y, mu, Ks, -1.0),
+               std::domain_error);
+  std::vector<Eigen::MatrixXd> empty;
+  EXPECT_THROW(stan::math::multi_normal_kronecker_lpdf(y, mu, empty),
+               std::invalid_argument);
+  Ks[1](0, 0) = -1;
+  EXPECT_THROW(stan::math::multi_normal_kronecker_lpdf(y, mu, Ks),
+               std::domain_error);
+  Ks[1](0, 0) = 1;
+  Ks[1](0, 1) = 0.5;
+  EXPECT_THROW(stan::math::multi_normal_kronecker_lpdf(y, mu, Ks),
+               std::domain_error);
+  Ks.pop_back();
+  EXPECT_THROW(stan::math::multi_normal_kronecker_lpdf(y, mu, Ks),
+               std::invalid_argument);
+}
@@ -0,0 +1,46 @@
+#include <stan/math/prim.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(ProbDistributionsMultiNormalToeplitz, matches_dense) {
+  const int N = 30;
+  std::vector<double> x(N);
+  for (int i = 0; i < N; ++i) {
+    x[i] = 0.15 * i;
+  }
+  Eigen::MatrixXd Sigma
+      = stan::math::add_diag(stan::math::gp_matern32_cov(x, 1.4, 0.8), 0.01);
+  Eigen::VectorXd c = Sigma.col(0);
+  Eigen::VectorXd y = Eigen::VectorXd::Random(N);
+  Eigen::VectorXd mu = Eigen::VectorXd::Random(N);
+  EXPECT_NEAR(stan::math::multi_normal_lpdf(y, mu, Sigma),
+              stan::math::multi_normal_toeplitz_lpdf(y, mu, c), 1e-8);
+  EXPECT_FLOAT_EQ(0.0, stan::math::multi_normal_toeplitz_lpdf<true>(y, mu, c));
+
+  Eigen::VectorXd c1(1);
+  c1 << 2.0;
+  Eigen::VectorXd y1(1);
+  y1 << 0.5;
+  Eigen::VectorXd mu1 = Eigen::VectorXd::Zero(1);
+  EXPECT_NEAR(stan::math::normal_lpdf(0.5, 0, std::sqrt(2.0)),
+              stan::math::multi_normal_toeplitz_lpdf(y1, mu1, c1), 1e-12);
+}
+
+TEST(ProbDistributionsMultiNormalToeplitz, errors) {
+  Eigen::VectorXd y = Eigen::VectorXd::Zero(3);
+  Eigen::VectorXd mu = Eigen::VectorXd::Zero(3);
+  Eigen::VectorXd c(3);
+  c << 1.0, 0.9, 0.0;
+  EXPECT_THROW(stan::math::multi_normal_toeplitz_lpdf(y, mu, c),
+               std::domain_error);
+  c << -1.0, 0.1, 0.0;
+  EXPECT_THROW(stan::math::multi_normal_toeplitz_lpdf(y, mu, c),
+               std::domain_error);
+  c << 1.0, 0.1, 0.0;
+  Eigen::VectorXd mu2 = Eigen::VectorXd::Zero(2);
+  EXPECT_THROW(stan::math::multi_normal_toeplitz_lpdf(y, mu2, c),
+               std::invalid_argument);
+  mu(1) = std::numeric_limits<double>::infinity();
+  EXPECT_THROW(stan::math::multi_normal_toeplitz_lpdf(y, mu, c),
+               std::domain_error);
+}
@@ -111,3 +111,20 @@ TEST(ProbDistributionsNormal, chiSquareGoodnessFitTest) {
   // Assert that they match
   assert_matches_quantiles(samples, quantiles, 1e-6);
 }
+
+TEST(ProbDistributionsNormal, vectorized_matches_boost_stream) {
+  boost::random::mt19937 rng;
+  boost::random::mt19937 rng_boost;
+  Eigen::VectorXd mu = Eigen::VectorXd::LinSpaced(100, -3.0, 4.0);
+  std::vector<double> sigma(100);
+  for (int n = 0; n < 100; ++n) {
+    sigma[n] = 0.1 + 0.05 * n;
+  }
+  std::vector<double> draws = stan::math::normal_rng(mu, sigma, rng);
+  for (int n = 0; n < 100; ++n) {
+    boost::variate_generator<boost::random::mt19937&,
+                             boost::normal_distribution<> >
+        norm_rng(rng_boost, boost::normal_distribution<>(mu(n), sigma[n]));
+    EXPECT_FLOAT_EQ(norm_rng(), draws[n]);
+  }
+}
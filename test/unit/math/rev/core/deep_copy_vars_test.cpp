@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <stan/math/rev/core.hpp>
 #include <stan/math.hpp>
+#include <test/unit/util.hpp>
 #include <vector>
 
 using stan::math::var;
@@ -305,3 +306,20 @@ TEST(AgradRev_deep_copy_vars, std_vector_eigen_matrix_var_arg) {
       EXPECT_NE(out[i](j).vi_, arg[i](j).vi_);
     }
 }
+
+TEST(AgradRev_deep_copy_vars, var_matrix_arg) {
+  Eigen::MatrixXd val(3, 2);
+  val << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+  stan::math::var_value<Eigen::MatrixXd> arg(val);
+
+  auto out = stan::math::deep_copy_vars(arg);
+  EXPECT_MATRIX_EQ(val, out.val());
+  EXPECT_NE(static_cast<void*>(out.vi_), static_cast<void*>(arg.vi_));
+  EXPECT_NE(out.vi_->adj_.data(), arg.vi_->adj_.data());
+
+  auto block_out = stan::math::deep_copy_vars(arg.block(1, 0, 2, 2));
+  EXPECT_MATRIX_EQ(val.block(1, 0, 2, 2), block_out.val());
+  block_out.adj().setOnes();
+  EXPECT_MATRIX_EQ(Eigen::MatrixXd::Zero(3, 2), arg.adj());
+  stan::math::recover_memory();
+}
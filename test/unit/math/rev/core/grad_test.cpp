@@ -90,3 +90,84 @@ TEST(AgradRev, nested_grad_during_chain) {
 
   test_var.grad();
 }
+
+TEST(AgradRev, grad_and_zero_stack) {
+  using stan::math::var;
+  stan::math::recover_memory();
+
+  var a = 2.0;
+  var b = 3.0;
+  var c = a * b;
+  std::vector<var> y{sin(c) + a, c * c, b};
+
+  for (int n = 0; n < 2; ++n) {
+    for (size_t i = 0; i < y.size(); ++i) {
+      y[i].grad();
+      double a_adj = a.adj();
+      double b_adj = b.adj();
+      stan::math::set_zero_all_adjoints();
+
+      stan::math::grad_and_zero_stack(y[i].vi_);
+      EXPECT_FLOAT_EQ(a_adj, a.adj());
+      EXPECT_FLOAT_EQ(b_adj, b.adj());
+      for (auto* x : stan::math::ChainableStack::instance_->var_stack_) {
+        EXPECT_FLOAT_EQ(0.0, static_cast<stan::math::vari*>(x)->adj_);
+      }
+      stan::math::set_zero_nochain_adjoints();
+      EXPECT_FLOAT_EQ(0.0, a.adj());
+      EXPECT_FLOAT_EQ(0.0, b.adj());
+    }
+  }
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, grad_and_zero_stack_callback) {
+  using stan::math::var;
+  stan::math::recover_memory();
+
+  var a = 2.0;
+  var b = 3.0;
+  var u = a * b;
+  var y = u + 1.0;
+  // reads the adjoint of y and writes to the adjoint of u, which are both
+  // chained after the callback
+  stan::math::reverse_pass_callback(
+      [u, y]() mutable { u.adj() += 2.0 * y.adj(); });
+
+  for (int n = 0; n < 2; ++n) {
+    stan::math::grad_and_zero_stack(y.vi_);
+    EXPECT_FLOAT_EQ(9.0, a.adj());
+    EXPECT_FLOAT_EQ(6.0, b.adj());
+    EXPECT_FLOAT_EQ(0.0, u.adj());
+    EXPECT_FLOAT_EQ(0.0, y.adj());
+    stan::math::set_zero_nochain_adjoints();
+    EXPECT_FLOAT_EQ(0.0, a.adj());
+    EXPECT_FLOAT_EQ(0.0, b.adj());
+  }
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, grad_and_zero_stack_nested) {
+  using stan::math::var;
+  stan::math::recover_memory();
+
+  var a = 2.0;
+  var b = a * 3.0;
+  {
+    stan::math::nested_rev_autodiff nested;
+    var c = 1.5;
+    var y = b * c + a;
+    // b is chained outside the nested scope
+    stan::math::grad_and_zero_stack(y.vi_);
+    EXPECT_FLOAT_EQ(1.0, a.adj());
+    EXPECT_FLOAT_EQ(1.5, b.adj());
+    EXPECT_FLOAT_EQ(6.0, c.adj());
+    EXPECT_FLOAT_EQ(0.0, y.adj());
+
+    // only the adjoints of the nested scope are reset
+    stan::math::set_zero_nochain_adjoints();
+    EXPECT_FLOAT_EQ(0.0, c.adj());
+    EXPECT_FLOAT_EQ(1.0, a.adj());
+  }
+  stan::math::recover_memory();
+}
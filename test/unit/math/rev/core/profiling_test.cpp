@@ -0,0 +1,143 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/math/rev/util.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(Profiling, profile_region) {
+  using stan::math::var;
+  stan::math::profile_map profiles;
+  var a = 2.0;
+  var b = 3.0;
+  var c;
+  size_t stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  {
+    stan::math::profile p("region", profiles);
+    c = a * b + stan::math::exp(a);
+  }
+  EXPECT_EQ(stack_size + 5,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+  c.grad();
+  EXPECT_FLOAT_EQ(3.0 + std::exp(2.0), a.adj());
+  EXPECT_FLOAT_EQ(2.0, b.adj());
+
+  stan::math::profile_key key{"region", std::this_thread::get_id()};
+  ASSERT_EQ(1, profiles.count(key));
+  const stan::math::profile_info& info = profiles[key];
+  EXPECT_FALSE(info.is_active());
+  EXPECT_EQ(1, info.get_num_fwd_passes());
+  EXPECT_EQ(1, info.get_num_rev_passes());
+  EXPECT_EQ(3, info.get_chain_stack_used());
+  EXPECT_EQ(0, info.get_nochain_stack_used());
+  EXPECT_LT(0, info.get_arena_bytes());
+  EXPECT_LE(0.0, info.get_fwd_time());
+  EXPECT_LE(0.0, info.get_rev_time());
+  stan::math::recover_memory();
+}
+
+TEST(Profiling, profile_nested) {
+  using stan::math::var;
+  stan::math::profile_map profiles;
+  var a = 2.0;
+  var lp = 0;
+  for (int i = 0; i < 3; ++i) {
+    stan::math::profile outer("outer", profiles);
+    lp += a * i;
+    {
+      stan::math::profile inner("inner", profiles);
+      lp += stan::math::log(a);
+    }
+    EXPECT_THROW(stan::math::profile("outer", profiles), std::runtime_error);
+  }
+  lp.grad();
+  EXPECT_FLOAT_EQ(3.0 + 3 / 2.0, a.adj());
+  auto outer_key = stan::math::profile_key{"outer", std::this_thread::get_id()};
+  auto inner_key = stan::math::profile_key{"inner", std::this_thread::get_id()};
+  EXPECT_EQ(3, profiles[outer_key].get_num_fwd_passes());
+  EXPECT_EQ(3, profiles[outer_key].get_num_rev_passes());
+  EXPECT_EQ(3, profiles[inner_key].get_num_rev_passes());
+  EXPECT_LE(profiles[inner_key].get_chain_stack_used() + 6,
+            profiles[outer_key].get_chain_stack_used());
+  stan::math::recover_memory();
+}
+
+TEST(Profiling, auto_profile) {
+  using stan::math::var;
+  stan::math::profile_map profiles;
+  var mu = 0.5;
+  var sigma = 1.5;
+  Eigen::VectorXd y(3);
+  y << 0.1, -0.4, 1.2;
+  var lp = stan::math::normal_lpdf(y, mu, sigma);
+  EXPECT_EQ(0, profiles.size());
+
+  var lp_auto;
+  {
+    stan::math::auto_profile tagging(profiles);
+    lp_auto = stan::math::normal_lpdf(y, mu, sigma)
+              + stan::math::precomputed_gradients(
+                  1.0, std::vector<var>{mu}, std::vector<double>{2.0});
+  }
+  var lp_untagged = stan::math::normal_lpdf(y, mu, sigma);
+  lp_auto.grad();
+  EXPECT_FLOAT_EQ(lp.val() + 1.0, lp_auto.val());
+
+  auto id = std::this_thread::get_id();
+  stan::math::profile_key op_key{"operands_and_partials", id};
+  stan::math::profile_key pg_key{"precomputed_gradients_vari", id};
+  ASSERT_EQ(1, profiles.count(op_key));
+  ASSERT_EQ(1, profiles.count(pg_key));
+  EXPECT_EQ(2, profiles.size());
+  EXPECT_EQ(1, profiles[op_key].get_num_fwd_passes());
+  EXPECT_EQ(1, profiles[op_key].get_num_rev_passes());
+  EXPECT_EQ(1, profiles[pg_key].get_num_fwd_passes());
+  EXPECT_EQ(1, profiles[pg_key].get_num_rev_passes());
+  EXPECT_EQ(1, profiles[pg_key].get_chain_stack_used());
+
+  double mu_adj = mu.adj();
+  stan::math::set_zero_all_adjoints();
+  lp.grad();
+  EXPECT_FLOAT_EQ(mu_adj - 2.0, mu.adj());
+  stan::math::recover_memory();
+}
+
+TEST(Profiling, write_profiles) {
+  using stan::math::var;
+  stan::math::profile_map profiles;
+  var a = 2.0;
+  {
+    stan::math::profile p("b \"quoted\", name", profiles);
+    a = a * a;
+  }
+  {
+    stan::math::profile p("a", profiles);
+  }
+  std::stringstream csv;
+  stan::math::write_profile_csv(csv, profiles);
+  std::string line;
+  std::getline(csv, line);
+  EXPECT_EQ(
+      "name,thread_id,forward_time,reverse_time,forward_passes,"
+      "reverse_passes,chain_stack,no_chain_stack,arena_bytes",
+      line);
+  std::getline(csv, line);
+  EXPECT_EQ(0, line.find("\"a\","));
+  std::getline(csv, line);
+  EXPECT_EQ(0, line.find("\"b \"\"quoted\"\", name\","));
+  EXPECT_NE(std::string::npos, line.find(",1,0,1,0,"));
+
+  std::stringstream json;
+  stan::math::write_profile_json(json, profiles);
+  std::string json_str = json.str();
+  EXPECT_EQ(0, json_str.find("[\n  {\"name\": \"a\""));
+  EXPECT_NE(std::string::npos,
+            json_str.find("{\"name\": \"b \\\"quoted\\\", name\""));
+  EXPECT_NE(std::string::npos, json_str.find("\"chain_stack\": 1,"));
+
+  std::stringstream empty;
+  stan::math::write_profile_json(empty, stan::math::profile_map());
+  EXPECT_EQ("[]\n", empty.str());
+  stan::math::recover_memory();
+}
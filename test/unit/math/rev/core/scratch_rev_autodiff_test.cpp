@@ -0,0 +1,86 @@
+#include <stan/math/rev/core.hpp>
+#include <test/unit/math/rev/core/gradable.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+struct AgradLocalScratch : public testing::Test {
+  void SetUp() {
+    // make sure memory's clean before starting each test
+    stan::math::recover_memory();
+  }
+};
+
+TEST_F(AgradLocalScratch, scratch_rev_autodiff_base) {
+  gradable g_out = setup_quad_form();
+  size_t stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  size_t bytes
+      = stan::math::ChainableStack::instance_->memalloc_.bytes_allocated();
+  for (int i = 0; i < 100; ++i) {
+    stan::math::scratch_rev_autodiff scratch;
+    EXPECT_EQ(0, stan::math::ChainableStack::instance_->var_stack_.size());
+    gradable g = setup_quad_form();
+    g.test();
+    scratch.set_zero_all_adjoints();
+    EXPECT_EQ(g.adj(), 0);
+  }
+  EXPECT_EQ(stack_size,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+  EXPECT_EQ(bytes,
+            stan::math::ChainableStack::instance_->memalloc_.bytes_allocated());
+  g_out.test();
+  stan::math::recover_memory();
+}
+
+TEST_F(AgradLocalScratch, scratch_rev_autodiff_outer_vars) {
+  using stan::math::var;
+  var a = 2.0;
+  var b = a * a;
+  {
+    stan::math::scratch_rev_autodiff scratch;
+    var c = 3.0;
+    var d = a * c;
+    d.grad();
+    EXPECT_FLOAT_EQ(2.0, c.adj());
+    EXPECT_FLOAT_EQ(3.0, a.adj());
+  }
+  stan::math::set_zero_all_adjoints();
+  b.grad();
+  EXPECT_FLOAT_EQ(4.0, a.adj());
+  stan::math::recover_memory();
+}
+
+TEST_F(AgradLocalScratch, scratch_rev_autodiff_nested) {
+  using stan::math::var;
+  gradable g0 = setup_simple();
+  {
+    stan::math::scratch_rev_autodiff scratch;
+    gradable g1 = setup_quad_form();
+    {
+      stan::math::scratch_rev_autodiff inner_scratch;
+      gradable g2 = setup_simple();
+      g2.test();
+    }
+    {
+      stan::math::nested_rev_autodiff nested;
+      gradable g3 = setup_simple();
+      g3.test();
+    }
+    g1.test();
+  }
+  g0.test();
+  stan::math::recover_memory();
+}
+
+TEST_F(AgradLocalScratch, scratch_rev_autodiff_exception) {
+  using stan::math::var;
+  auto* instance = stan::math::ChainableStack::instance_;
+  try {
+    stan::math::scratch_rev_autodiff scratch;
+    var a = 1.0;
+    var b = a * 2;
+    throw std::domain_error("error");
+  } catch (const std::domain_error&) {
+  }
+  EXPECT_EQ(instance, stan::math::ChainableStack::instance_);
+  stan::math::recover_memory();
+}
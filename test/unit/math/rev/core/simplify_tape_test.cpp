@@ -0,0 +1,147 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace simplify_tape_test {
+using stan::math::var;
+
+size_t stack_size() {
+  return stan::math::ChainableStack::instance_->var_stack_.size();
+}
+
+// exp() is the only node whose partials simplify_tape() does not know
+var linear_model(const std::vector<var>& x) {
+  var sigma = stan::math::exp(x[0]);
+  var lp = 0;
+  for (size_t i = 1; i < x.size(); ++i) {
+    var mu = x[1] + 0.5 * i * x[2] - x[1] * x[2];
+    lp = lp + stan::math::normal_lpdf(0.1 * i, mu, sigma);
+    lp = lp - 2.0 * -x[i];
+  }
+  return lp;
+}
+
+std::vector<var> make_vars(size_t n) {
+  std::vector<var> x;
+  for (size_t i = 0; i < n; ++i) {
+    x.emplace_back(0.3 + 0.2 * i);
+  }
+  return x;
+}
+
+std::vector<double> reference_gradient(size_t n) {
+  std::vector<var> x = make_vars(n);
+  var lp = linear_model(x);
+  lp.grad();
+  std::vector<double> grad;
+  for (const auto& x_i : x) {
+    grad.push_back(x_i.adj());
+  }
+  stan::math::recover_memory();
+  return grad;
+}
+}  // namespace simplify_tape_test
+
+TEST(AgradRevSimplifyTape, linear_chains) {
+  using simplify_tape_test::stack_size;
+  using stan::math::var;
+  std::vector<double> grad = simplify_tape_test::reference_gradient(10);
+
+  std::vector<var> x = simplify_tape_test::make_vars(10);
+  var lp = simplify_tape_test::linear_model(x);
+  size_t size = stack_size();
+  double lp_val = lp.val();
+  stan::math::simplify_tape(lp);
+  EXPECT_LT(stack_size(), size / 2);
+  EXPECT_FLOAT_EQ(lp_val, lp.val());
+
+  lp.grad();
+  for (size_t i = 0; i < x.size(); ++i) {
+    EXPECT_FLOAT_EQ(grad[i], x[i].adj());
+  }
+
+  stan::math::set_zero_all_adjoints();
+  lp.grad();
+  for (size_t i = 0; i < x.size(); ++i) {
+    EXPECT_FLOAT_EQ(grad[i], x[i].adj());
+  }
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevSimplifyTape, unused_nodes) {
+  using simplify_tape_test::stack_size;
+  using stan::math::var;
+  var a = 2.0;
+  var b = 3.0;
+  var unused = a * 3.0 + b;
+  var y = a * b;
+  var after = y - 1.0;
+  EXPECT_EQ(4, stack_size());
+
+  stan::math::simplify_tape(y);
+  EXPECT_EQ(1, stack_size());
+  y.grad();
+  EXPECT_FLOAT_EQ(3.0, a.adj());
+  EXPECT_FLOAT_EQ(2.0, b.adj());
+  EXPECT_FLOAT_EQ(0.0, unused.adj());
+  EXPECT_FLOAT_EQ(0.0, after.adj());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevSimplifyTape, other_nodes) {
+  using simplify_tape_test::stack_size;
+  using stan::math::var;
+  var a = 0.5;
+  var b = 1.5;
+  var c = -1.0;
+  var u = a + b;
+  var v = stan::math::exp(u);
+  var y = v * 2.0 + u - c;
+  EXPECT_EQ(5, stack_size());
+
+  // u is used by exp(), so it is kept, while the nodes after exp() are
+  // folded into a single one
+  stan::math::simplify_tape(y);
+  EXPECT_EQ(3, stack_size());
+  y.grad();
+  EXPECT_FLOAT_EQ(2.0 * std::exp(2.0) + 1.0, a.adj());
+  EXPECT_FLOAT_EQ(2.0 * std::exp(2.0) + 1.0, b.adj());
+  EXPECT_FLOAT_EQ(-1.0, c.adj());
+  EXPECT_FLOAT_EQ(2.0, v.adj());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevSimplifyTape, shared_nodes) {
+  using simplify_tape_test::stack_size;
+  using stan::math::var;
+  var a = 1.5;
+  var u = a * 2.0;
+  var y = u * u + u;
+  EXPECT_EQ(3, stack_size());
+
+  // u is used three times, so only u * u is folded
+  stan::math::simplify_tape(y);
+  EXPECT_EQ(2, stack_size());
+  y.grad();
+  EXPECT_FLOAT_EQ(8.0 * 1.5 + 2.0, a.adj());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevSimplifyTape, nested) {
+  using simplify_tape_test::stack_size;
+  using stan::math::var;
+  var a = 2.0;
+  var b = a * 4.0 - 1.0;
+  size_t outer_size = stack_size();
+  {
+    stan::math::nested_rev_autodiff nested;
+    var y = (b * 3.0 + a) * 2.0;
+    stan::math::simplify_tape(y);
+    EXPECT_EQ(outer_size + 1, stack_size());
+    y.grad();
+    EXPECT_FLOAT_EQ(6.0, b.adj());
+    EXPECT_FLOAT_EQ(2.0, a.adj());
+  }
+  EXPECT_EQ(outer_size, stack_size());
+  stan::math::recover_memory();
+}
@@ -0,0 +1,138 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+using matrix_v = Eigen::Matrix<stan::math::var, Eigen::Dynamic, Eigen::Dynamic>;
+using vector_v = Eigen::Matrix<stan::math::var, Eigen::Dynamic, 1>;
+
+std::vector<Eigen::MatrixXd> batched_test_spd(int K, int n) {
+  std::vector<Eigen::MatrixXd> As;
+  for (int k = 0; k < K; ++k) {
+    Eigen::MatrixXd X = Eigen::MatrixXd::Random(n, n);
+    As.push_back(X * X.transpose() + n * Eigen::MatrixXd::Identity(n, n));
+  }
+  return As;
+}
+
+template <typename T>
+std::vector<Eigen::MatrixXd> batched_test_adjs(const std::vector<T>& xs) {
+  std::vector<Eigen::MatrixXd> adjs;
+  for (const auto& x : xs) {
+    adjs.push_back(x.adj());
+  }
+  return adjs;
+}
+
+// weighted sum of the elements, so that every adjoint differs
+template <typename T>
+stan::math::var batched_test_objective(const std::vector<T>& xs) {
+  stan::math::var lp = 0;
+  for (size_t k = 0; k < xs.size(); ++k) {
+    for (int i = 0; i < xs[k].size(); ++i) {
+      lp += (1.0 + 0.1 * k + 0.01 * i) * xs[k](i);
+    }
+  }
+  return lp;
+}
+}  // namespace
+
+TEST(AgradRevMatrix, cholesky_decompose_batch) {
+  std::vector<Eigen::MatrixXd> As_d = batched_test_spd(6, 4);
+  std::vector<matrix_v> As(As_d.begin(), As_d.end());
+  std::vector<matrix_v> Ls = stan::math::cholesky_decompose(As);
+  batched_test_objective(Ls).grad();
+  std::vector<Eigen::MatrixXd> adjs = batched_test_adjs(As);
+  stan::math::recover_memory();
+
+  std::vector<matrix_v> As_ref(As_d.begin(), As_d.end());
+  std::vector<matrix_v> Ls_ref;
+  for (const auto& A : As_ref) {
+    Ls_ref.push_back(stan::math::cholesky_decompose(A));
+  }
+  batched_test_objective(Ls_ref).grad();
+  for (int k = 0; k < 6; ++k) {
+    EXPECT_MATRIX_NEAR(As_ref[k].adj(), adjs[k], 1e-10);
+  }
+  stan::math::recover_memory();
+
+  As_d[2](0, 0) = -1;
+  std::vector<matrix_v> As_bad(As_d.begin(), As_d.end());
+  EXPECT_THROW(stan::math::cholesky_decompose(As_bad), std::domain_error);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevMatrix, multiply_batch) {
+  std::vector<Eigen::MatrixXd> As_d;
+  std::vector<Eigen::MatrixXd> Bs_d;
+  for (int k = 0; k < 5; ++k) {
+    As_d.push_back(Eigen::MatrixXd::Random(3, 4));
+    Bs_d.push_back(Eigen::MatrixXd::Random(4, 2));
+  }
+  std::vector<matrix_v> As(As_d.begin(), As_d.end());
+  std::vector<matrix_v> Bs(Bs_d.begin(), Bs_d.end());
+  batched_test_objective(stan::math::multiply(As, Bs)).grad();
+  std::vector<Eigen::MatrixXd> A_adjs = batched_test_adjs(As);
+  std::vector<Eigen::MatrixXd> B_adjs = batched_test_adjs(Bs);
+  stan::math::recover_memory();
+
+  std::vector<matrix_v> As_ref(As_d.begin(), As_d.end());
+  std::vector<matrix_v> Bs_ref(Bs_d.begin(), Bs_d.end());
+  std::vector<matrix_v> Cs_ref;
+  for (int k = 0; k < 5; ++k) {
+    Cs_ref.push_back(stan::math::multiply(As_ref[k], Bs_ref[k]));
+  }
+  batched_test_objective(Cs_ref).grad();
+  for (int k = 0; k < 5; ++k) {
+    EXPECT_MATRIX_NEAR(As_ref[k].adj(), A_adjs[k], 1e-12);
+    EXPECT_MATRIX_NEAR(Bs_ref[k].adj(), B_adjs[k], 1e-12);
+  }
+  stan::math::recover_memory();
+
+  // only one batch of vars
+  std::vector<matrix_v> Bs_v(Bs_d.begin(), Bs_d.end());
+  batched_test_objective(stan::math::multiply(As_d, Bs_v)).grad();
+  for (int k = 0; k < 5; ++k) {
+    EXPECT_MATRIX_NEAR(B_adjs[k], Bs_v[k].adj(), 1e-12);
+  }
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevMatrix, mdivide_left_tri_low_batch) {
+  std::vector<Eigen::MatrixXd> Ls_d = batched_test_spd(4, 5);
+  std::vector<Eigen::VectorXd> bs_d;
+  for (auto& L : Ls_d) {
+    L.triangularView<Eigen::StrictlyUpper>().setZero();
+    bs_d.push_back(Eigen::VectorXd::Random(5));
+  }
+  std::vector<matrix_v> Ls(Ls_d.begin(), Ls_d.end());
+  std::vector<vector_v> bs(bs_d.begin(), bs_d.end());
+  batched_test_objective(stan::math::mdivide_left_tri_low(Ls, bs)).grad();
+  std::vector<Eigen::MatrixXd> L_adjs = batched_test_adjs(Ls);
+  std::vector<Eigen::MatrixXd> b_adjs = batched_test_adjs(bs);
+  stan::math::recover_memory();
+
+  std::vector<matrix_v> Ls_ref(Ls_d.begin(), Ls_d.end());
+  std::vector<vector_v> bs_ref(bs_d.begin(), bs_d.end());
+  std::vector<vector_v> xs_ref;
+  for (int k = 0; k < 4; ++k) {
+    xs_ref.push_back(stan::math::mdivide_left_tri_low(Ls_ref[k], bs_ref[k]));
+  }
+  batched_test_objective(xs_ref).grad();
+  for (int k = 0; k < 4; ++k) {
+    Eigen::MatrixXd L_adj_ref = Ls_ref[k].adj();
+    L_adj_ref.triangularView<Eigen::StrictlyUpper>().setZero();
+    EXPECT_MATRIX_NEAR(L_adj_ref, L_adjs[k], 1e-10);
+    EXPECT_MATRIX_NEAR(bs_ref[k].adj(), b_adjs[k], 1e-10);
+  }
+  stan::math::recover_memory();
+
+  // only the divisors are vars
+  std::vector<matrix_v> Ls_v(Ls_d.begin(), Ls_d.end());
+  batched_test_objective(stan::math::mdivide_left_tri_low(Ls_v, bs_d)).grad();
+  for (int k = 0; k < 4; ++k) {
+    EXPECT_MATRIX_NEAR(L_adjs[k], Ls_v[k].adj(), 1e-10);
+  }
+  stan::math::recover_memory();
+}
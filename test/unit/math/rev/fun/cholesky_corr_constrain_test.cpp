@@ -0,0 +1,74 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+namespace cholesky_corr_constrain_test {
+size_t stack_size() {
+  return stan::math::ChainableStack::instance_->var_stack_.size();
+}
+}  // namespace cholesky_corr_constrain_test
+
+TEST(AgradRevMatrix, cholesky_corr_constrain_nodes) {
+  using cholesky_corr_constrain_test::stack_size;
+  using stan::math::var;
+  int K = 6;
+  Eigen::VectorXd y_val = Eigen::VectorXd::Random((K * (K - 1)) / 2);
+  Eigen::Matrix<var, -1, 1> y = y_val;
+  var lp = 0;
+
+  size_t start = stack_size();
+  Eigen::Matrix<var, -1, -1> L = stan::math::cholesky_corr_constrain(y, K);
+  EXPECT_EQ(1, stack_size() - start);
+  EXPECT_MATRIX_NEAR(stan::math::cholesky_corr_constrain(y_val, K),
+                     stan::math::value_of(L), 1e-12);
+
+  start = stack_size();
+  L = stan::math::cholesky_corr_constrain(y, K, lp);
+  EXPECT_EQ(3, stack_size() - start);
+  double lp_val = 0;
+  stan::math::cholesky_corr_constrain(y_val, K, lp_val);
+  EXPECT_FLOAT_EQ(lp_val, lp.val());
+
+  start = stack_size();
+  Eigen::Matrix<var, -1, -1> S = stan::math::corr_matrix_constrain(y, K);
+  EXPECT_EQ(2, stack_size() - start);
+  EXPECT_MATRIX_NEAR(stan::math::corr_matrix_constrain(y_val, K),
+                     stan::math::value_of(S), 1e-12);
+
+  lp = 0;
+  start = stack_size();
+  S = stan::math::corr_matrix_constrain(y, K, lp);
+  EXPECT_EQ(4, stack_size() - start);
+  lp_val = 0;
+  stan::math::corr_matrix_constrain(y_val, K, lp_val);
+  EXPECT_FLOAT_EQ(lp_val, lp.val());
+
+  Eigen::Matrix<var, -1, 1> x = Eigen::VectorXd::Random(9);
+  start = stack_size();
+  Eigen::Matrix<var, -1, -1> F
+      = stan::math::cholesky_factor_constrain(x, 4, 3, lp);
+  EXPECT_EQ(3, stack_size() - start);
+
+  start = stack_size();
+  var lkj = stan::math::lkj_corr_cholesky_lpdf(L, 2.5);
+  EXPECT_EQ(1, stack_size() - start);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevMatrix, lkj_corr_cholesky_lpdf_eta_gradient) {
+  using stan::math::var;
+  int K = 4;
+  Eigen::VectorXd y_val = Eigen::VectorXd::Random((K * (K - 1)) / 2);
+  Eigen::MatrixXd L = stan::math::cholesky_corr_constrain(y_val, K);
+  for (double eta_val : {0.5, 1.0, 2.5}) {
+    var eta = eta_val;
+    var lp = stan::math::lkj_corr_cholesky_lpdf(L, eta);
+    lp.grad();
+    double eps = 1e-6;
+    double fd = (stan::math::lkj_corr_cholesky_lpdf(L, eta_val + eps)
+                 - stan::math::lkj_corr_cholesky_lpdf(L, eta_val - eps))
+                / (2 * eps);
+    EXPECT_NEAR(fd, eta.adj(), 1e-6);
+    stan::math::recover_memory();
+  }
+}
@@ -1,6 +1,7 @@
 #include <stan/math/rev.hpp>
 #include <gtest/gtest.h>
 #include <test/unit/math/rev/util.hpp>
+#include <test/unit/util.hpp>
 #include <boost/random/mersenne_twister.hpp>
 #include <vector>
 
@@ -470,3 +471,35 @@ TEST(AgradRevMatrix, check_varis_on_stack_large_opencl) {
   test::check_varis_on_stack(stan::math::cholesky_decompose(m1_pos_def));
 }
 #endif
+
+TEST(AgradRevMatrix, mat_cholesky_parallel_blocked) {
+  using stan::math::matrix_d;
+  using stan::math::matrix_v;
+  const int N = 150;
+  matrix_d X = matrix_d::Random(N, N);
+  matrix_d A = X * X.transpose() + N * matrix_d::Identity(N, N);
+  matrix_d W = matrix_d::Random(N, N);
+
+  matrix_v A_serial = A;
+  matrix_v L_serial = stan::math::cholesky_decompose(A_serial);
+  stan::math::sum(stan::math::elt_multiply(W, L_serial)).grad();
+  matrix_d L_serial_val = L_serial.val();
+  matrix_d A_serial_adj = A_serial.adj();
+  stan::math::recover_memory();
+
+  stan::math::cholesky_tuning opts;
+  opts.parallel_size = 16;
+  opts.grain_size = 8;
+  opts.block_size = 13;
+  matrix_v A_parallel = A;
+  matrix_v L_parallel = stan::math::cholesky_decompose(A_parallel, opts);
+  stan::math::sum(stan::math::elt_multiply(W, L_parallel)).grad();
+  EXPECT_MATRIX_NEAR(L_serial_val, L_parallel.val(), 1e-10);
+  EXPECT_MATRIX_NEAR(A_serial_adj, A_parallel.adj(), 1e-10);
+  stan::math::recover_memory();
+
+  matrix_v A_not_pd = -A;
+  EXPECT_THROW(stan::math::cholesky_decompose(A_not_pd, opts),
+               std::domain_error);
+  stan::math::recover_memory();
+}
@@ -0,0 +1,107 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/math/rev/util.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+namespace dense_factorization_nested_test {
+using stan::math::var;
+using matrix_v = Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>;
+using vector_v = Eigen::Matrix<var, Eigen::Dynamic, 1>;
+
+/**
+ * Return the gradient of `f` at `x` computed on a fresh stack.
+ */
+template <typename F>
+Eigen::MatrixXd grad_f(const F& f, const Eigen::MatrixXd& x) {
+  matrix_v x_v = x;
+  var fx = f(x_v);
+  fx.grad();
+  Eigen::MatrixXd grad = x_v.adj();
+  stan::math::recover_memory();
+  return grad;
+}
+
+/**
+ * Check that the factorization stored on the stack by a call to `f` at `x`
+ * is still valid after `f` has been called at `y` in nested autodiff and
+ * the nested memory has been recovered and reused.
+ *
+ * @tparam F type of the functor
+ * @param f functor taking a matrix of vars and returning a var
+ * @param x arguments of the outer call
+ * @param y arguments of the nested calls, different from `x`
+ */
+template <typename F>
+void expect_outer_factorization_kept(const F& f, const Eigen::MatrixXd& x,
+                                     const Eigen::MatrixXd& y) {
+  Eigen::MatrixXd grad_x = grad_f(f, x);
+  Eigen::MatrixXd grad_y = grad_f(f, y);
+
+  matrix_v x_v = x;
+  var fx = f(x_v);
+  for (int i = 0; i < 3; ++i) {
+    stan::math::nested_rev_autodiff nested;
+    matrix_v y_v = y;
+    var fy = f(y_v);
+    fy.grad();
+    EXPECT_MATRIX_NEAR(grad_y, y_v.adj(), 1e-10);
+  }
+  fx.grad();
+  EXPECT_MATRIX_NEAR(grad_x, x_v.adj(), 1e-10);
+  stan::math::recover_memory();
+}
+
+Eigen::MatrixXd spd_x() {
+  Eigen::MatrixXd x(3, 3);
+  x << 4, 1, 0.5, 1, 5, 0.3, 0.5, 0.3, 6;
+  return x;
+}
+
+Eigen::MatrixXd spd_y() {
+  Eigen::MatrixXd y(3, 3);
+  y << 2, -0.4, 0.1, -0.4, 3, 0.8, 0.1, 0.8, 1.5;
+  return y;
+}
+}  // namespace dense_factorization_nested_test
+
+TEST(AgradRevMatrix, mdivideLeftNested) {
+  using dense_factorization_nested_test::vector_v;
+  auto f = [](const auto& x) {
+    vector_v b = x.diagonal();
+    return stan::math::sum(stan::math::mdivide_left(x, b));
+  };
+  Eigen::MatrixXd x(3, 3);
+  x << 2, 3, -1, 5, 7, 0.5, 1, -2, 4;
+  Eigen::MatrixXd y(3, 3);
+  y << 1, 0.5, 2, -3, 6, 1, 0.2, 1, 5;
+  dense_factorization_nested_test::expect_outer_factorization_kept(f, x, y);
+}
+
+TEST(AgradRevMatrix, mdivideLeftSpdNested) {
+  using dense_factorization_nested_test::vector_v;
+  auto f = [](const auto& x) {
+    vector_v b = x.diagonal();
+    return stan::math::sum(stan::math::mdivide_left_spd(x, b));
+  };
+  dense_factorization_nested_test::expect_outer_factorization_kept(
+      f, dense_factorization_nested_test::spd_x(),
+      dense_factorization_nested_test::spd_y());
+}
+
+TEST(AgradRevMatrix, eigenvaluesSymNested) {
+  auto f = [](const auto& x) {
+    return stan::math::sum(stan::math::log(stan::math::eigenvalues_sym(x)));
+  };
+  dense_factorization_nested_test::expect_outer_factorization_kept(
+      f, dense_factorization_nested_test::spd_x(),
+      dense_factorization_nested_test::spd_y());
+}
+
+TEST(AgradRevMatrix, eigenvectorsSymNested) {
+  auto f = [](const auto& x) {
+    return stan::math::sum(stan::math::eigenvectors_sym(x));
+  };
+  dense_factorization_nested_test::expect_outer_factorization_kept(
+      f, dense_factorization_nested_test::spd_x(),
+      dense_factorization_nested_test::spd_y());
+}
@@ -358,3 +358,48 @@ TEST(AgradRevMatrix, mdivide_left_tri_upper_grad_vd_cl) {
       = temp;
 }
 #endif
+
+template <Eigen::UpLoType TriView>
+void test_mdivide_left_tri_parallel() {
+  using stan::math::matrix_d;
+  using stan::math::matrix_v;
+  using stan::math::mdivide_left_tri;
+  using stan::math::sum;
+  // large enough for the solves to be split into several column ranges
+  const stan::math::cholesky_tuning opts;
+  const int M = opts.parallel_size;
+  const int N = 2 * opts.grain_size + 1;
+  matrix_d Ad = matrix_d::Random(M, M);
+  Ad.diagonal().array() += 2.0 * M;
+  matrix_d Bd = matrix_d::Random(M, N);
+  matrix_d W = matrix_d::Random(M, N);
+
+  matrix_v Av = Ad;
+  matrix_v Bv = Bd;
+  matrix_v C_vv = mdivide_left_tri<TriView>(Av, Bv);
+  matrix_v C_dv = mdivide_left_tri<TriView>(Ad, Bv);
+  matrix_v C_vd = mdivide_left_tri<TriView>(Av, Bd);
+  sum(stan::math::elt_multiply(W, C_vv + 2 * C_dv + 3 * C_vd)).grad();
+
+  matrix_d C_expected
+      = Ad.template triangularView<TriView>().solve(Bd).eval();
+  matrix_d B_adj_expected
+      = Ad.template triangularView<TriView>().transpose().solve(W).eval();
+  matrix_d A_adj_expected = matrix_d::Zero(M, M);
+  A_adj_expected.template triangularView<TriView>()
+      = -4 * B_adj_expected * C_expected.transpose();
+  EXPECT_MATRIX_NEAR(C_expected, C_vv.val(), 1e-10);
+  EXPECT_MATRIX_NEAR(C_expected, C_dv.val(), 1e-10);
+  EXPECT_MATRIX_NEAR(C_expected, C_vd.val(), 1e-10);
+  EXPECT_MATRIX_NEAR(3 * B_adj_expected, Bv.adj(), 1e-10);
+  EXPECT_MATRIX_NEAR(A_adj_expected, Av.adj(), 1e-10);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevMatrix, mdivide_left_tri_parallel_lower) {
+  test_mdivide_left_tri_parallel<Eigen::Lower>();
+}
+
+TEST(AgradRevMatrix, mdivide_left_tri_parallel_upper) {
+  test_mdivide_left_tri_parallel<Eigen::Upper>();
+}
@@ -0,0 +1,103 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+using matrix_v = Eigen::Matrix<stan::math::var, Eigen::Dynamic, Eigen::Dynamic>;
+
+// weighted sum of the elements, so that every adjoint differs
+stan::math::var scale_matrix_exp_objective(const std::vector<matrix_v>& ys) {
+  stan::math::var lp = 0;
+  for (size_t k = 0; k < ys.size(); ++k) {
+    for (int i = 0; i < ys[k].size(); ++i) {
+      lp += (1.0 + 0.1 * k + 0.01 * i) * ys[k](i);
+    }
+  }
+  return lp;
+}
+
+void test_scale_matrix_exp_multiply_times(const std::vector<double>& ts_d) {
+  using stan::math::var;
+  std::srand(1999);
+  Eigen::MatrixXd A_d = Eigen::MatrixXd::Random(5, 5);
+  Eigen::MatrixXd B_d = Eigen::MatrixXd::Random(5, 2);
+
+  matrix_v A = A_d;
+  matrix_v B = B_d;
+  std::vector<var> ts(ts_d.begin(), ts_d.end());
+  std::vector<matrix_v> ys = stan::math::scale_matrix_exp_multiply(ts, A, B);
+  std::vector<Eigen::MatrixXd> ys_val;
+  for (const auto& y : ys) {
+    ys_val.push_back(y.val());
+  }
+  scale_matrix_exp_objective(ys).grad();
+  Eigen::MatrixXd A_adj = A.adj();
+  Eigen::MatrixXd B_adj = B.adj();
+  std::vector<double> ts_adj;
+  for (const auto& t : ts) {
+    ts_adj.push_back(t.adj());
+  }
+  stan::math::recover_memory();
+
+  matrix_v A_ref = A_d;
+  matrix_v B_ref = B_d;
+  std::vector<var> ts_ref(ts_d.begin(), ts_d.end());
+  std::vector<matrix_v> ys_ref;
+  for (const auto& t : ts_ref) {
+    ys_ref.push_back(stan::math::scale_matrix_exp_multiply(t, A_ref, B_ref));
+  }
+  scale_matrix_exp_objective(ys_ref).grad();
+  for (size_t k = 0; k < ts.size(); ++k) {
+    EXPECT_MATRIX_NEAR(ys_ref[k].val(), ys_val[k], 1e-8);
+    EXPECT_NEAR(ts_ref[k].adj(), ts_adj[k], 1e-8);
+  }
+  EXPECT_MATRIX_NEAR(A_ref.adj(), A_adj, 1e-8);
+  EXPECT_MATRIX_NEAR(B_ref.adj(), B_adj, 1e-8);
+  stan::math::recover_memory();
+}
+}  // namespace
+
+TEST(AgradRevMatrix, scale_matrix_exp_multiply_regular_times) {
+  std::vector<double> ts;
+  for (int k = 0; k < 12; ++k) {
+    ts.push_back(0.25 * k);
+  }
+  test_scale_matrix_exp_multiply_times(ts);
+}
+
+TEST(AgradRevMatrix, scale_matrix_exp_multiply_irregular_times) {
+  test_scale_matrix_exp_multiply_times({0.7, 0.1, 2.3, 0.7, 1.15, 0.0, 1.6});
+}
+
+TEST(AgradRevMatrix, scale_matrix_exp_multiply_times_constant_A) {
+  using stan::math::var;
+  std::srand(1999);
+  Eigen::MatrixXd A = Eigen::MatrixXd::Random(4, 4);
+  Eigen::VectorXd b_d = Eigen::VectorXd::Random(4);
+  Eigen::Matrix<var, Eigen::Dynamic, 1> b = b_d;
+  std::vector<double> ts{0.5, 1.0, 1.5};
+  std::vector<Eigen::Matrix<var, Eigen::Dynamic, 1>> ys
+      = stan::math::scale_matrix_exp_multiply(ts, A, b);
+  stan::math::var lp = 0;
+  for (const auto& y : ys) {
+    lp += stan::math::sum(y);
+  }
+  lp.grad();
+  Eigen::VectorXd expected = Eigen::VectorXd::Zero(4);
+  for (double t : ts) {
+    expected += stan::math::matrix_exp(t * A).transpose()
+                * Eigen::VectorXd::Ones(4);
+  }
+  EXPECT_MATRIX_NEAR(expected, b.adj(), 1e-10);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRevMatrix, scale_matrix_exp_multiply_times_exception) {
+  matrix_v A = Eigen::MatrixXd::Random(2, 2);
+  matrix_v B = Eigen::MatrixXd::Random(2, 2);
+  std::vector<stan::math::var> ts{1.0, -0.5};
+  EXPECT_THROW(stan::math::scale_matrix_exp_multiply(ts, A, B),
+               std::domain_error);
+  stan::math::recover_memory();
+}
@@ -0,0 +1,94 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <functional>
+
+namespace {
+using matrix_v = Eigen::Matrix<stan::math::var, Eigen::Dynamic, Eigen::Dynamic>;
+using spectral_test_function = std::function<stan::math::var(
+    const matrix_v&, const stan::math::spectral_tuning&)>;
+
+// gradient of f at x, with the decompositions selected by the size from
+// which the divide and conquer algorithms are used
+Eigen::MatrixXd spectral_test_gradient(const spectral_test_function& f,
+                                       const Eigen::MatrixXd& x,
+                                       int divide_conquer_size, double& fx) {
+  stan::math::spectral_tuning opts;
+  opts.divide_conquer_size = divide_conquer_size;
+  opts.grain_size = 4;
+  matrix_v x_v = x;
+  stan::math::var res = f(x_v, opts);
+  res.grad();
+  fx = res.val();
+  Eigen::MatrixXd grad = x_v.adj();
+  stan::math::recover_memory();
+  return grad;
+}
+
+void expect_spectral_paths_match(const spectral_test_function& f,
+                                 const Eigen::MatrixXd& x) {
+  double f_serial;
+  double f_divide_conquer;
+  Eigen::MatrixXd grad_serial = spectral_test_gradient(f, x, 1000, f_serial);
+  Eigen::MatrixXd grad_divide_conquer
+      = spectral_test_gradient(f, x, 2, f_divide_conquer);
+  EXPECT_NEAR(f_serial, f_divide_conquer, 1e-8);
+  EXPECT_MATRIX_NEAR(grad_serial, grad_divide_conquer, 1e-8);
+}
+
+// weighted squares of the elements, which do not depend on the signs of
+// the eigenvectors or singular vectors
+stan::math::var spectral_test_objective(const matrix_v& x) {
+  stan::math::var lp = 0;
+  for (int j = 0; j < x.cols(); ++j) {
+    for (int i = 0; i < x.rows(); ++i) {
+      lp += (1.0 + 0.1 * i + 0.03 * j) * stan::math::square(x(i, j));
+    }
+  }
+  return lp;
+}
+}  // namespace
+
+TEST(AgradRevMatrix, eigen_sym_divide_conquer) {
+  using stan::math::spectral_tuning;
+  std::srand(1999);
+  Eigen::MatrixXd X = Eigen::MatrixXd::Random(12, 12);
+  Eigen::MatrixXd m = X + X.transpose();
+  expect_spectral_paths_match(
+      [](const matrix_v& x, const spectral_tuning& opts) {
+        Eigen::VectorXd w = Eigen::VectorXd::LinSpaced(x.rows(), 1, 2);
+        return stan::math::dot_product(w,
+                                       stan::math::eigenvalues_sym(x, opts));
+      },
+      m);
+  expect_spectral_paths_match(
+      [](const matrix_v& x, const spectral_tuning& opts) {
+        return spectral_test_objective(stan::math::eigenvectors_sym(x, opts));
+      },
+      m);
+}
+
+TEST(AgradRevMatrix, svd_divide_conquer) {
+  using stan::math::spectral_tuning;
+  std::srand(1999);
+  Eigen::MatrixXd m = Eigen::MatrixXd::Random(9, 13);
+  for (const Eigen::MatrixXd& x : {m, Eigen::MatrixXd(m.transpose())}) {
+    expect_spectral_paths_match(
+        [](const matrix_v& x, const spectral_tuning& opts) {
+          Eigen::VectorXd w = Eigen::VectorXd::LinSpaced(9, 1, 2);
+          return stan::math::dot_product(
+              w, stan::math::singular_values(x, opts));
+        },
+        x);
+    expect_spectral_paths_match(
+        [](const matrix_v& x, const spectral_tuning& opts) {
+          return spectral_test_objective(stan::math::svd_U(x, opts));
+        },
+        x);
+    expect_spectral_paths_match(
+        [](const matrix_v& x, const spectral_tuning& opts) {
+          return spectral_test_objective(stan::math::svd_V(x, opts));
+        },
+        x);
+  }
+}
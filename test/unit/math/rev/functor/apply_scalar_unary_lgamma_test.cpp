@@ -0,0 +1,24 @@
+// Only includes the header of a function without a specialization of
+// apply_scalar_unary_partial, so that its vectorized reverse mode does not
+// rely on other headers being included first.
+#include <stan/math/rev/fun/lgamma.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+TEST(AgradRev, apply_scalar_unary_without_partial) {
+  using stan::math::var;
+  Eigen::Matrix<var, -1, 1> x(3);
+  x << 0.5, 1.5, 4.0;
+  size_t stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  Eigen::Matrix<var, -1, 1> y = stan::math::lgamma(x);
+  EXPECT_EQ(stack_size + 3,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+
+  var lp = y(0) + 2.0 * y(2);
+  lp.grad();
+  EXPECT_FLOAT_EQ(std::lgamma(1.5), y(1).val());
+  EXPECT_FLOAT_EQ(boost::math::digamma(0.5), x(0).adj());
+  EXPECT_FLOAT_EQ(0.0, x(1).adj());
+  EXPECT_FLOAT_EQ(2.0 * boost::math::digamma(4.0), x(2).adj());
+  stan::math::recover_memory();
+}
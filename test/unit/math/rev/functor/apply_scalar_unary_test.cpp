@@ -0,0 +1,109 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/math/rev/util.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(AgradRev, apply_scalar_unary_vectorized_stack) {
+  using stan::math::var;
+  Eigen::Matrix<var, -1, 1> x(4);
+  x << 0.3, 1.2, 2.5, 0.7;
+  size_t stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  Eigen::Matrix<var, -1, 1> y = stan::math::exp(x);
+  EXPECT_EQ(stack_size + 1,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+
+  stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  Eigen::Matrix<var, -1, 1> z = stan::math::atan(x);
+  EXPECT_EQ(stack_size + 4,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+
+  Eigen::Matrix<var, -1, 1> x0(0);
+  stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  Eigen::Matrix<var, -1, 1> y0 = stan::math::log(x0);
+  EXPECT_EQ(0, y0.size());
+  EXPECT_EQ(stack_size,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, apply_scalar_unary_vectorized_gradients) {
+  using stan::math::var;
+  Eigen::MatrixXd x_val(2, 3);
+  x_val << 0.3, 1.2, 2.5, 0.7, 1.9, 0.1;
+  Eigen::MatrixXd w(2, 3);
+  w << 1, -2, 3, 0.5, 4, -1;
+
+  Eigen::Matrix<var, -1, -1> x = x_val;
+  var lp = stan::math::sum(
+      stan::math::elt_multiply(w, stan::math::log1p_exp(x)));
+  lp.grad();
+  Eigen::MatrixXd grad = x.adj();
+  Eigen::MatrixXd val = stan::math::log1p_exp(x).val();
+  stan::math::recover_memory();
+
+  Eigen::Matrix<var, -1, -1> x_scal = x_val;
+  var lp_scal = 0;
+  for (int i = 0; i < x_scal.size(); ++i) {
+    lp_scal += w(i) * stan::math::log1p_exp(x_scal(i));
+  }
+  lp_scal.grad();
+  EXPECT_MATRIX_NEAR(x_scal.adj(), grad, 1e-14);
+  EXPECT_MATRIX_NEAR(stan::math::log1p_exp(x_val), val, 1e-14);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, apply_scalar_unary_vectorized_block) {
+  using stan::math::var;
+  Eigen::Matrix<var, -1, -1> m(3, 3);
+  for (int i = 0; i < m.size(); ++i) {
+    m(i) = i + 1;
+  }
+  Eigen::Matrix<var, -1, -1> b = stan::math::sqrt(m.block(0, 1, 2, 2));
+  Eigen::Array<var, -1, -1> a = stan::math::log(m.array());
+  var lp = stan::math::sum(b) + stan::math::sum(a.matrix());
+  lp.grad();
+
+  Eigen::MatrixXd m_val = stan::math::value_of(m);
+  Eigen::MatrixXd expected = m_val.array().inverse();
+  expected.block(0, 1, 2, 2).array()
+      += 0.5 / m_val.block(0, 1, 2, 2).array().sqrt();
+  EXPECT_MATRIX_NEAR(expected, m.adj(), 1e-14);
+
+  stan::math::set_zero_all_adjoints();
+  EXPECT_MATRIX_EQ(Eigen::MatrixXd::Zero(2, 2), b.adj());
+  EXPECT_MATRIX_EQ(Eigen::MatrixXd::Zero(3, 3), m.adj());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, apply_scalar_unary_vectorized_nested) {
+  using stan::math::var;
+  std::vector<Eigen::Matrix<var, -1, 1>> x{Eigen::VectorXd::Ones(3),
+                                           Eigen::VectorXd::Ones(3)};
+  stan::math::start_nested();
+  std::vector<Eigen::Matrix<var, -1, 1>> y = stan::math::inv_logit(x);
+  var lp = stan::math::sum(y[0]) + 2 * stan::math::sum(y[1]);
+  lp.grad();
+  double d = stan::math::inv_logit(1.0) * (1 - stan::math::inv_logit(1.0));
+  EXPECT_MATRIX_NEAR(Eigen::VectorXd::Constant(3, d), x[0].adj(), 1e-14);
+  EXPECT_MATRIX_NEAR(Eigen::VectorXd::Constant(3, 2 * d), x[1].adj(), 1e-14);
+  stan::math::recover_memory_nested();
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, apply_scalar_unary_vectorized_arena) {
+  using stan::math::var;
+  Eigen::Matrix<var, -1, 1> x(3);
+  x << 0.3, 1.2, 2.5;
+  Eigen::Matrix<var, -1, 1> y = stan::math::exp(x);
+  // the results are stored next to each other in one array
+  EXPECT_EQ(y(0).vi_ + 1, y(1).vi_);
+  EXPECT_EQ(y(0).vi_ + 2, y(2).vi_);
+
+  stan::math::grad(y(1).vi_);
+  EXPECT_FLOAT_EQ(std::exp(1.2), x(1).adj());
+  EXPECT_FLOAT_EQ(0.0, x(2).adj());
+  stan::math::set_zero_all_adjoints();
+  EXPECT_FLOAT_EQ(0.0, y(1).adj());
+  stan::math::recover_memory();
+}
@@ -0,0 +1,108 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/math/rev/util.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+
+namespace checkpoint_test {
+struct segment_functor {
+  int steps_;
+  template <typename T1, typename T2>
+  auto operator()(const Eigen::Matrix<T1, -1, 1>& x0, const T2& theta) const {
+    Eigen::Matrix<stan::return_type_t<T1, T2>, -1, 1> x = x0;
+    for (int t = 0; t < steps_; ++t) {
+      x = x + 0.01 * stan::math::sin(theta * x);
+    }
+    return x;
+  }
+};
+}  // namespace checkpoint_test
+
+TEST(AgradRev, checkpoint_gradient) {
+  using stan::math::var;
+  Eigen::VectorXd x0_val(3);
+  x0_val << 0.1, 0.5, -0.3;
+  checkpoint_test::segment_functor f{50};
+
+  Eigen::Matrix<var, -1, 1> x0 = x0_val;
+  var theta = 1.7;
+  Eigen::Matrix<var, -1, 1> x = x0;
+  for (int s = 0; s < 10; ++s) {
+    x = f(x, theta);
+  }
+  var lp = stan::math::sum(x);
+  size_t stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  lp.grad();
+  double lp_val = lp.val();
+  Eigen::VectorXd x0_adj = x0.adj();
+  double theta_adj = theta.adj();
+  stan::math::recover_memory();
+
+  Eigen::Matrix<var, -1, 1> x0_ckpt = x0_val;
+  var theta_ckpt = 1.7;
+  Eigen::Matrix<var, -1, 1> x_ckpt = x0_ckpt;
+  for (int s = 0; s < 10; ++s) {
+    x_ckpt = stan::math::checkpoint(f, x_ckpt, theta_ckpt);
+  }
+  var lp_ckpt = stan::math::sum(x_ckpt);
+  EXPECT_LT(10 * stan::math::ChainableStack::instance_->var_stack_.size(),
+            stack_size);
+  lp_ckpt.grad();
+  EXPECT_FLOAT_EQ(lp_val, lp_ckpt.val());
+  EXPECT_MATRIX_NEAR(x0_adj, x0_ckpt.adj(), 1e-12);
+  EXPECT_NEAR(theta_adj, theta_ckpt.adj(), 1e-12);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, checkpoint_scalar) {
+  using stan::math::var;
+  var a = 2.0;
+  var b = 3.0;
+  var y = stan::math::checkpoint(
+      [](const auto& a, const auto& b, double c) {
+        return stan::math::exp(a * b) + c;
+      },
+      a, b, 0.5);
+  EXPECT_FLOAT_EQ(std::exp(6.0) + 0.5, y.val());
+  y.grad();
+  EXPECT_FLOAT_EQ(3.0 * std::exp(6.0), a.adj());
+  EXPECT_FLOAT_EQ(2.0 * std::exp(6.0), b.adj());
+
+  stan::math::set_zero_all_adjoints();
+  EXPECT_FLOAT_EQ(0.0, a.adj());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, checkpoint_nested) {
+  using stan::math::var;
+  var a = 2.0;
+  stan::math::start_nested();
+  var y = stan::math::checkpoint([](const auto& a) { return a * a * a; }, a);
+  y.grad();
+  EXPECT_FLOAT_EQ(12.0, a.adj());
+  stan::math::recover_memory_nested();
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, checkpoint_repeated_outputs) {
+  using stan::math::var;
+  var a = 2.0;
+  Eigen::Matrix<var, -1, 1> y = stan::math::checkpoint(
+      [](const auto& a) {
+        auto x = a * a;
+        Eigen::Matrix<var, -1, 1> res(2);
+        res << x, x;
+        return res;
+      },
+      a);
+  var lp = 3.0 * y(0) + 5.0 * y(1);
+  lp.grad();
+  EXPECT_FLOAT_EQ(32.0, a.adj());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, checkpoint_double) {
+  Eigen::VectorXd x0(2);
+  x0 << 0.1, 0.5;
+  checkpoint_test::segment_functor f{2};
+  EXPECT_MATRIX_EQ(f(x0, 1.0), stan::math::checkpoint(f, x0, 1.0));
+}
@@ -0,0 +1,158 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/math/rev/util.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace parallel_region_test {
+struct normal_term {
+  template <typename T1, typename T2>
+  auto operator()(const Eigen::VectorXd& y, const T1& mu,
+                  const T2& sigma) const {
+    return stan::math::normal_lpdf(y, mu, sigma);
+  }
+};
+
+struct scale {
+  template <typename T>
+  auto operator()(const Eigen::Matrix<T, -1, 1>& x, double c) const {
+    return stan::math::multiply(c, stan::math::exp(x)).eval();
+  }
+};
+
+struct matrix_scale {
+  template <typename T>
+  auto operator()(const stan::math::var_value<T>& x, double c) const {
+    stan::math::var_value<Eigen::MatrixXd> res(c * x.val());
+    stan::math::reverse_pass_callback(
+        [x, res, c]() mutable { x.adj() += c * res.adj(); });
+    return res;
+  }
+};
+}  // namespace parallel_region_test
+
+TEST(AgradRev, parallel_region_independent_terms) {
+  using stan::math::var;
+  std::vector<Eigen::VectorXd> y(4, Eigen::VectorXd(50));
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 50; ++j) {
+      y[i](j) = 0.01 * (i + 1) * j - 0.2;
+    }
+  }
+  parallel_region_test::normal_term f;
+
+  var mu = 0.3;
+  Eigen::Matrix<var, -1, 1> sigma(4);
+  sigma << 1.1, 0.7, 2.0, 1.3;
+  var lp = 0;
+  for (int i = 0; i < 4; ++i) {
+    lp += f(y[i], mu, sigma(i));
+  }
+  lp.grad();
+  double lp_val = lp.val();
+  double mu_adj = mu.adj();
+  Eigen::VectorXd sigma_adj = sigma.adj();
+  stan::math::recover_memory();
+
+  var mu_p = 0.3;
+  Eigen::Matrix<var, -1, 1> sigma_p(4);
+  sigma_p << 1.1, 0.7, 2.0, 1.3;
+  std::vector<var> terms;
+  size_t stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  for (int i = 0; i < 4; ++i) {
+    terms.push_back(stan::math::parallel_region(f, y[i], mu_p, sigma_p(i)));
+  }
+  EXPECT_EQ(stack_size + 1,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+  var lp_p = stan::math::sum(terms);
+  lp_p.grad();
+  EXPECT_FLOAT_EQ(lp_val, lp_p.val());
+  EXPECT_FLOAT_EQ(mu_adj, mu_p.adj());
+  EXPECT_MATRIX_NEAR(sigma_adj, sigma_p.adj(), 1e-12);
+
+  stan::math::set_zero_all_adjoints();
+  EXPECT_FLOAT_EQ(0.0, mu_p.adj());
+  EXPECT_FLOAT_EQ(0.0, terms[2].adj());
+  lp_p.grad();
+  EXPECT_FLOAT_EQ(mu_adj, mu_p.adj());
+  EXPECT_MATRIX_NEAR(sigma_adj, sigma_p.adj(), 1e-12);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, parallel_region_dependent_regions) {
+  using stan::math::var;
+  parallel_region_test::scale f;
+  Eigen::Matrix<var, -1, 1> x(3);
+  x << 0.1, -0.4, 0.8;
+  size_t stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  Eigen::Matrix<var, -1, 1> a = stan::math::parallel_region(f, x, 2.0);
+  Eigen::Matrix<var, -1, 1> b = stan::math::parallel_region(f, a, 0.5);
+  Eigen::Matrix<var, -1, 1> c = stan::math::parallel_region(f, x, 3.0);
+  EXPECT_EQ(stack_size + 2,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+  var lp = stan::math::sum(b) + stan::math::sum(c);
+  lp.grad();
+
+  Eigen::VectorXd x_val = stan::math::value_of(x);
+  Eigen::VectorXd a_val = 2.0 * x_val.array().exp();
+  Eigen::VectorXd expected = (0.5 * a_val.array().exp() * a_val.array()
+                              + 3.0 * x_val.array().exp())
+                                 .matrix();
+  EXPECT_FLOAT_EQ((0.5 * a_val.array().exp()).sum()
+                      + (3.0 * x_val.array().exp()).sum(),
+                  lp.val());
+  EXPECT_MATRIX_NEAR(expected, x.adj(), 1e-12);
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, parallel_region_matrix_views) {
+  using stan::math::var;
+  using stan::math::var_value;
+  parallel_region_test::matrix_scale f;
+  Eigen::MatrixXd x_val(2, 2);
+  x_val << 0.1, -0.4, 0.8, 1.5;
+  var_value<Eigen::MatrixXd> x(x_val);
+  size_t stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  var_value<Eigen::MatrixXd> a = stan::math::parallel_region(f, x, 2.0);
+  // a view of the result of the first region shares its adjoints
+  var_value<Eigen::MatrixXd> b
+      = stan::math::parallel_region(f, a.block(0, 0, 2, 1), 3.0);
+  var_value<Eigen::MatrixXd> c = stan::math::parallel_region(f, x, 4.0);
+  EXPECT_EQ(stack_size + 2,
+            stan::math::ChainableStack::instance_->var_stack_.size());
+  EXPECT_MATRIX_EQ(6.0 * x_val.col(0), b.val());
+  var lp = b.coeff(0) + b.coeff(1) + a.coeff(3) + c.coeff(2);
+  lp.grad();
+
+  Eigen::MatrixXd expected(2, 2);
+  expected << 6.0, 4.0, 6.0, 2.0;
+  EXPECT_MATRIX_EQ(expected, x.adj());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, parallel_region_nested) {
+  using stan::math::var;
+  var a = 2.0;
+  var b = stan::math::parallel_region([](const auto& a) { return a * a; }, a);
+  size_t stack_size = stan::math::ChainableStack::instance_->var_stack_.size();
+  {
+    stan::math::nested_rev_autodiff nested;
+    var c = stan::math::parallel_region(
+        [](const auto& a) { return stan::math::exp(a); }, a);
+    EXPECT_EQ(stack_size + 1,
+              stan::math::ChainableStack::instance_->var_stack_.size());
+    c.grad();
+    EXPECT_FLOAT_EQ(std::exp(2.0), a.adj());
+  }
+  stan::math::set_zero_all_adjoints();
+  b.grad();
+  EXPECT_FLOAT_EQ(4.0, a.adj());
+  stan::math::recover_memory();
+}
+
+TEST(AgradRev, parallel_region_double) {
+  Eigen::VectorXd x(2);
+  x << 0.1, 0.5;
+  parallel_region_test::scale f;
+  EXPECT_MATRIX_EQ(f(x, 2.0), stan::math::parallel_region(f, x, 2.0));
+}
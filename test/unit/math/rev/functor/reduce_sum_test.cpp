@@ -389,3 +389,53 @@ TEST(StanMathRev_reduce_sum, slice_group_gradient) {
 
   stan::math::recover_memory();
 }
+
+TEST(StanMathRev_reduce_sum, shared_args_gradient_grainsize_1) {
+  using stan::math::var;
+  using stan::math::test::get_new_msg;
+  using stan::math::test::grouped_count_lpdf;
+
+  const std::size_t groups = 100;
+  const std::size_t elems_per_group = 10;
+  const std::size_t elems = groups * elems_per_group;
+
+  std::vector<int> data(elems);
+  std::vector<int> gidx(elems);
+  for (std::size_t i = 0; i != elems; ++i) {
+    data[i] = i % 7;
+    gidx[i] = i % groups;
+  }
+
+  Eigen::Matrix<var, -1, 1> vlambda_v(groups);
+  for (std::size_t i = 0; i != groups; ++i) {
+    vlambda_v[i] = i + 0.2;
+  }
+
+  std::vector<var> vref_lambda_v;
+  for (std::size_t i = 0; i != elems; ++i) {
+    vref_lambda_v.push_back(vlambda_v[gidx[i]]);
+  }
+  var poisson_lpdf_ref = stan::math::poisson_lpmf(data, vref_lambda_v);
+  stan::math::grad(poisson_lpdf_ref.vi_);
+  Eigen::VectorXd lambda_ref_adj = vlambda_v.adj();
+
+  stan::math::set_zero_all_adjoints();
+  var poisson_lpdf = stan::math::reduce_sum<grouped_count_lpdf<var>>(
+      data, 1, get_new_msg(), vlambda_v, gidx);
+  EXPECT_FLOAT_EQ(poisson_lpdf_ref.val(), poisson_lpdf.val());
+  stan::math::grad(poisson_lpdf.vi_);
+  for (std::size_t i = 0; i != groups; ++i) {
+    EXPECT_FLOAT_EQ(lambda_ref_adj(i), vlambda_v.adj()(i));
+  }
+
+  stan::math::set_zero_all_adjoints();
+  var poisson_lpdf_static
+      = stan::math::reduce_sum_static<grouped_count_lpdf<var>>(
+          data, 1, get_new_msg(), vlambda_v, gidx);
+  stan::math::grad(poisson_lpdf_static.vi_);
+  for (std::size_t i = 0; i != groups; ++i) {
+    EXPECT_FLOAT_EQ(lambda_ref_adj(i), vlambda_v.adj()(i));
+  }
+
+  stan::math::recover_memory();
+}
@@ -1,6 +1,7 @@
 #include <stan/math/rev.hpp>
 #include <stan/math/prim.hpp>
 #include <gtest/gtest.h>
+#include <test/unit/math/rev/prob/expect_glm_design_matches.hpp>
 #include <vector>
 #include <cmath>
 
@@ -543,3 +544,28 @@ TEST(ProbDistributionsBernoulliLogitGLM,
   EXPECT_THROW(stan::math::bernoulli_logit_glm_lpmf(y, x, alpha, betaw2),
                std::domain_error);
 }
+
+//  We check that the values and gradients with a prepared design matrix match
+//  those with the dense design matrix it was built from.
+TEST(ProbDistributionsBernoulliLogitGLM,
+     glm_matches_bernoulli_logit_design_matrix) {
+  std::vector<int> y{1, 0, 1, 1};
+  auto f = [&](const auto& x, const auto& theta) {
+    return stan::math::bernoulli_logit_glm_lpmf(y, x, theta(0), theta.tail(3));
+  };
+  Eigen::VectorXd theta(4);
+  theta << 0.4, 0.3, -1.2, 0.7;
+  expect_glm_design_matrix_matches(f, theta);
+}
+
+//  We check that the values and gradients with a sparse design matrix match
+//  those with the equivalent dense design matrix.
+TEST(ProbDistributionsBernoulliLogitGLM, glm_matches_bernoulli_logit_sparse) {
+  std::vector<int> y{1, 0, 1, 1};
+  auto f = [&](const auto& x, const auto& theta) {
+    return stan::math::bernoulli_logit_glm_lpmf(y, x, theta(0), theta.tail(3));
+  };
+  Eigen::VectorXd theta(4);
+  theta << 0.4, 0.3, -1.2, 0.7;
+  expect_glm_sparse_matches(f, theta);
+}
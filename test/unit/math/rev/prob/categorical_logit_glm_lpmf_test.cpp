@@ -1,6 +1,7 @@
 #include <stan/math/rev.hpp>
 #include <stan/math/prim.hpp>
 #include <gtest/gtest.h>
+#include <test/unit/math/rev/prob/expect_glm_design_matches.hpp>
 #include <cmath>
 #include <vector>
 
@@ -691,3 +692,16 @@ TEST(ProbDistributionsCategoricalLogitGLM, glm_errors) {
   EXPECT_THROW(categorical_logit_glm_lpmf(y, x, alpha, beta_val2),
                std::domain_error);
 }
+
+//  We check that the values and gradients with a sparse design matrix match
+//  those with the equivalent dense design matrix.
+TEST(ProbDistributionsCategoricalLogitGLM, glm_matches_categorical_sparse) {
+  std::vector<int> y{1, 3, 2, 3};
+  auto f = [&](const auto& x, const auto& theta) {
+    return stan::math::categorical_logit_glm_lpmf(
+        y, x, theta.head(3), stan::math::to_matrix(theta.tail(9), 3, 3));
+  };
+  Eigen::VectorXd theta(12);
+  theta << 0.4, -0.1, 0.2, 0.3, -1.2, 0.7, 0.1, 0.5, -0.4, 1.1, -0.3, 0.2;
+  expect_glm_sparse_matches(f, theta);
+}
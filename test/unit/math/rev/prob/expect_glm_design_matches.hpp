@@ -0,0 +1,70 @@
+#ifndef TEST_UNIT_MATH_REV_PROB_EXPECT_GLM_DESIGN_MATCHES_HPP
+#define TEST_UNIT_MATH_REV_PROB_EXPECT_GLM_DESIGN_MATCHES_HPP
+
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+
+/**
+ * Check that a GLM gives the same value and gradient when its dense design
+ * matrix is replaced by an equivalent design matrix of another type.
+ *
+ * @tparam F type of the functor
+ * @tparam T_x type of the alternative design matrix
+ * @param f functor called with a design matrix and a vector of parameters
+ * that returns the log density
+ * @param x dense design matrix
+ * @param x_alt design matrix equivalent to `x`
+ * @param theta parameter values
+ */
+template <typename F, typename T_x>
+void expect_glm_design_matches(const F& f, const Eigen::MatrixXd& x,
+                               const T_x& x_alt, const Eigen::VectorXd& theta) {
+  double lp_dense;
+  double lp_alt;
+  Eigen::VectorXd grad_dense;
+  Eigen::VectorXd grad_alt;
+  stan::math::gradient([&](const auto& th) { return f(x, th); }, theta,
+                       lp_dense, grad_dense);
+  stan::math::gradient([&](const auto& th) { return f(x_alt, th); }, theta,
+                       lp_alt, grad_alt);
+  EXPECT_FLOAT_EQ(lp_dense, lp_alt);
+  ASSERT_EQ(grad_dense.size(), grad_alt.size());
+  for (int i = 0; i < grad_dense.size(); ++i) {
+    EXPECT_FLOAT_EQ(grad_dense(i), grad_alt(i)) << "gradient element " << i;
+  }
+}
+
+/**
+ * Check that a GLM with four observations and three predictors matches its
+ * dense counterpart when given a prepared `glm_design_matrix`.
+ *
+ * @tparam F type of the functor
+ * @param f functor called with a design matrix and a vector of parameters
+ * @param theta parameter values
+ */
+template <typename F>
+void expect_glm_design_matrix_matches(const F& f,
+                                      const Eigen::VectorXd& theta) {
+  Eigen::MatrixXd x(4, 3);
+  x << 1, 0, -0.5, 2, 1, 0.3, -1, 0, 0.2, 0.5, 0, 1.5;
+  stan::math::glm_design_matrix x_prep(x, 0.3);
+  expect_glm_design_matches(f, x, x_prep, theta);
+}
+
+/**
+ * Check that a GLM with four observations and three predictors matches its
+ * dense counterpart when given an Eigen sparse matrix.
+ *
+ * @tparam F type of the functor
+ * @param f functor called with a design matrix and a vector of parameters
+ * @param theta parameter values
+ */
+template <typename F>
+void expect_glm_sparse_matches(const F& f, const Eigen::VectorXd& theta) {
+  Eigen::MatrixXd x(4, 3);
+  x << 1, 0, 0, 0, 1, 0.3, -1, 0, 0, 0.5, 0, 1.5;
+  Eigen::SparseMatrix<double> x_sparse = x.sparseView();
+  expect_glm_design_matches(f, x, x_sparse, theta);
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+std::vector<double> gp_operator_test_inputs(int N) {
+  std::vector<double> x(N);
+  for (int i = 0; i < N; ++i) {
+    x[i] = 0.37 * i - 0.05 * (i % 3);
+  }
+  return x;
+}
+
+template <typename F>
+std::vector<double> gp_operator_test_grad(const F& f,
+                                          const std::vector<double>& vals) {
+  std::vector<stan::math::var> params(vals.begin(), vals.end());
+  stan::math::var lp = f(params);
+  std::vector<double> grad;
+  lp.grad(params, grad);
+  stan::math::recover_memory();
+  return grad;
+}
+}  // namespace
+
+TEST(ProbDistributionsMultiNormal, gp_operator_y_mu_gradients) {
+  using stan::math::var;
+  std::vector<double> x = gp_operator_test_inputs(15);
+  auto K = stan::math::add_diag(
+      stan::math::gp_matern32_cov_operator(x, 1.1, 0.6), 0.3);
+  Eigen::MatrixXd K_dense = K.to_dense();
+  Eigen::VectorXd y_d = Eigen::VectorXd::Random(15);
+  Eigen::VectorXd mu_d = Eigen::VectorXd::Random(15);
+
+  Eigen::Matrix<var, -1, 1> y = y_d;
+  Eigen::Matrix<var, -1, 1> mu = mu_d;
+  var lp = stan::math::multi_normal_lpdf(y, mu, K);
+  lp.grad();
+  Eigen::VectorXd y_adj = y.adj();
+  Eigen::VectorXd mu_adj = mu.adj();
+  stan::math::recover_memory();
+
+  Eigen::Matrix<var, -1, 1> y_dense = y_d;
+  Eigen::Matrix<var, -1, 1> mu_dense = mu_d;
+  var lp_dense = stan::math::multi_normal_lpdf(y_dense, mu_dense, K_dense);
+  lp_dense.grad();
+  EXPECT_MATRIX_NEAR(y_dense.adj(), y_adj, 1e-6);
+  EXPECT_MATRIX_NEAR(mu_dense.adj(), mu_adj, 1e-6);
+  stan::math::recover_memory();
+
+  // with constant parameters the log determinant is dropped
+  Eigen::Matrix<var, -1, 1> y2 = y_d;
+  EXPECT_NEAR(stan::math::multi_normal_lpdf<true>(y2, mu_d, K).val(),
+              stan::math::multi_normal_lpdf<true>(y2, mu_d, K_dense).val(),
+              1e-8);
+  stan::math::recover_memory();
+}
+
+TEST(ProbDistributionsMultiNormal, gp_operator_parameter_gradients) {
+  using stan::math::var;
+  std::vector<double> x = gp_operator_test_inputs(20);
+  Eigen::VectorXd y = Eigen::VectorXd::Random(20);
+  Eigen::VectorXd mu = Eigen::VectorXd::Zero(20);
+  auto f_operator = [&](const std::vector<var>& p) {
+    auto K = stan::math::add_diag(
+        stan::math::gp_exp_quad_cov_operator(x, p[0], p[1]), p[2]);
+    K.options().num_probes = 2000;
+    return stan::math::multi_normal_lpdf(y, mu, K);
+  };
+  auto f_dense = [&](const std::vector<var>& p) {
+    return stan::math::multi_normal_lpdf(
+        y, mu,
+        stan::math::add_diag(stan::math::gp_exp_quad_cov(x, p[0], p[1]),
+                             p[2]));
+  };
+
+  // uncorrelated inputs, where the trace estimate is exact
+  std::vector<double> params_diag{1.3, 1e-3, 0.2};
+  std::vector<double> grad_diag = gp_operator_test_grad(f_dense, params_diag);
+  std::vector<double> grad_diag_op
+      = gp_operator_test_grad(f_operator, params_diag);
+  EXPECT_NEAR(grad_diag[0], grad_diag_op[0], 1e-6);
+  EXPECT_NEAR(grad_diag[2], grad_diag_op[2], 1e-6);
+
+  // the trace estimate of the gradient has a standard error of order
+  // 1 / sqrt(num_probes)
+  std::vector<double> params{1.0, 0.3, 1.0};
+  std::vector<double> grad = gp_operator_test_grad(f_dense, params);
+  std::vector<double> grad_op = gp_operator_test_grad(f_operator, params);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(grad[i], grad_op[i], 0.1 * std::fabs(grad[i]) + 0.2);
+  }
+}
@@ -0,0 +1,97 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+template <typename F>
+std::vector<double> kronecker_test_grad(const F& f,
+                                        const std::vector<double>& vals) {
+  std::vector<stan::math::var> params(vals.begin(), vals.end());
+  stan::math::var lp = f(params);
+  std::vector<double> grad;
+  lp.grad(params, grad);
+  stan::math::recover_memory();
+  return grad;
+}
+
+template <typename T>
+Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> kronecker_test_dense(
+    const std::vector<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>>& Ks) {
+  Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> K(1, 1);
+  K(0, 0) = 1;
+  for (const auto& Kd : Ks) {
+    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> next(K.rows() * Kd.rows(),
+                                                          K.cols() * Kd.cols());
+    for (int i = 0; i < K.rows(); ++i) {
+      for (int j = 0; j < K.cols(); ++j) {
+        next.block(i * Kd.rows(), j * Kd.cols(), Kd.rows(), Kd.cols())
+            = K(i, j) * Kd;
+      }
+    }
+    K = next;
+  }
+  return K;
+}
+}  // namespace
+
+TEST(ProbDistributionsMultiNormalKronecker, parameter_gradients) {
+  using stan::math::var;
+  using matrix_v = Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>;
+  std::vector<double> x1{0.0, 0.5, 1.0, 1.5};
+  std::vector<double> x2{-1.0, -0.2, 0.6, 1.4, 2.2};
+  std::vector<double> x3{0.0, 1.0, 2.0};
+  const int N = 4 * 5 * 3;
+  Eigen::VectorXd y_d = Eigen::VectorXd::Random(N);
+  Eigen::VectorXd mu_d = Eigen::VectorXd::Random(N);
+  auto factors = [&](const std::vector<var>& p) {
+    return std::vector<matrix_v>{stan::math::gp_exp_quad_cov(x1, p[0], p[1]),
+                                 stan::math::gp_exp_quad_cov(x2, 1.0, p[2]),
+                                 stan::math::gp_exp_quad_cov(x3, 1.0, p[3])};
+  };
+  auto f_kronecker = [&](const std::vector<var>& p) {
+    Eigen::Matrix<var, Eigen::Dynamic, 1> y = y_d;
+    y(11) += p[5];
+    return stan::math::multi_normal_kronecker_lpdf(y, mu_d, factors(p), p[4]);
+  };
+  auto f_dense = [&](const std::vector<var>& p) {
+    Eigen::Matrix<var, Eigen::Dynamic, 1> y = y_d;
+    y(11) += p[5];
+    return stan::math::multi_normal_lpdf(
+        y, mu_d, stan::math::add_diag(kronecker_test_dense(factors(p)), p[4]));
+  };
+  std::vector<double> params{1.3, 0.6, 0.9, 1.1, 0.2, 0.0};
+  std::vector<double> grad = kronecker_test_grad(f_dense, params);
+  std::vector<double> grad_kronecker = kronecker_test_grad(f_kronecker, params);
+  for (size_t i = 0; i < params.size(); ++i) {
+    EXPECT_NEAR(grad[i], grad_kronecker[i], 1e-6 * (1 + std::fabs(grad[i])));
+  }
+}
+
+TEST(ProbDistributionsMultiNormalKronecker, factor_gradients) {
+  using stan::math::var;
+  using matrix_v = Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic>;
+  Eigen::MatrixXd A(3, 3);
+  A << 2.0, 0.4, -0.2, 0.4, 1.5, 0.3, -0.2, 0.3, 1.0;
+  Eigen::MatrixXd B(2, 2);
+  B << 1.0, -0.6, -0.6, 2.0;
+  Eigen::VectorXd y = Eigen::VectorXd::Random(6);
+  Eigen::VectorXd mu = Eigen::VectorXd::Zero(6);
+
+  std::vector<matrix_v> Ks{A, B};
+  var lp = stan::math::multi_normal_kronecker_lpdf(y, mu, Ks);
+  lp.grad();
+  double lp_val = lp.val();
+  Eigen::MatrixXd A_adj = Ks[0].adj();
+  Eigen::MatrixXd B_adj = Ks[1].adj();
+  stan::math::recover_memory();
+
+  std::vector<matrix_v> Ks_dense{A, B};
+  var lp_dense
+      = stan::math::multi_normal_lpdf(y, mu, kronecker_test_dense(Ks_dense));
+  lp_dense.grad();
+  EXPECT_NEAR(lp_dense.val(), lp_val, 1e-10);
+  EXPECT_MATRIX_NEAR(Ks_dense[0].adj(), A_adj, 1e-8);
+  EXPECT_MATRIX_NEAR(Ks_dense[1].adj(), B_adj, 1e-8);
+  stan::math::recover_memory();
+}
@@ -0,0 +1,84 @@
+#include <stan/math/rev.hpp>
+#include <test/unit/util.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+template <typename F>
+std::vector<double> toeplitz_test_grad(const F& f,
+                                       const std::vector<double>& vals) {
+  std::vector<stan::math::var> params(vals.begin(), vals.end());
+  stan::math::var lp = f(params);
+  std::vector<double> grad;
+  lp.grad(params, grad);
+  stan::math::recover_memory();
+  return grad;
+}
+}  // namespace
+
+TEST(ProbDistributionsMultiNormalToeplitz, parameter_gradients) {
+  using stan::math::var;
+  const int N = 25;
+  std::vector<double> x(N);
+  for (int i = 0; i < N; ++i) {
+    x[i] = 0.2 * i;
+  }
+  Eigen::VectorXd y_d = Eigen::VectorXd::Random(N);
+  Eigen::VectorXd mu_d = Eigen::VectorXd::Random(N);
+  std::vector<double> x0{x[0]};
+  auto f_toeplitz = [&](const std::vector<var>& p) {
+    Eigen::Matrix<var, Eigen::Dynamic, 1> c
+        = stan::math::gp_exp_quad_cov(x, x0, p[0], p[1]).col(0);
+    c(0) += p[2];
+    Eigen::Matrix<var, Eigen::Dynamic, 1> y = y_d;
+    Eigen::Matrix<var, Eigen::Dynamic, 1> mu = mu_d;
+    y(3) += p[3];
+    mu(7) += p[4];
+    return stan::math::multi_normal_toeplitz_lpdf(y, mu, c);
+  };
+  auto f_dense = [&](const std::vector<var>& p) {
+    Eigen::Matrix<var, Eigen::Dynamic, 1> y = y_d;
+    Eigen::Matrix<var, Eigen::Dynamic, 1> mu = mu_d;
+    y(3) += p[3];
+    mu(7) += p[4];
+    return stan::math::multi_normal_lpdf(
+        y, mu,
+        stan::math::add_diag(stan::math::gp_exp_quad_cov(x, p[0], p[1]),
+                             p[2]));
+  };
+  std::vector<double> params{1.2, 0.7, 0.05, 0.0, 0.0};
+  std::vector<double> grad = toeplitz_test_grad(f_dense, params);
+  std::vector<double> grad_toeplitz = toeplitz_test_grad(f_toeplitz, params);
+  for (size_t i = 0; i < params.size(); ++i) {
+    EXPECT_NEAR(grad[i], grad_toeplitz[i], 1e-6 * (1 + std::fabs(grad[i])));
+  }
+}
+
+TEST(ProbDistributionsMultiNormalToeplitz, column_gradient) {
+  using stan::math::var;
+  const int N = 6;
+  Eigen::VectorXd c_d(N);
+  c_d << 2.0, 0.5, -0.2, 0.15, 0.1, -0.05;
+  Eigen::VectorXd y = Eigen::VectorXd::Random(N);
+  Eigen::VectorXd mu = Eigen::VectorXd::Zero(N);
+
+  Eigen::Matrix<var, Eigen::Dynamic, 1> c = c_d;
+  var lp = stan::math::multi_normal_toeplitz_lpdf(y, mu, c);
+  lp.grad();
+  double lp_val = lp.val();
+  Eigen::VectorXd c_adj = c.adj();
+  stan::math::recover_memory();
+
+  Eigen::Matrix<var, Eigen::Dynamic, 1> c_dense = c_d;
+  Eigen::Matrix<var, Eigen::Dynamic, Eigen::Dynamic> Sigma(N, N);
+  for (int i = 0; i < N; ++i) {
+    for (int j = 0; j < N; ++j) {
+      Sigma(i, j) = c_dense(std::abs(i - j));
+    }
+  }
+  var lp_dense = stan::math::multi_normal_lpdf(y, mu, Sigma);
+  lp_dense.grad();
+  EXPECT_NEAR(lp_dense.val(), lp_val, 1e-10);
+  EXPECT_MATRIX_NEAR(c_dense.adj(), c_adj, 1e-8);
+  stan::math::recover_memory();
+}
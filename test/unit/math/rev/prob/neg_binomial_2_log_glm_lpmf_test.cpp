@@ -1,6 +1,7 @@
 #include <stan/math/rev.hpp>
 #include <stan/math/prim.hpp>
 #include <gtest/gtest.h>
+#include <test/unit/math/rev/prob/expect_glm_design_matches.hpp>
 #include <vector>
 #include <cmath>
 
@@ -599,3 +600,30 @@ TEST(ProbDistributionsNegBinomial2LogGLM,
       stan::math::neg_binomial_2_log_glm_lpmf(y, x, alpha, beta, sigmaw3),
       std::domain_error);
 }
+
+//  We check that the values and gradients with a prepared design matrix match
+//  those with the dense design matrix it was built from.
+TEST(ProbDistributionsNegBinomial2LogGLM,
+     glm_matches_neg_binomial_2_log_design_matrix) {
+  std::vector<int> y{1, 0, 3, 2};
+  auto f = [&](const auto& x, const auto& theta) {
+    return stan::math::neg_binomial_2_log_glm_lpmf(
+        y, x, theta(0), theta.segment(1, 3), theta(4));
+  };
+  Eigen::VectorXd theta(5);
+  theta << 0.4, 0.3, -1.2, 0.7, 1.3;
+  expect_glm_design_matrix_matches(f, theta);
+}
+
+//  We check that the values and gradients with a sparse design matrix match
+//  those with the equivalent dense design matrix.
+TEST(ProbDistributionsNegBinomial2LogGLM, glm_matches_neg_bin_2_sparse) {
+  std::vector<int> y{1, 0, 3, 2};
+  auto f = [&](const auto& x, const auto& theta) {
+    return stan::math::neg_binomial_2_log_glm_lpmf(
+        y, x, theta(0), theta.segment(1, 3), theta(4));
+  };
+  Eigen::VectorXd theta(5);
+  theta << 0.4, 0.3, -1.2, 0.7, 1.3;
+  expect_glm_sparse_matches(f, theta);
+}
@@ -1,6 +1,7 @@
 #include <stan/math/rev.hpp>
 #include <stan/math/prim.hpp>
 #include <gtest/gtest.h>
+#include <test/unit/math/rev/prob/expect_glm_design_matches.hpp>
 #include <vector>
 #include <cmath>
 
@@ -684,3 +685,31 @@ TEST(ProbDistributionsNormalIdGLM, glm_matches_normal_id_error_checking) {
   EXPECT_THROW(stan::math::normal_id_glm_lpdf(y, x, alpha, beta, sigmaw3),
                std::domain_error);
 }
+
+//  We check that the values and gradients with a prepared design matrix match
+//  those with the dense design matrix it was built from.
+TEST(ProbDistributionsNormalIdGLM, glm_matches_normal_id_design_matrix) {
+  Eigen::VectorXd y(4);
+  y << 0.5, -0.2, 1.1, 2.0;
+  auto f = [&](const auto& x, const auto& theta) {
+    return stan::math::normal_id_glm_lpdf(y, x, theta(0), theta.segment(1, 3),
+                                          theta(4));
+  };
+  Eigen::VectorXd theta(5);
+  theta << 0.4, 0.3, -1.2, 0.7, 1.3;
+  expect_glm_design_matrix_matches(f, theta);
+}
+
+//  We check that the values and gradients with a sparse design matrix match
+//  those with the equivalent dense design matrix.
+TEST(ProbDistributionsNormalIdGLM, glm_matches_normal_id_sparse) {
+  Eigen::VectorXd y(4);
+  y << 0.5, -0.2, 1.1, 2.0;
+  auto f = [&](const auto& x, const auto& theta) {
+    return stan::math::normal_id_glm_lpdf(y, x, theta(0), theta.segment(1, 3),
+                                          theta(4));
+  };
+  Eigen::VectorXd theta(5);
+  theta << 0.4, 0.3, -1.2, 0.7, 1.3;
+  expect_glm_sparse_matches(f, theta);
+}
@@ -0,0 +1,32 @@
+#include <stan/math/rev.hpp>
+#include <gtest/gtest.h>
+
+TEST(ProbDistributionsNormal, arenaAndStackSize) {
+  using stan::math::var;
+  using stan::math::vari;
+  const int N = 500;
+  Eigen::VectorXd y = Eigen::VectorXd::LinSpaced(N, -2.0, 3.0);
+  Eigen::Matrix<var, -1, 1> mu = Eigen::VectorXd::LinSpaced(N, 0.0, 1.0);
+  Eigen::Matrix<var, -1, 1> sigma = Eigen::VectorXd::LinSpaced(N, 0.5, 2.0);
+
+  auto& stack = *stan::math::ChainableStack::instance_;
+  size_t stack_size = stack.var_stack_.size();
+  size_t nochain_size = stack.var_nochain_stack_.size();
+  size_t bytes = stack.memalloc_.bytes_used();
+  var lp = stan::math::normal_lpdf(y, mu, sigma);
+
+  // one node holding an operand and a partial for each element of mu and
+  // sigma
+  EXPECT_EQ(stack_size + 1, stack.var_stack_.size());
+  EXPECT_EQ(nochain_size, stack.var_nochain_stack_.size());
+  EXPECT_LE(stack.memalloc_.bytes_used() - bytes,
+            2 * N * (sizeof(vari*) + sizeof(double)) + 256);
+
+  lp.grad();
+  for (int i = 0; i < N; ++i) {
+    double z = (y(i) - mu(i).val()) / sigma(i).val();
+    EXPECT_FLOAT_EQ(z / sigma(i).val(), mu(i).adj());
+    EXPECT_FLOAT_EQ((z * z - 1) / sigma(i).val(), sigma(i).adj());
+  }
+  stan::math::recover_memory();
+}
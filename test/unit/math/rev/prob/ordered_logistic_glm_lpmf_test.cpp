@@ -1,5 +1,6 @@
 #include <stan/math.hpp>
 #include <gtest/gtest.h>
+#include <test/unit/math/rev/prob/expect_glm_design_matches.hpp>
 #include <Eigen/Core>
 #include <vector>
 
@@ -541,3 +542,16 @@ TEST(ProbDistributionsOrderedLogisticGLM, glm_errors) {
   EXPECT_THROW(stan::math::ordered_logistic_glm_lpmf(y, x, beta, cuts_val4),
                std::domain_error);
 }
+
+//  We check that the values and gradients with a sparse design matrix match
+//  those with the equivalent dense design matrix.
+TEST(ProbDistributionsOrderedLogisticGLM, glm_matches_ordered_logistic_sparse) {
+  std::vector<int> y{1, 3, 2, 3};
+  auto f = [&](const auto& x, const auto& theta) {
+    return stan::math::ordered_logistic_glm_lpmf(y, x, theta.head(3),
+                                                 theta.tail(2));
+  };
+  Eigen::VectorXd theta(5);
+  theta << 0.3, -1.2, 0.7, -0.5, 0.6;
+  expect_glm_sparse_matches(f, theta);
+}
@@ -1,6 +1,7 @@
 #include <stan/math/rev.hpp>
 #include <stan/math/prim.hpp>
 #include <gtest/gtest.h>
+#include <test/unit/math/rev/prob/expect_glm_design_matches.hpp>
 #include <vector>
 #include <cmath>
 
@@ -533,3 +534,27 @@ TEST(ProbDistributionsPoissonLogGLM, glm_matches_poisson_log_vars_propto) {
   double lp1_val = lp1.val();
   EXPECT_FLOAT_EQ(lp_val, lp1_val);
 }
+
+//  We check that the values and gradients with a prepared design matrix match
+//  those with the dense design matrix it was built from.
+TEST(ProbDistributionsPoissonLogGLM, glm_matches_poisson_log_design_matrix) {
+  std::vector<int> y{1, 0, 3, 2};
+  auto f = [&](const auto& x, const auto& theta) {
+    return stan::math::poisson_log_glm_lpmf(y, x, theta(0), theta.tail(3));
+  };
+  Eigen::VectorXd theta(4);
+  theta << 0.4, 0.3, -1.2, 0.7;
+  expect_glm_design_matrix_matches(f, theta);
+}
+
+//  We check that the values and gradients with a sparse design matrix match
+//  those with the equivalent dense design matrix.
+TEST(ProbDistributionsPoissonLogGLM, glm_matches_poisson_log_sparse) {
+  std::vector<int> y{1, 0, 3, 2};
+  auto f = [&](const auto& x, const auto& theta) {
+    return stan::math::poisson_log_glm_lpmf(y, x, theta(0), theta.tail(3));
+  };
+  Eigen::VectorXd theta(4);
+  theta << 0.4, 0.3, -1.2, 0.7;
+  expect_glm_sparse_matches(f, theta);
+}